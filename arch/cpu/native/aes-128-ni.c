@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         AES-128 driver for the native platform that uses the x86
+ *         AES-NI instructions when the CPU has them and the T-table
+ *         driver otherwise. Only built on x86 hosts; see contiki-conf.h.
+ */
+
+#include "lib/aes-128.h"
+#include <string.h>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define AES_NI_AVAILABLE 1
+#else
+#define AES_NI_AVAILABLE 0
+#endif
+
+#if AES_NI_AVAILABLE
+#include <wmmintrin.h>
+
+#define AES_NI_TARGET __attribute__((target("aes,sse2")))
+
+/* Number of CTR blocks kept in flight to hide the aesenc latency */
+#define CTR_PARALLEL 4
+
+static __m128i round_keys_cache[AES_128_KEY_CACHE_SIZE][11];
+static const __m128i *round_keys = round_keys_cache[0];
+static struct aes_128_key_cache key_cache;
+static int has_aes_ni = -1;
+
+/*---------------------------------------------------------------------------*/
+static int
+use_aes_ni(void)
+{
+  if(has_aes_ni < 0) {
+    __builtin_cpu_init();
+    has_aes_ni = __builtin_cpu_supports("aes") ? 1 : 0;
+  }
+  return has_aes_ni;
+}
+/*---------------------------------------------------------------------------*/
+static inline __m128i AES_NI_TARGET
+expand_step(__m128i key, __m128i assist)
+{
+  assist = _mm_shuffle_epi32(assist, 0xff);
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  key = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+  return _mm_xor_si128(key, assist);
+}
+/*---------------------------------------------------------------------------*/
+#define EXPAND(i, rcon) \
+  rk[i] = expand_step(rk[i - 1], _mm_aeskeygenassist_si128(rk[i - 1], rcon))
+
+static void AES_NI_TARGET
+expand_key(__m128i *rk, const uint8_t *key)
+{
+  rk[0] = _mm_loadu_si128((const __m128i *)key);
+  EXPAND(1, 0x01);
+  EXPAND(2, 0x02);
+  EXPAND(3, 0x04);
+  EXPAND(4, 0x08);
+  EXPAND(5, 0x10);
+  EXPAND(6, 0x20);
+  EXPAND(7, 0x40);
+  EXPAND(8, 0x80);
+  EXPAND(9, 0x1b);
+  EXPAND(10, 0x36);
+}
+/*---------------------------------------------------------------------------*/
+static inline __m128i AES_NI_TARGET
+encrypt_block(__m128i s)
+{
+  uint8_t round;
+
+  s = _mm_xor_si128(s, round_keys[0]);
+  for(round = 1; round < 10; round++) {
+    s = _mm_aesenc_si128(s, round_keys[round]);
+  }
+  return _mm_aesenclast_si128(s, round_keys[10]);
+}
+/*---------------------------------------------------------------------------*/
+static void
+set_key(const uint8_t *key)
+{
+  uint8_t slot;
+
+  if(!use_aes_ni()) {
+    aes_128_ttable_driver.set_key(key);
+    return;
+  }
+  if(!aes_128_key_cache_lookup(&key_cache, key, &slot)) {
+    expand_key(round_keys_cache[slot], key);
+  }
+  round_keys = round_keys_cache[slot];
+}
+/*---------------------------------------------------------------------------*/
+static void AES_NI_TARGET
+encrypt_ni(uint8_t *state)
+{
+  __m128i s;
+
+  s = _mm_loadu_si128((const __m128i *)state);
+  _mm_storeu_si128((__m128i *)state, encrypt_block(s));
+}
+/*---------------------------------------------------------------------------*/
+static void
+encrypt(uint8_t *state)
+{
+  if(!use_aes_ni()) {
+    aes_128_ttable_driver.encrypt(state);
+    return;
+  }
+  encrypt_ni(state);
+}
+/*---------------------------------------------------------------------------*/
+static void AES_NI_TARGET
+ctr_ni(const uint8_t *iv, uint8_t *data, uint16_t len)
+{
+  uint8_t blocks[CTR_PARALLEL][AES_128_BLOCK_SIZE];
+  uint8_t keystream[AES_128_BLOCK_SIZE];
+  __m128i s[CTR_PARALLEL];
+  uint16_t counter;
+  uint8_t round;
+  uint8_t n;
+  uint8_t i;
+  uint8_t j;
+
+  for(i = 0; i < CTR_PARALLEL; i++) {
+    memcpy(blocks[i], iv, AES_128_BLOCK_SIZE - 2);
+  }
+  counter = (iv[14] << 8) | iv[15];
+
+  while(len) {
+    n = 0;
+    while(n < CTR_PARALLEL && n * AES_128_BLOCK_SIZE < len) {
+      blocks[n][14] = counter >> 8;
+      blocks[n][15] = counter;
+      counter++;
+      s[n] = _mm_xor_si128(_mm_loadu_si128((const __m128i *)blocks[n]),
+                           round_keys[0]);
+      n++;
+    }
+    /* interleave the blocks so that consecutive aesencs are independent */
+    for(round = 1; round < 10; round++) {
+      for(i = 0; i < n; i++) {
+        s[i] = _mm_aesenc_si128(s[i], round_keys[round]);
+      }
+    }
+    for(i = 0; i < n; i++) {
+      s[i] = _mm_aesenclast_si128(s[i], round_keys[10]);
+      if(len >= AES_128_BLOCK_SIZE) {
+        _mm_storeu_si128((__m128i *)data,
+                         _mm_xor_si128(s[i],
+                                       _mm_loadu_si128((const __m128i *)data)));
+        data += AES_128_BLOCK_SIZE;
+        len -= AES_128_BLOCK_SIZE;
+      } else {
+        _mm_storeu_si128((__m128i *)keystream, s[i]);
+        for(j = 0; j < len; j++) {
+          data[j] ^= keystream[j];
+        }
+        len = 0;
+      }
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+ctr(const uint8_t *iv, uint8_t *data, uint16_t len)
+{
+  if(!use_aes_ni()) {
+    aes_128_ttable_driver.ctr(iv, data, len);
+    return;
+  }
+  ctr_ni(iv, data, len);
+}
+/*---------------------------------------------------------------------------*/
+static void AES_NI_TARGET
+cbc_mac_ni(uint8_t *mac, const uint8_t *data, uint16_t len)
+{
+  uint8_t block[AES_128_BLOCK_SIZE];
+  __m128i s;
+
+  s = _mm_loadu_si128((const __m128i *)mac);
+  while(len) {
+    if(len < AES_128_BLOCK_SIZE) {
+      memset(block, 0, sizeof(block));
+      memcpy(block, data, len);
+      data = block;
+      len = AES_128_BLOCK_SIZE;
+    }
+    s = encrypt_block(_mm_xor_si128(s, _mm_loadu_si128((const __m128i *)data)));
+    data += AES_128_BLOCK_SIZE;
+    len -= AES_128_BLOCK_SIZE;
+  }
+  _mm_storeu_si128((__m128i *)mac, s);
+}
+/*---------------------------------------------------------------------------*/
+static void
+cbc_mac(uint8_t *mac, const uint8_t *data, uint16_t len)
+{
+  if(!use_aes_ni()) {
+    aes_128_ttable_driver.cbc_mac(mac, data, len);
+    return;
+  }
+  cbc_mac_ni(mac, data, len);
+}
+/*---------------------------------------------------------------------------*/
+const struct aes_128_driver aes_128_ni_driver = {
+  set_key,
+  encrypt,
+  ctr,
+  cbc_mac
+};
+/*---------------------------------------------------------------------------*/
+#endif /* AES_NI_AVAILABLE */
@@ -34,5 +34,28 @@
 /*---------------------------------------------------------------------------*/
 #define GPIO_HAL_CONF_ARCH_SW_TOGGLE 1
 /*---------------------------------------------------------------------------*/
+/*
+ * Run on a virtual clock. Instead of sleeping, the main loop moves the
+ * clock forward to the next etimer or rtimer deadline, so that
+ * timer-driven code runs as fast as the host can execute it.
+ */
+#ifdef NATIVE_CONF_VIRTUAL_TIME
+#define NATIVE_VIRTUAL_TIME NATIVE_CONF_VIRTUAL_TIME
+#else
+#define NATIVE_VIRTUAL_TIME 0
+#endif
+
+/*
+ * Ticks added to clock_time() on the virtual clock. A value close to
+ * the largest clock_time_t, e.g. (clock_time_t)-(60 * CLOCK_SECOND),
+ * makes the clock wrap around shortly after boot, so that timer code
+ * can be tested across the wrap.
+ */
+#ifdef NATIVE_CONF_VIRTUAL_CLOCK_OFFSET
+#define NATIVE_VIRTUAL_CLOCK_OFFSET NATIVE_CONF_VIRTUAL_CLOCK_OFFSET
+#else
+#define NATIVE_VIRTUAL_CLOCK_OFFSET 0
+#endif
+/*---------------------------------------------------------------------------*/
 #endif /* NATIVE_DEF_H_ */
 /*---------------------------------------------------------------------------*/
@@ -33,33 +33,292 @@
 /**
  * \file
  *         Native (non-specific) code for the Contiki real-time module rt
+ *
+ *         The rtimer counts microseconds of CLOCK_MONOTONIC. On Linux,
+ *         rtimers are scheduled with a POSIX timer armed with an
+ *         absolute deadline, which fires SIGALRM. The handler then
+ *         writes to an eventfd that the main loop watches, so that a
+ *         process polled by an rtimer callback just before the loop
+ *         goes to sleep still gets to run. Other hosts fall back
+ *         to setitimer(). With NATIVE_CONF_VIRTUAL_TIME, the rtimer
+ *         counts virtual time and expired rtimers are run by the
+ *         platform main loop.
  * \author
  *         Adam Dunkels <adam@sics.se>
  */
 
 #include <signal.h>
+#include <string.h>
+#include <time.h>
 #ifndef _WIN32
 #include <sys/time.h>
 #endif /* !_WIN32 */
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+/* Not defined by older C libraries */
+#ifndef sigev_notify_thread_id
+#define sigev_notify_thread_id _sigev_un._tid
+#endif
+#endif /* __linux__ */
+#include <stdio.h>
 #include <stddef.h>
 
+#include "contiki.h"
 #include "sys/rtimer.h"
 #include "sys/clock.h"
+#if NATIVE_VIRTUAL_TIME
+#include "virtual-clock.h"
+#endif /* NATIVE_VIRTUAL_TIME */
 
-#define DEBUG 0
-#if DEBUG
-#include <stdio.h>
-#define PRINTF(...) printf(__VA_ARGS__)
+/*---------------------------------------------------------------------------*/
+static rtimer_clock_t scheduled;
+
+#if RTIMER_ARCH_JITTER_STATS
+static struct rtimer_arch_jitter jitter = { .min = UINT32_MAX };
+#endif /* RTIMER_ARCH_JITTER_STATS */
+
+#if NATIVE_VIRTUAL_TIME
+static uint8_t armed;
+#elif defined(__linux__)
+/*
+ * The timer carries a pointer to this structure. In a multi-node host,
+ * where every node has its own timer but SIGALRM has one handler, this
+ * gets each expiration to the code of the node that scheduled it. The
+ * signal itself is directed at the thread that initialised the rtimer,
+ * which is the worker thread that runs the node, so that the handler
+ * only ever interrupts that thread, as on a single node.
+ */
+struct timer_owner {
+  void (*fire)(void);
+};
+
+static timer_t timer;
+/* Written after each expiration to wake up the main loop */
+static int wake_fd = -1;
+#endif /* NATIVE_VIRTUAL_TIME */
+/*---------------------------------------------------------------------------*/
+static void
+get_time(struct timespec *ts)
+{
+#if NATIVE_VIRTUAL_TIME
+  uint64_t ns = virtual_clock_now();
+
+  ts->tv_sec = ns / 1000000000;
+  ts->tv_nsec = ns % 1000000000;
+#elif defined(__linux__) || (defined(__MACH__) && __MAC_OS_X_VERSION_MIN_REQUIRED >= 101200)
+  clock_gettime(CLOCK_MONOTONIC, ts);
 #else
-#define PRINTF(...)
+  struct timeval tv;
+
+  gettimeofday(&tv, NULL);
+
+  ts->tv_sec = tv.tv_sec;
+  ts->tv_nsec = tv.tv_usec * 1000;
 #endif
+}
+/*---------------------------------------------------------------------------*/
+static rtimer_clock_t
+to_ticks(const struct timespec *ts)
+{
+  return (rtimer_clock_t)((uint64_t)ts->tv_sec * RTIMER_ARCH_SECOND +
+                          ts->tv_nsec / (1000000000 / RTIMER_ARCH_SECOND));
+}
+/*---------------------------------------------------------------------------*/
+rtimer_clock_t
+rtimer_arch_now(void)
+{
+  struct timespec ts;
+
+#if NATIVE_VIRTUAL_TIME
+  /* Time only passes when the rtimer is read, so that busy-waits end */
+  virtual_clock_advance(virtual_clock_now() +
+                        1000000000 / RTIMER_ARCH_SECOND);
+#endif /* NATIVE_VIRTUAL_TIME */
+  get_time(&ts);
+  return to_ticks(&ts);
+}
+/*---------------------------------------------------------------------------*/
+#if RTIMER_ARCH_JITTER_STATS
+static void
+record_lateness(int32_t late)
+{
+  uint32_t us = late > 0 ? late : 0;
+  unsigned bucket = 0;
 
+  while(bucket < RTIMER_ARCH_JITTER_BUCKETS - 1 && (us >> bucket) != 0) {
+    bucket++;
+  }
+
+  jitter.count++;
+  jitter.total += us;
+  jitter.histogram[bucket]++;
+  if(us < jitter.min) {
+    jitter.min = us;
+  }
+  if(us > jitter.max) {
+    jitter.max = us;
+  }
+}
+#endif /* RTIMER_ARCH_JITTER_STATS */
 /*---------------------------------------------------------------------------*/
 static void
+fire(void)
+{
+#if RTIMER_ARCH_JITTER_STATS
+  record_lateness(RTIMER_CLOCK_DIFF(rtimer_arch_now(), scheduled));
+#endif /* RTIMER_ARCH_JITTER_STATS */
+  rtimer_run_next();
+}
+/*---------------------------------------------------------------------------*/
+#if NATIVE_VIRTUAL_TIME
+void
+rtimer_arch_init(void)
+{
+}
+/*---------------------------------------------------------------------------*/
+void
+rtimer_arch_schedule(rtimer_clock_t t)
+{
+  scheduled = t;
+  armed = 1;
+}
+/*---------------------------------------------------------------------------*/
+int
+rtimer_arch_next_expiration(rtimer_clock_t *t)
+{
+  if(armed) {
+    *t = scheduled;
+  }
+  return armed;
+}
+/*---------------------------------------------------------------------------*/
+int
+rtimer_arch_run_expired(void)
+{
+  struct timespec now;
+
+  get_time(&now);
+  if(!armed || RTIMER_CLOCK_LT(to_ticks(&now), scheduled)) {
+    return 0;
+  }
+  armed = 0;
+  fire();
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+#elif defined(__linux__)
+static void
+fire_and_wake(void)
+{
+  static const uint64_t one = 1;
+
+  fire();
+  /* A failure means that the counter is saturated, and the main loop
+     is woken up already */
+  if(write(wake_fd, &one, sizeof(one)) < 0) {
+    return;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static const struct timer_owner owner = { fire_and_wake };
+/*---------------------------------------------------------------------------*/
+static int
+wake_set_fd(fd_set *rset, fd_set *wset)
+{
+  FD_SET(wake_fd, rset);
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static void
+wake_handle_fd(fd_set *rset, fd_set *wset)
+{
+  uint64_t count;
+
+  if(FD_ISSET(wake_fd, rset)) {
+    /* Nothing to do but to drain the counter: the main loop runs the
+       processes again after returning from here */
+    if(read(wake_fd, &count, sizeof(count)) < 0) {
+      return;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static const struct select_callback wake_callback = {
+  wake_set_fd, wake_handle_fd
+};
+/*---------------------------------------------------------------------------*/
+static void
+interrupt(int sig, siginfo_t *info, void *context)
+{
+  if(info->si_code == SI_TIMER && info->si_value.sival_ptr != NULL) {
+    ((const struct timer_owner *)info->si_value.sival_ptr)->fire();
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+rtimer_arch_init(void)
+{
+  struct sigaction sa;
+  struct sigevent sev;
+
+  wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if(wake_fd < 0) {
+    perror("eventfd");
+  } else {
+    select_set_callback(wake_fd, &wake_callback);
+  }
+
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_sigaction = interrupt;
+  sa.sa_flags = SA_SIGINFO | SA_RESTART;
+  sigemptyset(&sa.sa_mask);
+  sigaction(SIGALRM, &sa, NULL);
+
+  memset(&sev, 0, sizeof(sev));
+  sev.sigev_notify = SIGEV_THREAD_ID;
+  sev.sigev_notify_thread_id = syscall(SYS_gettid);
+  sev.sigev_signo = SIGALRM;
+  sev.sigev_value.sival_ptr = (void *)&owner;
+  if(timer_create(CLOCK_MONOTONIC, &sev, &timer) < 0) {
+    perror("timer_create");
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+rtimer_arch_schedule(rtimer_clock_t t)
+{
+  struct itimerspec its;
+  struct timespec now;
+  int32_t diff;
+  uint64_t ns;
+
+  scheduled = t;
+
+  get_time(&now);
+  diff = RTIMER_CLOCK_DIFF(t, to_ticks(&now));
+  if(diff < 0) {
+    /* An absolute deadline in the past fires right away */
+    diff = 0;
+  }
+
+  ns = now.tv_nsec + (uint64_t)diff * (1000000000 / RTIMER_ARCH_SECOND);
+  its.it_value.tv_sec = now.tv_sec + ns / 1000000000;
+  its.it_value.tv_nsec = ns % 1000000000;
+  its.it_interval.tv_sec = its.it_interval.tv_nsec = 0;
+
+  if(timer_settime(timer, TIMER_ABSTIME, &its, NULL) < 0) {
+    perror("timer_settime");
+  }
+}
+/*---------------------------------------------------------------------------*/
+#else /* NATIVE_VIRTUAL_TIME */
+static void
 interrupt(int sig)
 {
   signal(sig, interrupt);
-  rtimer_run_next();
+  fire();
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -75,18 +334,40 @@ rtimer_arch_schedule(rtimer_clock_t t)
 {
 #ifndef _WIN32
   struct itimerval val;
-  rtimer_clock_t c;
+  int32_t diff;
 
-  c = t - (unsigned short)clock_time();
-  
-  val.it_value.tv_sec = c / CLOCK_SECOND;
-  val.it_value.tv_usec = (c % CLOCK_SECOND) * CLOCK_SECOND;
+  scheduled = t;
 
-  PRINTF("rtimer_arch_schedule time %u %u in %d.%d seconds\n", t, c, val.it_value.tv_sec,
-      val.it_value.tv_usec);
+  diff = RTIMER_CLOCK_DIFF(t, rtimer_arch_now());
+  if(diff <= 0) {
+    /* A zero it_value would disarm the timer */
+    diff = 1;
+  }
 
+  val.it_value.tv_sec = diff / RTIMER_ARCH_SECOND;
+  val.it_value.tv_usec = diff % RTIMER_ARCH_SECOND;
   val.it_interval.tv_sec = val.it_interval.tv_usec = 0;
   setitimer(ITIMER_REAL, &val, NULL);
 #endif /* !_WIN32 */
 }
+#endif /* NATIVE_VIRTUAL_TIME */
+/*---------------------------------------------------------------------------*/
+const struct rtimer_arch_jitter *
+rtimer_arch_jitter(void)
+{
+#if RTIMER_ARCH_JITTER_STATS
+  return &jitter;
+#else /* RTIMER_ARCH_JITTER_STATS */
+  return NULL;
+#endif /* RTIMER_ARCH_JITTER_STATS */
+}
+/*---------------------------------------------------------------------------*/
+void
+rtimer_arch_jitter_reset(void)
+{
+#if RTIMER_ARCH_JITTER_STATS
+  memset(&jitter, 0, sizeof(jitter));
+  jitter.min = UINT32_MAX;
+#endif /* RTIMER_ARCH_JITTER_STATS */
+}
 /*---------------------------------------------------------------------------*/
@@ -32,7 +32,8 @@
 
 /**
  * \file
- *         A brief description of what this file is.
+ *         Native rtimer, driven by CLOCK_MONOTONIC with microsecond
+ *         resolution
  * \author
  *         Adam Dunkels <adam@sics.se>
  */
@@ -42,8 +43,58 @@
 
 #include "contiki.h"
 
-#define RTIMER_ARCH_SECOND CLOCK_CONF_SECOND
+#define RTIMER_ARCH_SECOND 1000000UL
 
-#define rtimer_arch_now() clock_time()
+/* One tick is one microsecond */
+#define US_TO_RTIMERTICKS(us)    ((int32_t)(us))
+#define RTIMERTICKS_TO_US(rt)    ((int32_t)(rt))
+#define RTIMERTICKS_TO_US_64(rt) ((uint32_t)(rt))
+
+/* Keep track of how late rtimers fire */
+#ifdef NATIVE_CONF_RTIMER_JITTER_STATS
+#define RTIMER_ARCH_JITTER_STATS NATIVE_CONF_RTIMER_JITTER_STATS
+#else /* NATIVE_CONF_RTIMER_JITTER_STATS */
+#define RTIMER_ARCH_JITTER_STATS 1
+#endif /* NATIVE_CONF_RTIMER_JITTER_STATS */
+
+/* Bucket i of the lateness histogram counts expirations that were
+ * between 2^(i-1) and 2^i - 1 microseconds late, bucket 0 those that
+ * were on time. The last bucket counts everything later. */
+#define RTIMER_ARCH_JITTER_BUCKETS 16
+
+struct rtimer_arch_jitter {
+  uint32_t count;
+  uint32_t min;
+  uint32_t max;
+  uint64_t total;
+  uint32_t histogram[RTIMER_ARCH_JITTER_BUCKETS];
+};
+
+rtimer_clock_t rtimer_arch_now(void);
+
+/**
+ * \brief Get the lateness statistics of rtimer expirations, in
+ *        microseconds
+ */
+const struct rtimer_arch_jitter *rtimer_arch_jitter(void);
+
+/**
+ * \brief Reset the lateness statistics
+ */
+void rtimer_arch_jitter_reset(void);
+
+#if NATIVE_VIRTUAL_TIME
+/**
+ * \brief Get the deadline of the scheduled rtimer, in virtual time
+ * \return Non-zero if an rtimer is scheduled
+ */
+int rtimer_arch_next_expiration(rtimer_clock_t *t);
+
+/**
+ * \brief Run the scheduled rtimer if its deadline has passed
+ * \return Non-zero if an rtimer was run
+ */
+int rtimer_arch_run_expired(void);
+#endif /* NATIVE_VIRTUAL_TIME */
 
 #endif /* RTIMER_ARCH_H_ */
@@ -53,6 +53,11 @@
 /* Must be included after cc13xx-cc26xx-conf.h */
 #include <Board.h>
 /*---------------------------------------------------------------------------*/
+/* Let drivers post events straight from their interrupt handlers */
+#ifndef PROCESS_CONF_NUMEVENTS_ISR
+#define PROCESS_CONF_NUMEVENTS_ISR 8
+#endif
+/*---------------------------------------------------------------------------*/
 /* Define different handling for the shell (dev/serial-line.c):
  * We'd rather not ignore any characters at all and just accept CR as the
  * terminator, as is the default with Tera Term.
@@ -197,6 +197,15 @@ bufRdy_callback(PDMCC26XX_Handle handle, PDMCC26XX_StreamNotification *streamNot
         /* All cases above result in a buffer available so we post it. */
         /* User is required to access buffer with audio_sensor.value() */
         audio_sensor_obj.status = AUDIO_SENSOR_STATUS_DATA_READY;
+#if PROCESS_NUMEVENTS_ISR
+        /* Notify the listeners directly instead of through a poll of
+         * the sensors process. Fall back to the poll if the ring is full.
+         */
+        if(process_post_isr(PROCESS_BROADCAST, sensors_event,
+                            (process_data_t)&audio_sensor) == PROCESS_ERR_OK) {
+          break;
+        }
+#endif /* PROCESS_NUMEVENTS_ISR */
         sensors_changed(&audio_sensor);
         break;
     case PDMCC26XX_STREAM_ERROR:
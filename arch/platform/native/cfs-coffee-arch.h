@@ -43,18 +43,36 @@
 #include "contiki.h"
 #include "dev/xmem.h"
 
+/* The geometry can be changed to exercise Coffee on a smaller file
+   system. COFFEE_SIZE must not exceed the 1 MiB of xmem.c. */
+#ifdef COFFEE_CONF_SECTOR_SIZE
+#define COFFEE_SECTOR_SIZE		COFFEE_CONF_SECTOR_SIZE
+#else
 #define COFFEE_SECTOR_SIZE		65536UL
+#endif
 #define COFFEE_PAGE_SIZE		256UL
 #define COFFEE_START			0
+#ifdef COFFEE_CONF_SIZE
+#define COFFEE_SIZE			COFFEE_CONF_SIZE
+#else
 #define COFFEE_SIZE			((1024UL * 1024UL) - COFFEE_START)
+#endif
 #define COFFEE_NAME_LENGTH		16
+#ifdef COFFEE_CONF_DYN_SIZE
+#define COFFEE_DYN_SIZE			COFFEE_CONF_DYN_SIZE
+#else
 #define COFFEE_DYN_SIZE			16384
+#endif
 #define COFFEE_MAX_OPEN_FILES		6
 #define COFFEE_FD_SET_SIZE		8
 #define COFFEE_LOG_DIVISOR		4
 #define COFFEE_LOG_SIZE			8192
 #define COFFEE_LOG_TABLE_LIMIT		256
+#ifdef COFFEE_CONF_MICRO_LOGS
+#define COFFEE_MICRO_LOGS		COFFEE_CONF_MICRO_LOGS
+#else
 #define COFFEE_MICRO_LOGS		0
+#endif
 
 #define COFFEE_WRITE(buf, size, offset)				\
 		xmem_pwrite((char *)(buf), (size), COFFEE_START + (offset))
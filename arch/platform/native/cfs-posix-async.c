@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Asynchronous CFS I/O for the native platform. A worker thread
+ *         does the blocking read() and write() calls. It reports back
+ *         through a pipe that the main loop watches, and the completion
+ *         events are posted from the main loop.
+ */
+
+#include "contiki.h"
+#include "lib/list.h"
+#include "cfs/cfs-async.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <unistd.h>
+
+process_event_t cfs_async_event;
+
+/* Operations stay on the pending list until the worker is done with
+   them, and then wait on the finished list for the main loop. Both
+   lists are protected by the mutex. */
+LIST(pending);
+LIST(finished);
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work = PTHREAD_COND_INITIALIZER;
+static int wake_pipe[2] = { -1, -1 };
+static uint8_t started;
+/*---------------------------------------------------------------------------*/
+static void
+wake_main_loop(void)
+{
+  static const char c = 0;
+
+  /* A full pipe already wakes the main loop, so a failure is fine. */
+  if(write(wake_pipe[1], &c, 1) < 0 && errno != EAGAIN) {
+    perror("cfs-async: write");
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+transfer(struct cfs_async_op *op)
+{
+  ssize_t r;
+
+  r = 0;
+  while(op->done < op->len) {
+    if(op->type == CFS_ASYNC_READ) {
+      r = read(op->fd, (char *)op->buf + op->done, op->len - op->done);
+    } else {
+      r = write(op->fd, (char *)op->buf + op->done, op->len - op->done);
+    }
+    if(r < 0 && errno == EINTR) {
+      continue;
+    }
+    if(r <= 0) {
+      break;
+    }
+    op->done += r;
+  }
+
+  op->result = r < 0 && op->done == 0 ? -1 : op->done;
+}
+/*---------------------------------------------------------------------------*/
+static void *
+worker(void *arg)
+{
+  struct cfs_async_op *op;
+
+  pthread_mutex_lock(&lock);
+  while(1) {
+    op = list_head(pending);
+    if(op == NULL) {
+      pthread_cond_wait(&work, &lock);
+      continue;
+    }
+
+    pthread_mutex_unlock(&lock);
+    transfer(op);
+    pthread_mutex_lock(&lock);
+
+    list_remove(pending, op);
+    list_add(finished, op);
+    wake_main_loop();
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static int
+set_fd(fd_set *rset, fd_set *wset)
+{
+  FD_SET(wake_pipe[0], rset);
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static void
+handle_fd(fd_set *rset, fd_set *wset)
+{
+  struct cfs_async_op *op;
+  char buf[32];
+
+  if(!FD_ISSET(wake_pipe[0], rset)) {
+    return;
+  }
+  while(read(wake_pipe[0], buf, sizeof(buf)) > 0);
+
+  pthread_mutex_lock(&lock);
+  while((op = list_head(finished)) != NULL) {
+    if(process_post(op->process, cfs_async_event, op) != PROCESS_ERR_OK) {
+      /* The event queue is full; try again on the next round. */
+      wake_main_loop();
+      break;
+    }
+    list_remove(finished, op);
+  }
+  pthread_mutex_unlock(&lock);
+}
+/*---------------------------------------------------------------------------*/
+static const struct select_callback wake_fd = { set_fd, handle_fd };
+/*---------------------------------------------------------------------------*/
+static int
+start(void)
+{
+  pthread_t thread;
+
+  if(started) {
+    return 0;
+  }
+
+  if(pipe(wake_pipe) < 0) {
+    perror("cfs-async: pipe");
+    return -1;
+  }
+  fcntl(wake_pipe[0], F_SETFL, O_NONBLOCK);
+  fcntl(wake_pipe[1], F_SETFL, O_NONBLOCK);
+
+  if(pthread_create(&thread, NULL, worker, NULL) != 0) {
+    fprintf(stderr, "cfs-async: failed to start the worker thread\n");
+    close(wake_pipe[0]);
+    close(wake_pipe[1]);
+    return -1;
+  }
+  pthread_detach(thread);
+
+  cfs_async_event = process_alloc_event();
+  select_set_callback(wake_pipe[0], &wake_fd);
+  started = 1;
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+static int
+enqueue(struct cfs_async_op *op, uint8_t type, int fd, void *buf,
+        unsigned len)
+{
+  if(PROCESS_CURRENT() == NULL || start() < 0) {
+    return -1;
+  }
+
+  pthread_mutex_lock(&lock);
+  if(list_contains(pending, op) || list_contains(finished, op)) {
+    pthread_mutex_unlock(&lock);
+    return -1;
+  }
+
+  op->process = PROCESS_CURRENT();
+  op->type = type;
+  op->fd = fd;
+  op->buf = buf;
+  op->len = len;
+  op->done = 0;
+  op->result = 0;
+
+  list_add(pending, op);
+  pthread_cond_signal(&work);
+  pthread_mutex_unlock(&lock);
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+int
+cfs_async_read(struct cfs_async_op *op, int fd, void *buf, unsigned len)
+{
+  return enqueue(op, CFS_ASYNC_READ, fd, buf, len);
+}
+/*---------------------------------------------------------------------------*/
+int
+cfs_async_write(struct cfs_async_op *op, int fd, const void *buf,
+                unsigned len)
+{
+  return enqueue(op, CFS_ASYNC_WRITE, fd, (void *)buf, len);
+}
+/*---------------------------------------------------------------------------*/
+void
+cfs_async_maintain(void)
+{
+  /* The host file system needs no help. */
+}
+/*---------------------------------------------------------------------------*/
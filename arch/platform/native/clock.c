@@ -38,6 +38,7 @@
  */
 
 #include "sys/clock.h"
+#include "virtual-clock.h"
 #include <time.h>
 #include <sys/time.h>
 
@@ -47,10 +48,32 @@ typedef struct clock_timespec_s {
   long  tv_nsec;
 } clock_timespec_t;
 /*---------------------------------------------------------------------------*/
+#if NATIVE_VIRTUAL_TIME
+/* Nanoseconds since the node started */
+static uint64_t virtual_ns;
+/*---------------------------------------------------------------------------*/
+uint64_t
+virtual_clock_now(void)
+{
+  return virtual_ns;
+}
+/*---------------------------------------------------------------------------*/
+void
+virtual_clock_advance(uint64_t ns)
+{
+  if(ns > virtual_ns) {
+    virtual_ns = ns;
+  }
+}
+#endif /* NATIVE_VIRTUAL_TIME */
+/*---------------------------------------------------------------------------*/
 static void
 get_time(clock_timespec_t *spec)
 {
-#if defined(__linux__) || (defined(__MACH__) && __MAC_OS_X_VERSION_MIN_REQUIRED >= 101200)
+#if NATIVE_VIRTUAL_TIME
+  spec->tv_sec = virtual_ns / 1000000000;
+  spec->tv_nsec = virtual_ns % 1000000000;
+#elif defined(__linux__) || (defined(__MACH__) && __MAC_OS_X_VERSION_MIN_REQUIRED >= 101200)
   struct timespec ts;
 
   clock_gettime(CLOCK_MONOTONIC, &ts);
@@ -74,7 +97,12 @@ clock_time(void)
 
   get_time(&ts);
 
+#if NATIVE_VIRTUAL_TIME
+  return ts.tv_sec * CLOCK_SECOND + ts.tv_nsec / (1000000000 / CLOCK_SECOND) +
+    NATIVE_VIRTUAL_CLOCK_OFFSET;
+#else /* NATIVE_VIRTUAL_TIME */
   return ts.tv_sec * CLOCK_SECOND + ts.tv_nsec / (1000000000 / CLOCK_SECOND);
+#endif /* NATIVE_VIRTUAL_TIME */
 }
 /*---------------------------------------------------------------------------*/
 unsigned long
@@ -60,8 +60,44 @@ int select_set_callback(int fd, const struct select_callback *callback);
 #define EEPROM_CONF_SIZE				1024
 #endif
 
+/* Flash size is not a concern here, so use the fastest CRC code */
+#ifndef CRC16_CONF_IMPL
+#define CRC16_CONF_IMPL CRC16_IMPL_SLICE8
+#endif
+
+#ifndef CRC32C_CONF_IMPL
+#define CRC32C_CONF_IMPL CRC32C_IMPL_SLICE8
+#endif
+
+/* AES-NI where the host has it, else the T-table software driver */
+#ifndef AES_128_CONF
+#if defined(__x86_64__) || defined(__i386__)
+#define AES_128_CONF aes_128_ni_driver
+#else
+#define AES_128_CONF aes_128_ttable_driver
+#endif
+#endif
+
+#ifndef AES_128_CONF_KEY_CACHE_SIZE
+#define AES_128_CONF_KEY_CACHE_SIZE 4
+#endif
+
+/* FatFs volumes live in an image file of the host */
+#ifndef FATFS_CONF_DISK_DRIVER
+#define FATFS_CONF_DISK_DRIVER disk_image_driver
+#endif
+
 typedef unsigned int uip_stats_t;
 
+/* Radio timing used by TSCH: a 250 kbps 802.15.4 radio without delays */
+/* 1 len byte, 2 bytes CRC */
+#define RADIO_PHY_OVERHEAD         3
+/* 250kbps data rate. One byte = 32us */
+#define RADIO_BYTE_AIR_TIME       32
+#define RADIO_DELAY_BEFORE_TX 0
+#define RADIO_DELAY_BEFORE_RX 0
+#define RADIO_DELAY_BEFORE_DETECT 0
+
 #ifndef UIP_CONF_BYTE_ORDER
 #define UIP_CONF_BYTE_ORDER      UIP_LITTLE_ENDIAN
 #endif
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \addtogroup native_platform
+ * @{
+ *
+ * \file
+ *         Disk driver on top of an image file.
+ */
+
+#include "disk-image.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+/*---------------------------------------------------------------------------*/
+static int fd = -1;
+static struct disk_image_stats stats;
+/*---------------------------------------------------------------------------*/
+static disk_status_t
+image_status(uint8_t dev)
+{
+  if(dev != 0 || fd < 0) {
+    return 0;
+  }
+  return DISK_STATUS_INIT | DISK_STATUS_DISK | DISK_STATUS_WRITABLE;
+}
+/*---------------------------------------------------------------------------*/
+static disk_status_t
+image_initialize(uint8_t dev)
+{
+  off_t size;
+
+  if(dev == 0 && fd < 0) {
+    fd = open(DISK_IMAGE_FILE, O_RDWR | O_CREAT, 0644);
+    if(fd >= 0) {
+      size = (off_t)DISK_IMAGE_SECTORS * DISK_IMAGE_SECTOR_SIZE;
+      if(lseek(fd, 0, SEEK_END) < size && ftruncate(fd, size) != 0) {
+        close(fd);
+        fd = -1;
+      }
+    }
+  }
+  return image_status(dev);
+}
+/*---------------------------------------------------------------------------*/
+static disk_result_t
+check(uint8_t dev, uint32_t sector, uint32_t count)
+{
+  if(dev != 0 || count == 0) {
+    return DISK_RESULT_INVALID_ARG;
+  }
+  if(fd < 0) {
+    return DISK_RESULT_NO_INIT;
+  }
+  if(sector >= DISK_IMAGE_SECTORS || count > DISK_IMAGE_SECTORS - sector) {
+    return DISK_RESULT_INVALID_ARG;
+  }
+  if(lseek(fd, (off_t)sector * DISK_IMAGE_SECTOR_SIZE, SEEK_SET) < 0) {
+    return DISK_RESULT_IO_ERROR;
+  }
+  return DISK_RESULT_OK;
+}
+/*---------------------------------------------------------------------------*/
+static disk_result_t
+image_read(uint8_t dev, void *buff, uint32_t sector, uint32_t count)
+{
+  disk_result_t res;
+  size_t len;
+
+  res = check(dev, sector, count);
+  if(res != DISK_RESULT_OK) {
+    return res;
+  }
+  len = (size_t)count * DISK_IMAGE_SECTOR_SIZE;
+  if(read(fd, buff, len) != (ssize_t)len) {
+    return DISK_RESULT_IO_ERROR;
+  }
+  stats.reads++;
+  stats.read_sectors += count;
+  return DISK_RESULT_OK;
+}
+/*---------------------------------------------------------------------------*/
+static disk_result_t
+image_write(uint8_t dev, const void *buff, uint32_t sector, uint32_t count)
+{
+  disk_result_t res;
+  size_t len;
+
+  res = check(dev, sector, count);
+  if(res != DISK_RESULT_OK) {
+    return res;
+  }
+  len = (size_t)count * DISK_IMAGE_SECTOR_SIZE;
+  if(write(fd, buff, len) != (ssize_t)len) {
+    return DISK_RESULT_IO_ERROR;
+  }
+  stats.writes++;
+  stats.written_sectors += count;
+  return DISK_RESULT_OK;
+}
+/*---------------------------------------------------------------------------*/
+static disk_result_t
+image_ioctl(uint8_t dev, uint8_t cmd, void *buff)
+{
+  if(dev != 0) {
+    return DISK_RESULT_INVALID_ARG;
+  }
+  if(fd < 0) {
+    return DISK_RESULT_NO_INIT;
+  }
+  switch(cmd) {
+  case DISK_IOCTL_CTRL_SYNC:
+    return DISK_RESULT_OK;
+  case DISK_IOCTL_GET_SECTOR_COUNT:
+    *(uint32_t *)buff = DISK_IMAGE_SECTORS;
+    return DISK_RESULT_OK;
+  case DISK_IOCTL_GET_SECTOR_SIZE:
+    *(uint16_t *)buff = DISK_IMAGE_SECTOR_SIZE;
+    return DISK_RESULT_OK;
+  case DISK_IOCTL_GET_BLOCK_SIZE:
+    *(uint32_t *)buff = 1;
+    return DISK_RESULT_OK;
+  default:
+    return DISK_RESULT_INVALID_ARG;
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+disk_image_stats(struct disk_image_stats *s)
+{
+  *s = stats;
+  memset(&stats, 0, sizeof(stats));
+}
+/*---------------------------------------------------------------------------*/
+const struct disk_driver disk_image_driver = {
+  image_status,
+  image_initialize,
+  image_read,
+  image_write,
+  image_ioctl
+};
+/*---------------------------------------------------------------------------*/
+/** @} */
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \addtogroup native_platform
+ * @{
+ *
+ * \file
+ *         Disk driver that keeps the sectors of a disk in a file of the
+ *         host, so that FatFs volumes can be used and benchmarked on the
+ *         native platform.
+ */
+
+#ifndef DISK_IMAGE_H_
+#define DISK_IMAGE_H_
+
+#include "contiki.h"
+#include "dev/disk/disk.h"
+
+/** Path of the image file, created on first use if it does not exist */
+#ifdef DISK_IMAGE_CONF_FILE
+#define DISK_IMAGE_FILE DISK_IMAGE_CONF_FILE
+#else
+#define DISK_IMAGE_FILE "disk.img"
+#endif
+
+/** Size of the disk, in 512-byte sectors */
+#ifdef DISK_IMAGE_CONF_SECTORS
+#define DISK_IMAGE_SECTORS DISK_IMAGE_CONF_SECTORS
+#else
+#define DISK_IMAGE_SECTORS 65536
+#endif
+
+#define DISK_IMAGE_SECTOR_SIZE 512
+
+/** Commands served by the driver, to compare access patterns */
+struct disk_image_stats {
+  uint32_t reads;           /**< Read commands */
+  uint32_t writes;          /**< Write commands */
+  uint32_t read_sectors;    /**< Sectors read */
+  uint32_t written_sectors; /**< Sectors written */
+};
+
+extern const struct disk_driver disk_image_driver;
+
+/**
+ * \brief       Get the command counters and reset them
+ * \param stats Filled in with the counts since the previous call
+ */
+void disk_image_stats(struct disk_image_stats *stats);
+
+#endif /* DISK_IMAGE_H_ */
+/** @} */
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \addtogroup native_platform
+ * @{
+ *
+ * \file
+ *         Interface between a native node built with NATIVE_MULTI_NODE=1
+ *         and the multi-node host in tools/multi-node-host.
+ *
+ *         Such a node is linked as a shared object. The host loads a
+ *         separate copy of the object for every node, so that each node
+ *         gets its own process list, timers, buffers and addresses,
+ *         and then drives it from one of its worker threads.
+ */
+
+#ifndef NATIVE_NODE_H_
+#define NATIVE_NODE_H_
+
+#include <stdint.h>
+
+/**
+ * \brief      Set the identity of the node
+ * \param id   The node identifier, used as the last two bytes of the
+ *             link-layer address
+ *
+ *             Must be called before main() of the node.
+ */
+void native_node_configure(uint16_t id);
+
+/**
+ * \brief      Get the descriptor that becomes readable when the node
+ *             has an expired etimer or a ready file descriptor
+ * \return     An epoll descriptor, or -1 if the node failed to start
+ *
+ *             Valid once main() of the node has returned.
+ */
+int native_node_fd(void);
+
+/**
+ * \brief      Run the node once without blocking
+ * \return     Non-zero if the node has more work to do right away
+ */
+int native_node_run(void);
+
+#endif /* NATIVE_NODE_H_ */
+/** @} */
@@ -52,9 +52,17 @@
 #include "net/wpcap-drv.h"
 #endif /* __CYGWIN__ */
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#endif /* __linux__ */
+
 #include "contiki.h"
 #include "net/netstack.h"
 
+#include "native-node.h"
+#include "virtual-clock.h"
+
 #include "dev/serial-line.h"
 #include "dev/button-hal.h"
 #include "dev/gpio-hal.h"
@@ -80,12 +88,27 @@
  * @{
  */
 
+/*
+ * Build the node to be hosted, together with other nodes, in a single
+ * process by the native multi-node host. The platform main loop then
+ * returns once the node is initialised and the host drives the node
+ * through native_node_run().
+ */
+#ifdef NATIVE_CONF_MULTI_NODE
+#define NATIVE_MULTI_NODE NATIVE_CONF_MULTI_NODE
+#else
+#define NATIVE_MULTI_NODE 0
+#endif
+
 /*
  * Defines the maximum number of file descriptors monitored by the platform
- * main loop.
+ * main loop. Hosted nodes share the descriptor space of the host process,
+ * so their descriptors are not limited to the first few.
  */
 #ifdef SELECT_CONF_MAX
 #define SELECT_MAX SELECT_CONF_MAX
+#elif NATIVE_MULTI_NODE
+#define SELECT_MAX FD_SETSIZE
 #else
 #define SELECT_MAX 8
 #endif
@@ -105,9 +128,36 @@
  */
 #ifdef SELECT_CONF_STDIN
 #define SELECT_STDIN SELECT_CONF_STDIN
+#elif NATIVE_MULTI_NODE
+#define SELECT_STDIN 0
 #else
 #define SELECT_STDIN 1
 #endif
+
+/*
+ * Use a tickless main loop based on epoll and a timerfd instead of
+ * select() with a fixed timeout. The loop sleeps until the next etimer
+ * expires or a monitored file descriptor becomes ready. Only available
+ * on Linux.
+ */
+#ifdef SELECT_CONF_EPOLL
+#define SELECT_EPOLL SELECT_CONF_EPOLL
+#elif NATIVE_VIRTUAL_TIME
+/* The virtual time main loop never sleeps on a timer */
+#define SELECT_EPOLL 0
+#elif defined(__linux__)
+#define SELECT_EPOLL 1
+#else
+#define SELECT_EPOLL 0
+#endif
+
+#if NATIVE_MULTI_NODE && !SELECT_EPOLL
+#error "NATIVE_CONF_MULTI_NODE requires SELECT_CONF_EPOLL"
+#endif
+
+#if NATIVE_MULTI_NODE && NATIVE_VIRTUAL_TIME
+#error "NATIVE_CONF_VIRTUAL_TIME cannot be used with NATIVE_CONF_MULTI_NODE"
+#endif
 /** @} */
 /*---------------------------------------------------------------------------*/
 
@@ -164,9 +214,15 @@ static void
 stdin_handle_fd(fd_set *rset, fd_set *wset)
 {
   char c;
+  ssize_t len;
   if(FD_ISSET(STDIN_FILENO, rset)) {
-    if(read(STDIN_FILENO, &c, 1) > 0) {
+    len = read(STDIN_FILENO, &c, 1);
+    if(len > 0) {
       serial_line_input_byte(c);
+    } else if(len == 0) {
+      /* End of file: there is nothing more to read, stop monitoring
+         stdin so that the main loop does not spin on it */
+      select_set_callback(STDIN_FILENO, NULL);
     }
   }
 }
@@ -275,12 +331,234 @@ platform_init_stage_three()
   setvbuf(stdout, (char *)NULL, _IONBF, 0);
 }
 /*---------------------------------------------------------------------------*/
-void
-platform_main_loop()
+#if SELECT_EPOLL
+static int epoll_fd = -1;
+static int timer_fd = -1;
+/* The epoll events registered for each callback file descriptor */
+static uint32_t fd_events[SELECT_MAX];
+/* Descriptors that epoll cannot monitor, such as regular files. As
+   with select(), they are always considered ready. */
+static uint32_t fd_unpollable[SELECT_MAX];
+/* The highest descriptor registered with epoll or marked unpollable */
+static int epoll_max;
+static clock_time_t timer_armed;
+/*---------------------------------------------------------------------------*/
+static int
+epoll_init(void)
+{
+  struct epoll_event ev;
+
+  epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if(epoll_fd < 0) {
+    perror("epoll_create1");
+    return 0;
+  }
+
+  timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+  if(timer_fd < 0) {
+    perror("timerfd_create");
+    close(epoll_fd);
+    return 0;
+  }
+
+  memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLIN;
+  ev.data.fd = timer_fd;
+  if(epoll_ctl(epoll_fd, EPOLL_CTL_ADD, timer_fd, &ev) < 0) {
+    perror("epoll_ctl");
+    close(timer_fd);
+    close(epoll_fd);
+    return 0;
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Update the epoll registrations from the descriptors that the
+ * callbacks put in the read and write sets. Returns non-zero if an
+ * unpollable descriptor is part of the sets.
+ */
+static int
+epoll_update(fd_set *fdr, fd_set *fdw)
+{
+  struct epoll_event ev;
+  uint32_t events;
+  int unpollable;
+  int max;
+  int op;
+  int i;
+
+  unpollable = 0;
+  max = epoll_max > select_max ? epoll_max : select_max;
+  epoll_max = 0;
+  for(i = 0; i <= max; i++) {
+    events = (FD_ISSET(i, fdr) ? EPOLLIN : 0) | (FD_ISSET(i, fdw) ? EPOLLOUT : 0);
+
+    if(fd_unpollable[i] != 0) {
+      fd_unpollable[i] = events;
+      unpollable |= events != 0;
+      epoll_max = i;
+      continue;
+    }
+    if(events == fd_events[i]) {
+      if(events != 0) {
+        epoll_max = i;
+      }
+      continue;
+    }
+
+    if(fd_events[i] == 0) {
+      op = EPOLL_CTL_ADD;
+    } else if(events == 0) {
+      op = EPOLL_CTL_DEL;
+    } else {
+      op = EPOLL_CTL_MOD;
+    }
+
+    memset(&ev, 0, sizeof(ev));
+    ev.events = events;
+    ev.data.fd = i;
+    if(epoll_ctl(epoll_fd, op, i, &ev) < 0 && op == EPOLL_CTL_ADD) {
+      if(errno == EPERM) {
+        fd_unpollable[i] = events;
+        unpollable = 1;
+      } else {
+        perror("epoll_ctl");
+      }
+      events = 0;
+    }
+    fd_events[i] = events;
+    if(events != 0 || fd_unpollable[i] != 0) {
+      epoll_max = i;
+    }
+  }
+  return unpollable;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Arm the timerfd for the next etimer expiration. The native clock
+ * counts CLOCK_MONOTONIC time, so the expiration time can be used as
+ * an absolute timerfd deadline.
+ */
+static void
+epoll_arm_timer(void)
+{
+  struct itimerspec its;
+  clock_time_t next;
+
+  next = etimer_pending() ? etimer_next_expiration_time() : 0;
+  if(next == timer_armed) {
+    return;
+  }
+
+  memset(&its, 0, sizeof(its));
+  if(next != 0) {
+    its.it_value.tv_sec = next / CLOCK_SECOND;
+    its.it_value.tv_nsec = (next % CLOCK_SECOND) * (1000000000 / CLOCK_SECOND);
+  }
+  if(timerfd_settime(timer_fd, TFD_TIMER_ABSTIME, &its, NULL) < 0) {
+    perror("timerfd_settime");
+    return;
+  }
+  timer_armed = next;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Run the processes and wait for etimers and descriptors once. Blocks
+ * until something happens unless block is zero or there is more work
+ * to do right away. Returns non-zero if more work is pending.
+ */
+static int
+epoll_poll(int block)
+{
+  struct epoll_event events[SELECT_MAX + 1];
+  fd_set fdr;
+  fd_set fdw;
+  uint64_t expirations;
+  int unpollable;
+  int retval;
+  int n;
+  int i;
+
+  retval = process_run();
+
+  FD_ZERO(&fdr);
+  FD_ZERO(&fdw);
+  for(i = 0; i <= select_max; i++) {
+    if(select_callback[i] != NULL) {
+      select_callback[i]->set_fd(&fdr, &fdw);
+    }
+  }
+  unpollable = epoll_update(&fdr, &fdw);
+  epoll_arm_timer();
+
+  /* Catch events posted and polls requested since process_run()
+     returned, for instance by the descriptor callbacks above. Those
+     that come from a signal handler after this point are reported by
+     the rtimer eventfd. */
+  if(process_nevents() > 0) {
+    retval = 1;
+  }
+
+  n = epoll_wait(epoll_fd, events, SELECT_MAX + 1,
+                 block && !retval && !unpollable ? -1 : 0);
+  if(n < 0) {
+    if(errno != EINTR) {
+      perror("epoll_wait");
+    }
+    return retval;
+  }
+
+  FD_ZERO(&fdr);
+  FD_ZERO(&fdw);
+  for(i = 0; i < n; i++) {
+    if(events[i].data.fd == timer_fd) {
+      if(read(timer_fd, &expirations, sizeof(expirations)) > 0) {
+        timer_armed = 0;
+        etimer_request_poll();
+      }
+      continue;
+    }
+    if(events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+      FD_SET(events[i].data.fd, &fdr);
+    }
+    if(events[i].events & (EPOLLOUT | EPOLLERR)) {
+      FD_SET(events[i].data.fd, &fdw);
+    }
+  }
+  for(i = 0; i <= epoll_max; i++) {
+    if(fd_unpollable[i] & EPOLLIN) {
+      FD_SET(i, &fdr);
+    }
+    if(fd_unpollable[i] & EPOLLOUT) {
+      FD_SET(i, &fdw);
+    }
+  }
+
+  for(i = 0; i <= select_max; i++) {
+    if(select_callback[i] != NULL) {
+      select_callback[i]->handle_fd(&fdr, &fdw);
+    }
+  }
+
+  return retval || unpollable || n > 0;
+}
+/*---------------------------------------------------------------------------*/
+#if !NATIVE_MULTI_NODE
+static void
+epoll_main_loop(void)
+{
+  while(1) {
+    epoll_poll(1);
+  }
+}
+#endif /* !NATIVE_MULTI_NODE */
+#endif /* SELECT_EPOLL */
+/*---------------------------------------------------------------------------*/
+#if !NATIVE_MULTI_NODE && !NATIVE_VIRTUAL_TIME
+static void
+select_main_loop(void)
 {
-#if SELECT_STDIN
-  select_set_callback(STDIN_FILENO, &stdin_fd);
-#endif /* SELECT_STDIN */
   while(1) {
     fd_set fdr;
     fd_set fdw;
@@ -319,9 +597,132 @@ platform_main_loop()
 
     etimer_request_poll();
   }
+}
+#endif /* !NATIVE_MULTI_NODE && !NATIVE_VIRTUAL_TIME */
+/*---------------------------------------------------------------------------*/
+#if NATIVE_VIRTUAL_TIME
+/*
+ * The virtual time of the next etimer or rtimer deadline, or 0 if no
+ * timer is pending.
+ */
+static uint64_t
+next_deadline(void)
+{
+  uint64_t next = 0;
+  uint64_t rt_next;
+  rtimer_clock_t t;
+  int32_t diff;
+
+  if(etimer_pending()) {
+    next = (uint64_t)(clock_time_t)(etimer_next_expiration_time() -
+                                    NATIVE_VIRTUAL_CLOCK_OFFSET) *
+      (1000000000 / CLOCK_SECOND);
+  }
 
-  return;
+  if(rtimer_arch_next_expiration(&t)) {
+    diff = RTIMER_CLOCK_DIFF(t, RTIMER_NOW());
+    rt_next = virtual_clock_now() +
+      (uint64_t)(diff > 0 ? diff : 0) * (1000000000 / RTIMER_SECOND);
+    if(next == 0 || rt_next < next) {
+      next = rt_next;
+    }
+  }
+  return next;
+}
+/*---------------------------------------------------------------------------*/
+static void
+virtual_main_loop(void)
+{
+  while(1) {
+    fd_set fdr;
+    fd_set fdw;
+    int maxfd;
+    int i;
+    int retval;
+    uint64_t next;
+    struct timeval tv;
+
+    retval = process_run();
+    retval |= rtimer_arch_run_expired();
+    next = retval ? 0 : next_deadline();
+
+    FD_ZERO(&fdr);
+    FD_ZERO(&fdw);
+    maxfd = 0;
+    for(i = 0; i <= select_max; i++) {
+      if(select_callback[i] != NULL && select_callback[i]->set_fd(&fdr, &fdw)) {
+        maxfd = i;
+      }
+    }
+
+    /* Only wait for real time to pass when no timer is pending, as
+       nothing but I/O can happen then */
+    tv.tv_sec = 0;
+    tv.tv_usec = 0;
+    i = select(maxfd + 1, &fdr, &fdw, NULL,
+               retval || next != 0 ? &tv : NULL);
+    if(i < 0) {
+      if(errno != EINTR) {
+        perror("select");
+      }
+    } else if(i > 0) {
+      for(i = 0; i <= maxfd; i++) {
+        if(select_callback[i] != NULL) {
+          select_callback[i]->handle_fd(&fdr, &fdw);
+        }
+      }
+    } else if(next != 0) {
+      /* Idle: jump to the next deadline */
+      virtual_clock_advance(next);
+      etimer_request_poll();
+    }
+  }
+}
+#endif /* NATIVE_VIRTUAL_TIME */
+/*---------------------------------------------------------------------------*/
+void
+platform_main_loop()
+{
+#if SELECT_STDIN
+  select_set_callback(STDIN_FILENO, &stdin_fd);
+#endif /* SELECT_STDIN */
+
+#if NATIVE_MULTI_NODE
+  /* The host drives the node from here on, see native_node_run() */
+  epoll_init();
+#elif NATIVE_VIRTUAL_TIME
+  virtual_main_loop();
+#else /* NATIVE_MULTI_NODE */
+#if SELECT_EPOLL
+  if(epoll_init()) {
+    epoll_main_loop();
+  }
+#endif /* SELECT_EPOLL */
+
+  select_main_loop();
+#endif /* NATIVE_MULTI_NODE */
+}
+/*---------------------------------------------------------------------------*/
+#if NATIVE_MULTI_NODE
+void
+native_node_configure(uint16_t id)
+{
+  mac_addr[sizeof(mac_addr) - 2] = id >> 8;
+  mac_addr[sizeof(mac_addr) - 1] = id & 0xff;
+}
+/*---------------------------------------------------------------------------*/
+int
+native_node_fd(void)
+{
+  return epoll_fd;
+}
+/*---------------------------------------------------------------------------*/
+int
+native_node_run(void)
+{
+  return epoll_poll(0);
 }
+#endif /* NATIVE_MULTI_NODE */
 /*---------------------------------------------------------------------------*/
 void
 log_message(char *m1, char *m2)
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \addtogroup native_platform
+ * @{
+ *
+ * \file
+ *         Virtual clock of the native platform, enabled with
+ *         NATIVE_CONF_VIRTUAL_TIME. The clock and the rtimer count
+ *         virtual time, which only moves forward when the main loop has
+ *         nothing left to do and jumps to the next timer deadline, or
+ *         by one rtimer tick each time the rtimer is read, so that
+ *         busy-waits end.
+ */
+#ifndef VIRTUAL_CLOCK_H_
+#define VIRTUAL_CLOCK_H_
+
+#include "contiki.h"
+
+#include <stdint.h>
+
+/**
+ * \brief Get the virtual time
+ * \return The number of nanoseconds since the node started
+ */
+uint64_t virtual_clock_now(void);
+
+/**
+ * \brief Move the virtual clock forward
+ * \param ns The new time in nanoseconds. Earlier times are ignored.
+ */
+void virtual_clock_advance(uint64_t ns);
+
+#endif /* VIRTUAL_CLOCK_H_ */
+/** @} */
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Measures AES-128 and CCM* throughput on the native platform.
+ *         Build with DRIVER=bytewise, DRIVER=ttable or DRIVER=ni (the
+ *         default) to select the AES_128 driver.
+ */
+
+#include "contiki.h"
+#include "lib/aes-128.h"
+#include "lib/ccm-star.h"
+#include "lib/random.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+/*---------------------------------------------------------------------------*/
+#define TOTAL_BYTES   (16UL * 1024 * 1024)
+#define FRAMES        200000UL
+
+/* A secured IEEE 802.15.4 data frame: header, payload and 8-byte MIC */
+#define FRAME_HDR_LEN     21
+#define FRAME_PAYLOAD_LEN 96
+#define FRAME_MIC_LEN     8
+
+#define STRINGIFY(x)      #x
+#define DRIVER_NAME(x)    STRINGIFY(x)
+
+static uint8_t buffer[4096];
+/*---------------------------------------------------------------------------*/
+PROCESS(aes_throughput_process, "AES throughput");
+AUTOSTART_PROCESSES(&aes_throughput_process);
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+/* FIPS-197 appendix C.1 and RFC 3610 packet vector #1 */
+static int
+check_vectors(void)
+{
+  static const uint8_t fips_ct[] = {
+    0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+    0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+  };
+  static const uint8_t ccm_nonce[CCM_STAR_NONCE_LENGTH] = {
+    0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5
+  };
+  static const uint8_t ccm_ct[] = {
+    0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63, 0xd2,
+    0xf0, 0x66, 0xd0, 0xc2, 0xc0, 0xf9, 0x89, 0x80,
+    0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3, 0x84
+  };
+  static const uint8_t ccm_mic[] = {
+    0x17, 0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0
+  };
+  uint8_t key[AES_128_KEY_LENGTH];
+  uint8_t block[AES_128_BLOCK_SIZE];
+  uint8_t packet[31];
+  uint8_t mic[8];
+  uint8_t i;
+
+  for(i = 0; i < AES_128_KEY_LENGTH; i++) {
+    key[i] = i;
+    block[i] = i * 0x11;
+  }
+  AES_128.set_key(key);
+  AES_128.encrypt(block);
+  if(memcmp(block, fips_ct, sizeof(fips_ct))) {
+    return 0;
+  }
+
+  for(i = 0; i < AES_128_KEY_LENGTH; i++) {
+    key[i] = 0xc0 + i;
+  }
+  for(i = 0; i < sizeof(packet); i++) {
+    packet[i] = i;
+  }
+  CCM_STAR.set_key(key);
+  CCM_STAR.aead(ccm_nonce, packet + 8, 23, packet, 8, mic, 8, 1);
+  if(memcmp(packet + 8, ccm_ct, sizeof(ccm_ct))
+     || memcmp(mic, ccm_mic, sizeof(ccm_mic))) {
+    return 0;
+  }
+
+  /* decrypting must restore the plaintext and yield the same MIC */
+  CCM_STAR.aead(ccm_nonce, packet + 8, 23, packet, 8, mic, 8, 0);
+  for(i = 0; i < sizeof(packet); i++) {
+    if(packet[i] != i) {
+      return 0;
+    }
+  }
+  return memcmp(mic, ccm_mic, sizeof(ccm_mic)) == 0;
+}
+/*---------------------------------------------------------------------------*/
+/* Returns MB/s of encrypting single blocks through AES_128.encrypt() */
+static unsigned long
+run_encrypt(void)
+{
+  uint64_t start;
+  unsigned long i;
+
+  start = now_ns();
+  for(i = 0; i < TOTAL_BYTES / AES_128_BLOCK_SIZE; i++) {
+    AES_128.encrypt(buffer + (i & 0xff) * AES_128_BLOCK_SIZE);
+  }
+  return TOTAL_BYTES * 1000 / (now_ns() - start + 1);
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long
+run_ctr(void)
+{
+  uint8_t iv[AES_128_BLOCK_SIZE];
+  uint64_t start;
+  unsigned long i;
+
+  memset(iv, 0x5a, sizeof(iv));
+  iv[14] = iv[15] = 0;
+  start = now_ns();
+  for(i = 0; i < TOTAL_BYTES / sizeof(buffer); i++) {
+    aes_128_ctr(iv, buffer, sizeof(buffer));
+  }
+  return TOTAL_BYTES * 1000 / (now_ns() - start + 1);
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long
+run_cbc_mac(uint8_t *mac)
+{
+  uint64_t start;
+  unsigned long i;
+
+  memset(mac, 0, AES_128_BLOCK_SIZE);
+  start = now_ns();
+  for(i = 0; i < TOTAL_BYTES / sizeof(buffer); i++) {
+    aes_128_cbc_mac(mac, buffer, sizeof(buffer));
+  }
+  return TOTAL_BYTES * 1000 / (now_ns() - start + 1);
+}
+/*---------------------------------------------------------------------------*/
+/* Returns ns per frame of the set_key() + aead() sequence that CSMA and
+   TSCH run for every secured frame, cycling through `keys` keys. */
+static unsigned long
+run_frames(uint8_t keys, uint8_t *mic)
+{
+  uint8_t key[8][AES_128_KEY_LENGTH];
+  uint8_t nonce[CCM_STAR_NONCE_LENGTH];
+  uint64_t start;
+  unsigned long i;
+
+  memcpy(key, buffer + 1024, sizeof(key));
+  memset(nonce, 0, sizeof(nonce));
+  start = now_ns();
+  for(i = 0; i < FRAMES; i++) {
+    nonce[12] = i;
+    CCM_STAR.set_key(key[i % keys]);
+    CCM_STAR.aead(nonce, buffer + FRAME_HDR_LEN, FRAME_PAYLOAD_LEN,
+                  buffer, FRAME_HDR_LEN, mic, FRAME_MIC_LEN, 1);
+  }
+  return (now_ns() - start) / FRAMES;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(aes_throughput_process, ev, data)
+{
+  uint8_t mic[AES_128_BLOCK_SIZE];
+  unsigned i;
+
+  PROCESS_BEGIN();
+
+  if(!check_vectors()) {
+    printf("AES-128 or CCM* test vectors do not match\n");
+    exit(1);
+  }
+
+  for(i = 0; i < sizeof(buffer); i++) {
+    buffer[i] = random_rand();
+  }
+
+  printf("AES_128 driver: %s, key cache: %u\n",
+         DRIVER_NAME(AES_128), AES_128_KEY_CACHE_SIZE);
+  printf("encrypt (MB/s):  %lu\n", run_encrypt());
+  printf("ctr (MB/s):      %lu\n", run_ctr());
+  printf("cbc-mac (MB/s):  %lu\n", run_cbc_mac(mic));
+  printf("ccm* frame, 1 key (ns):  %lu\n", run_frames(1, mic));
+  printf("ccm* frame, 2 keys (ns): %lu\n", run_frames(2, mic));
+  printf("ccm* frame, 8 keys (ns): %lu\n", run_frames(8, mic));
+  printf("mic: %02x%02x%02x%02x\n", mic[0], mic[1], mic[2], mic[3]);
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
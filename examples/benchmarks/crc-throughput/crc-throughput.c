@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *         Measures the throughput of crc16_data() and crc32c_data() on
+ *         the native platform. Build with IMPL=bitwise, IMPL=table or
+ *         IMPL=slice8 (the default) to select the implementation.
+ */
+
+#include "contiki.h"
+#include "lib/crc16.h"
+#include "lib/crc32c.h"
+#include "lib/random.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+/*---------------------------------------------------------------------------*/
+#define TOTAL_BYTES   (32UL * 1024 * 1024)
+
+static const uint16_t sizes[] = { 16, 127, 1024, 4096 };
+
+static unsigned char buffer[4096];
+/*---------------------------------------------------------------------------*/
+PROCESS(crc_throughput_process, "CRC throughput");
+AUTOSTART_PROCESSES(&crc_throughput_process);
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+/* Returns the throughput in MB/s, with the checksum in *result so that
+   the computation is not optimised away. */
+static unsigned long
+run_crc16(uint16_t size, unsigned long *result)
+{
+  uint64_t start;
+  unsigned long i;
+  unsigned short crc;
+
+  crc = 0;
+  start = now_ns();
+  for(i = 0; i < TOTAL_BYTES / size; i++) {
+    crc = crc16_data(buffer, size, crc);
+  }
+  *result = crc;
+  return (TOTAL_BYTES / size) * size * 1000 / (now_ns() - start + 1);
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long
+run_crc32c(uint16_t size, unsigned long *result)
+{
+  uint64_t start;
+  unsigned long i;
+  uint32_t crc;
+
+  crc = 0;
+  start = now_ns();
+  for(i = 0; i < TOTAL_BYTES / size; i++) {
+    crc = crc32c_data(buffer, size, crc);
+  }
+  *result = crc;
+  return (TOTAL_BYTES / size) * size * 1000 / (now_ns() - start + 1);
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(crc_throughput_process, ev, data)
+{
+  unsigned long crc16, crc32c;
+  unsigned i;
+
+  PROCESS_BEGIN();
+
+  for(i = 0; i < sizeof(buffer); i++) {
+    buffer[i] = random_rand();
+  }
+
+  /* The check values of both CRCs for the ASCII string "123456789" */
+  if(crc16_data((const unsigned char *)"123456789", 9, 0) != 0x2189 ||
+     crc32c_data((const unsigned char *)"123456789", 9, 0) != 0xe3069283) {
+    printf("CRC check values do not match\n");
+    exit(1);
+  }
+
+  printf("CRC implementation: %s\n",
+         CRC16_IMPL == CRC16_IMPL_BITWISE ? "bitwise" :
+         CRC16_IMPL == CRC16_IMPL_TABLE ? "table" : "slice-by-8");
+  printf(" bytes  crc16(MB/s)  crc32c(MB/s)\n");
+  for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    printf("%6u %12lu", sizes[i], run_crc16(sizes[i], &crc16));
+    printf(" %13lu\n", run_crc32c(sizes[i], &crc32c));
+  }
+  printf("checksums: %04lx %08lx\n", crc16, crc32c);
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *         Micro-benchmark of the etimer backends on the native platform.
+ *         Build once with BACKEND=list and once with BACKEND=wheel and
+ *         compare the output.
+ */
+
+#include "contiki.h"
+#include "lib/random.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+/*---------------------------------------------------------------------------*/
+#define MAX_TIMERS      1000
+#define DISPATCH_TIME   (2 * CLOCK_SECOND)
+#define MAX_PERIOD      CLOCK_SECOND
+
+static const uint16_t sizes[] = { 10, 100, 1000 };
+
+static struct etimer timers[MAX_TIMERS];
+static struct etimer done;
+static unsigned size_index;
+static unsigned num_timers;
+static unsigned long expiries;
+static unsigned long lateness;
+static uint64_t cpu_start;
+static clock_time_t dispatch_start;
+/*---------------------------------------------------------------------------*/
+PROCESS(etimer_bench_process, "etimer benchmark");
+AUTOSTART_PROCESSES(&etimer_bench_process);
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(clockid_t id)
+{
+  struct timespec ts;
+
+  clock_gettime(id, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+static clock_time_t
+random_interval(clock_time_t max)
+{
+  return 1 + random_rand() % max;
+}
+/*---------------------------------------------------------------------------*/
+static void
+run_operations(void)
+{
+  uint64_t start;
+  unsigned long set_ns, rearm_ns, stop_ns, next_ns;
+  unsigned i;
+
+  /* Arm all timers */
+  start = now_ns(CLOCK_MONOTONIC);
+  for(i = 0; i < num_timers; i++) {
+    etimer_set(&timers[i], random_interval(10 * CLOCK_SECOND));
+  }
+  set_ns = (now_ns(CLOCK_MONOTONIC) - start) / num_timers;
+
+  /* Re-arm timers that are already pending */
+  start = now_ns(CLOCK_MONOTONIC);
+  for(i = 0; i < num_timers; i++) {
+    etimer_set(&timers[random_rand() % num_timers],
+               random_interval(10 * CLOCK_SECOND));
+  }
+  rearm_ns = (now_ns(CLOCK_MONOTONIC) - start) / num_timers;
+
+  /* Stop every timer and ask for the next expiration time, as a
+     tickless platform does before going to sleep */
+  start = now_ns(CLOCK_MONOTONIC);
+  for(i = 0; i < num_timers; i++) {
+    etimer_stop(&timers[i]);
+  }
+  stop_ns = (now_ns(CLOCK_MONOTONIC) - start) / num_timers;
+
+  for(i = 0; i < num_timers; i++) {
+    etimer_set(&timers[i], random_interval(10 * CLOCK_SECOND));
+  }
+  start = now_ns(CLOCK_MONOTONIC);
+  for(i = 0; i < num_timers; i++) {
+    etimer_stop(&timers[i]);
+    etimer_next_expiration_time();
+  }
+  next_ns = (now_ns(CLOCK_MONOTONIC) - start) / num_timers;
+
+  printf("%6u %10lu %10lu %10lu %12lu", num_timers,
+         set_ns, rearm_ns, stop_ns, next_ns);
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(etimer_bench_process, ev, data)
+{
+  unsigned i;
+
+  PROCESS_BEGIN();
+
+  printf("etimer backend: %s\n",
+         ETIMER_TIMING_WHEEL ? "timing wheel" : "list");
+  printf("timers   set(ns)  rearm(ns)   stop(ns) stop+next(ns)"
+         "   expiries  cpu/exp(ns)  late(ticks)\n");
+
+  for(size_index = 0; size_index < sizeof(sizes) / sizeof(sizes[0]);
+      size_index++) {
+    num_timers = sizes[size_index];
+
+    run_operations();
+
+    /* Periodic timers that are re-armed on every expiry */
+    for(i = 0; i < num_timers; i++) {
+      etimer_set(&timers[i], random_interval(MAX_PERIOD));
+    }
+    etimer_set(&done, DISPATCH_TIME);
+    expiries = 0;
+    lateness = 0;
+    cpu_start = now_ns(CLOCK_PROCESS_CPUTIME_ID);
+    dispatch_start = clock_time();
+
+    while(1) {
+      PROCESS_WAIT_EVENT_UNTIL(ev == PROCESS_EVENT_TIMER);
+      if(!etimer_expired(data)) {
+        /* Left in the event queue by the previous round */
+        continue;
+      }
+      /* The deadline is also checked here, as a backend that cannot
+         keep up may starve the done timer */
+      if(data == &done || clock_time() - dispatch_start >= DISPATCH_TIME) {
+        break;
+      }
+      expiries++;
+      lateness += clock_time() -
+        etimer_expiration_time((struct etimer *)data);
+      etimer_reset(data);
+    }
+
+    for(i = 0; i < num_timers; i++) {
+      etimer_stop(&timers[i]);
+    }
+    etimer_stop(&done);
+
+    printf(" %10lu %12lu %12.2f\n", expiries,
+           expiries ? (unsigned long)((now_ns(CLOCK_PROCESS_CPUTIME_ID) -
+                                       cpu_start) / expiries) : 0,
+           expiries ? (double)lateness / expiries : 0.0);
+  }
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
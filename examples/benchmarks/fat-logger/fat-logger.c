@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Logs fixed-size records to several files of a FAT32 volume the
+ *         way a data logger does, then reads them back, and counts the
+ *         disk commands each phase needs.
+ */
+
+#include "contiki.h"
+#include "ff.h"
+#include "disk-image.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+/*---------------------------------------------------------------------------*/
+#define FILES           4
+#define RECORDS         8000    /* per file */
+#define SYNC_EVERY      16      /* records between f_sync() of a file */
+#define SEEKS           2000
+#define CLUSTER_SIZE    4096
+
+#ifdef FATFS_CONF_READ_AHEAD
+#define READ_AHEAD      FATFS_CONF_READ_AHEAD
+#else
+#define READ_AHEAD      0
+#endif
+
+struct record {
+  uint16_t file;
+  uint16_t check;
+  uint32_t seq;
+  uint8_t payload[24];
+};
+
+static FATFS fs;
+static FIL files[FILES];
+static BYTE work[4 * _MAX_SS];
+static DWORD linkmap[256];
+/*---------------------------------------------------------------------------*/
+PROCESS(fat_logger_process, "FAT logger");
+AUTOSTART_PROCESSES(&fat_logger_process);
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+static void
+report(const char *phase, uint64_t start)
+{
+  struct disk_image_stats stats;
+
+  disk_image_stats(&stats);
+  printf("%-8s %6lu reads (%6lu sectors) %6lu writes (%6lu sectors) %5lu us\n",
+         phase, (unsigned long)stats.reads,
+         (unsigned long)stats.read_sectors, (unsigned long)stats.writes,
+         (unsigned long)stats.written_sectors,
+         (unsigned long)((now_ns() - start) / 1000));
+}
+/*---------------------------------------------------------------------------*/
+static void
+fill(struct record *r, uint16_t file, uint32_t seq)
+{
+  unsigned i;
+
+  r->file = file;
+  r->seq = seq;
+  for(i = 0; i < sizeof(r->payload); i++) {
+    r->payload[i] = (uint8_t)(seq * 7 + file + i);
+  }
+  r->check = (uint16_t)(seq ^ (seq >> 16) ^ file);
+}
+/*---------------------------------------------------------------------------*/
+static void
+fail(const char *what, FRESULT res)
+{
+  printf("%s failed (%d)\n", what, res);
+  remove(DISK_IMAGE_FILE);
+  exit(1);
+}
+/*---------------------------------------------------------------------------*/
+static void
+name(char *buf, int file)
+{
+  sprintf(buf, "LOG%d.BIN", file);
+}
+/*---------------------------------------------------------------------------*/
+static int
+read_record(FIL *fp, int file, uint32_t seq)
+{
+  struct record r;
+  struct record expected;
+  UINT n;
+
+  if(f_read(fp, &r, sizeof(r), &n) != FR_OK || n != sizeof(r)) {
+    return 0;
+  }
+  fill(&expected, file, seq);
+  return memcmp(&r, &expected, sizeof(r)) == 0;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(fat_logger_process, ev, data)
+{
+  static struct record r;
+  char path[16];
+  uint64_t start;
+  uint32_t seq;
+  uint32_t rnd;
+  FRESULT res;
+  UINT n;
+  int i;
+
+  PROCESS_BEGIN();
+
+  printf("%d files, %d records of %u bytes each, f_sync() every %d records\n",
+         FILES, RECORDS, (unsigned)sizeof(struct record), SYNC_EVERY);
+  printf("%d sector windows, %d sectors of read-ahead\n",
+         _FS_WINDOWS, READ_AHEAD);
+
+  remove(DISK_IMAGE_FILE);
+  res = f_mkfs("", FM_FAT32, CLUSTER_SIZE, work, sizeof(work));
+  if(res != FR_OK) {
+    fail("f_mkfs", res);
+  }
+  res = f_mount(&fs, "", 1);
+  if(res != FR_OK) {
+    fail("f_mount", res);
+  }
+  disk_image_stats(&(struct disk_image_stats){ 0 });
+
+  /* Append records to all files in turn, syncing each regularly */
+  start = now_ns();
+  for(i = 0; i < FILES; i++) {
+    name(path, i);
+    res = f_open(&files[i], path, FA_WRITE | FA_CREATE_ALWAYS);
+    if(res != FR_OK) {
+      fail("f_open", res);
+    }
+  }
+  for(seq = 0; seq < RECORDS; seq++) {
+    for(i = 0; i < FILES; i++) {
+      fill(&r, i, seq);
+      res = f_write(&files[i], &r, sizeof(r), &n);
+      if(res != FR_OK || n != sizeof(r)) {
+        fail("f_write", res);
+      }
+      if(seq % SYNC_EVERY == SYNC_EVERY - 1) {
+        res = f_sync(&files[i]);
+        if(res != FR_OK) {
+          fail("f_sync", res);
+        }
+      }
+    }
+  }
+  for(i = 0; i < FILES; i++) {
+    f_close(&files[i]);
+  }
+  report("log", start);
+
+  /* Remount, so that everything below comes from the disk */
+  f_mount(NULL, "", 0);
+  res = f_mount(&fs, "", 1);
+  if(res != FR_OK) {
+    fail("f_mount", res);
+  }
+  disk_image_stats(&(struct disk_image_stats){ 0 });
+
+  /* Reopen for appending: follows each cluster chain to its end */
+  start = now_ns();
+  for(i = 0; i < FILES; i++) {
+    name(path, i);
+    res = f_open(&files[i], path, FA_WRITE | FA_OPEN_APPEND);
+    if(res != FR_OK || f_tell(&files[i]) != (FSIZE_t)RECORDS * sizeof(r)) {
+      fail("append", res);
+    }
+    f_close(&files[i]);
+  }
+  report("append", start);
+
+  /* Read everything back, one record at a time */
+  start = now_ns();
+  for(i = 0; i < FILES; i++) {
+    name(path, i);
+    res = f_open(&files[i], path, FA_READ);
+    if(res != FR_OK) {
+      fail("f_open", res);
+    }
+    for(seq = 0; seq < RECORDS; seq++) {
+      if(!read_record(&files[i], i, seq)) {
+        fail("read back", FR_OK);
+      }
+    }
+  }
+  report("read", start);
+
+  /* Random records, following the chain and with a fast seek table */
+  rnd = 1;
+  start = now_ns();
+  for(n = 0; n < SEEKS; n++) {
+    rnd = rnd * 1103515245 + 12345;
+    seq = (rnd >> 8) % RECORDS;
+    if(f_lseek(&files[0], seq * sizeof(r)) != FR_OK ||
+       !read_record(&files[0], 0, seq)) {
+      fail("seek", FR_OK);
+    }
+  }
+  report("seek", start);
+
+  linkmap[0] = sizeof(linkmap) / sizeof(linkmap[0]);
+  files[0].cltbl = linkmap;
+  res = f_lseek(&files[0], CREATE_LINKMAP);
+  if(res != FR_OK) {
+    fail("CREATE_LINKMAP", res);
+  }
+  rnd = 1;
+  start = now_ns();
+  for(n = 0; n < SEEKS; n++) {
+    rnd = rnd * 1103515245 + 12345;
+    seq = (rnd >> 8) % RECORDS;
+    if(f_lseek(&files[0], seq * sizeof(r)) != FR_OK ||
+       !read_record(&files[0], 0, seq)) {
+      fail("fast seek", FR_OK);
+    }
+  }
+  report("fastseek", start);
+
+  for(i = 0; i < FILES; i++) {
+    f_close(&files[i]);
+  }
+  f_mount(NULL, "", 0);
+  remove(DISK_IMAGE_FILE);
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
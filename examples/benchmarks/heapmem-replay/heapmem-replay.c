@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *         Replays a heapmem allocation trace and reports the allocation
+ *         cost, the failed allocations, and the fragmentation of the
+ *         heap. Build with ALLOCATOR=first-fit or ALLOCATOR=segregated.
+ *
+ *         With CAPTURE=1, the benchmark instead runs a synthetic CoAP
+ *         workload with heapmem tracing enabled, which is how the
+ *         bundled trace was recorded.
+ */
+
+#include "contiki.h"
+#include "lib/heapmem.h"
+#include "lib/random.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+/*---------------------------------------------------------------------------*/
+PROCESS(heapmem_replay_process, "heapmem replay");
+AUTOSTART_PROCESSES(&heapmem_replay_process);
+/*---------------------------------------------------------------------------*/
+#if HEAPMEM_DEBUG
+#define NUM_OBJECTS   48
+#define STEPS         1000
+
+static struct {
+  void *ptr;
+  uint16_t size;
+  uint16_t expires;
+  uint8_t grow;
+} objects[NUM_OBJECTS];
+/*---------------------------------------------------------------------------*/
+static void
+spawn(uint16_t step, uint16_t size, uint16_t lifetime, uint8_t grow)
+{
+  unsigned i;
+
+  for(i = 0; i < NUM_OBJECTS; i++) {
+    if(objects[i].ptr == NULL) {
+      objects[i].ptr = heapmem_alloc(size);
+      objects[i].size = size;
+      objects[i].expires = step + lifetime;
+      objects[i].grow = grow;
+      return;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Each step, one of the following is started: a CoAP exchange with a
+ * short-lived message buffer, a block-wise transfer with a large
+ * buffer, an observe relation that lives for a long time, or an LwM2M
+ * response whose payload buffer is grown with heapmem_realloc() while
+ * the resources are encoded.
+ */
+static void
+run_workload(void)
+{
+  uint16_t step;
+  unsigned i;
+  void *ptr;
+
+  for(step = 0; step < STEPS; step++) {
+    for(i = 0; i < NUM_OBJECTS; i++) {
+      if(objects[i].ptr == NULL) {
+        continue;
+      }
+      if(objects[i].grow > 0) {
+        objects[i].size += 32 + random_rand() % 96;
+        ptr = heapmem_realloc(objects[i].ptr, objects[i].size);
+        if(ptr != NULL) {
+          objects[i].ptr = ptr;
+        }
+        objects[i].grow--;
+      } else if(objects[i].expires == step) {
+        heapmem_free(objects[i].ptr);
+        objects[i].ptr = NULL;
+      }
+    }
+
+    switch(random_rand() % 8) {
+    case 0: case 1: case 2: case 3:
+      spawn(step, 24 + random_rand() % 104, 1 + random_rand() % 4, 0);
+      break;
+    case 4:
+      spawn(step, 512 + random_rand() % 512, 2 + random_rand() % 8, 0);
+      break;
+    case 5:
+      spawn(step, 40 + random_rand() % 16, 50 + random_rand() % 400, 0);
+      break;
+    case 6:
+      spawn(step, 64, 6 + random_rand() % 4, 1 + random_rand() % 4);
+      break;
+    default:
+      break;
+    }
+  }
+
+  for(i = 0; i < NUM_OBJECTS; i++) {
+    heapmem_free(objects[i].ptr);
+  }
+}
+#else /* HEAPMEM_DEBUG */
+/*---------------------------------------------------------------------------*/
+/* One operation of a trace, as generated by trace2c.py. Each pointer
+   that the traced application used is mapped to a slot. */
+struct heapmem_trace_op {
+  char op;
+  uint16_t slot;
+  uint16_t size;
+};
+
+#include "heapmem-trace.h"
+
+#define TRACE_LENGTH  (sizeof(heapmem_trace) / sizeof(heapmem_trace[0]))
+#define ROUNDS        2000
+
+static void *slots[HEAPMEM_TRACE_SLOTS];
+static unsigned long failures;
+/*---------------------------------------------------------------------------*/
+static void
+replay_op(const struct heapmem_trace_op *op)
+{
+  void *ptr;
+
+  switch(op->op) {
+  case 'a':
+    slots[op->slot] = heapmem_alloc(op->size);
+    if(slots[op->slot] == NULL) {
+      failures++;
+    }
+    break;
+  case 'r':
+    ptr = heapmem_realloc(slots[op->slot], op->size);
+    if(ptr != NULL || op->size == 0) {
+      slots[op->slot] = ptr;
+    } else {
+      failures++;
+    }
+    break;
+  case 'f':
+    heapmem_free(slots[op->slot]);
+    slots[op->slot] = NULL;
+    break;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+release_slots(void)
+{
+  unsigned i;
+
+  for(i = 0; i < HEAPMEM_TRACE_SLOTS; i++) {
+    heapmem_free(slots[i]);
+    slots[i] = NULL;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+static void
+replay(void)
+{
+  heapmem_stats_t stats, peak;
+  unsigned long frag_sum;
+  unsigned frag_max;
+  uint64_t start;
+  unsigned i, j;
+
+  /* One pass with the heap statistics sampled after every operation */
+  memset(&peak, 0, sizeof(peak));
+  frag_sum = 0;
+  frag_max = 0;
+  for(i = 0; i < TRACE_LENGTH; i++) {
+    replay_op(&heapmem_trace[i]);
+    heapmem_stats(&stats);
+    frag_sum += stats.fragmentation;
+    if(stats.fragmentation > frag_max) {
+      frag_max = stats.fragmentation;
+    }
+    if(stats.footprint > peak.footprint) {
+      peak = stats;
+    }
+  }
+  release_slots();
+
+  printf("operations       %lu\n", (unsigned long)TRACE_LENGTH);
+  printf("failed           %lu\n", failures);
+  printf("peak footprint   %lu of %lu bytes\n",
+         (unsigned long)peak.footprint,
+         (unsigned long)HEAPMEM_CONF_ARENA_SIZE);
+  printf("fragmentation    %lu%% average, %u%% max\n",
+         frag_sum / TRACE_LENGTH, frag_max);
+  printf("chunks at peak   class: allocated/free\n");
+  for(i = 0; i < HEAPMEM_SIZE_CLASSES - 1; i++) {
+    printf("  < %5lu        %u/%u\n",
+           (unsigned long)HEAPMEM_MIN_CLASS_SIZE << i,
+           peak.classes[i].allocated, peak.classes[i].free);
+  }
+  printf("  >= %4lu        %u/%u\n",
+         (unsigned long)HEAPMEM_MIN_CLASS_SIZE << (i - 1),
+         peak.classes[i].allocated, peak.classes[i].free);
+
+  start = now_ns();
+  for(j = 0; j < ROUNDS; j++) {
+    for(i = 0; i < TRACE_LENGTH; i++) {
+      replay_op(&heapmem_trace[i]);
+    }
+    release_slots();
+  }
+  printf("time per op      %lu ns\n",
+         (unsigned long)((now_ns() - start) / ROUNDS / TRACE_LENGTH));
+}
+#endif /* HEAPMEM_DEBUG */
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(heapmem_replay_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+#if HEAPMEM_DEBUG
+  run_workload();
+#else
+#ifdef HEAPMEM_CONF_SEGREGATED
+  printf("heapmem allocator: segregated fit\n");
+#else
+  printf("heapmem allocator: first fit\n");
+#endif
+  replay();
+#endif
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
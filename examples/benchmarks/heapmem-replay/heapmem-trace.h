@@ -0,0 +1,341 @@
+/* Generated by trace2c.py -- do not edit. */
+#define HEAPMEM_TRACE_SLOTS 43
+static const struct heapmem_trace_op heapmem_trace[] = {
+  { 'a', 0, 64 }, { 'r', 0, 145 }, { 'r', 0, 219 }, { 'a', 1, 720 }, { 'a', 2, 60 }, { 'a', 3, 80 },
+  { 'f', 1, 0 }, { 'a', 1, 596 }, { 'a', 4, 104 }, { 'f', 2, 0 }, { 'f', 3, 0 }, { 'a', 3, 52 },
+  { 'f', 0, 0 }, { 'f', 1, 0 }, { 'a', 1, 64 }, { 'r', 1, 191 }, { 'f', 4, 0 }, { 'a', 4, 112 },
+  { 'r', 1, 273 }, { 'a', 0, 44 }, { 'r', 1, 393 }, { 'a', 2, 40 }, { 'r', 1, 454 }, { 'f', 4, 0 },
+  { 'a', 4, 48 }, { 'a', 5, 84 }, { 'f', 2, 0 }, { 'a', 2, 128 }, { 'a', 6, 64 }, { 'f', 5, 0 },
+  { 'r', 6, 180 }, { 'a', 5, 92 }, { 'f', 1, 0 }, { 'f', 2, 0 }, { 'r', 6, 264 }, { 'a', 2, 112 },
+  { 'r', 6, 324 }, { 'f', 2, 0 }, { 'f', 5, 0 }, { 'r', 6, 404 }, { 'a', 5, 68 }, { 'a', 2, 52 },
+  { 'f', 6, 0 }, { 'f', 5, 0 }, { 'f', 2, 0 }, { 'a', 2, 64 }, { 'r', 2, 151 }, { 'a', 5, 68 },
+  { 'r', 2, 269 }, { 'f', 5, 0 }, { 'a', 5, 68 }, { 'f', 5, 0 }, { 'a', 5, 572 }, { 'a', 6, 112 },
+  { 'f', 5, 0 }, { 'a', 5, 1004 }, { 'a', 1, 84 }, { 'f', 2, 0 }, { 'f', 6, 0 }, { 'a', 6, 112 },
+  { 'a', 2, 124 }, { 'a', 7, 108 }, { 'f', 6, 0 }, { 'f', 1, 0 }, { 'a', 1, 56 }, { 'f', 5, 0 },
+  { 'a', 5, 52 }, { 'f', 1, 0 }, { 'f', 2, 0 }, { 'f', 7, 0 }, { 'a', 7, 984 }, { 'a', 2, 64 },
+  { 'r', 2, 185 }, { 'a', 1, 680 }, { 'r', 2, 274 }, { 'a', 6, 52 }, { 'a', 8, 48 }, { 'f', 7, 0 },
+  { 'f', 1, 0 }, { 'f', 2, 0 }, { 'a', 2, 84 }, { 'f', 8, 0 }, { 'a', 8, 124 }, { 'f', 2, 0 },
+  { 'a', 2, 88 }, { 'f', 8, 0 }, { 'a', 8, 100 }, { 'a', 1, 44 }, { 'a', 7, 64 }, { 'f', 2, 0 },
+  { 'r', 7, 187 }, { 'a', 2, 788 }, { 'f', 8, 0 }, { 'a', 8, 120 }, { 'a', 9, 64 }, { 'r', 9, 131 },
+  { 'a', 10, 108 }, { 'f', 8, 0 }, { 'r', 9, 199 }, { 'f', 10, 0 }, { 'a', 10, 124 }, { 'f', 7, 0 },
+  { 'r', 9, 291 }, { 'a', 7, 108 }, { 'f', 7, 0 }, { 'r', 9, 405 }, { 'a', 7, 48 }, { 'f', 2, 0 },
+  { 'f', 10, 0 }, { 'f', 7, 0 }, { 'a', 7, 88 }, { 'a', 10, 72 }, { 'f', 10, 0 }, { 'f', 9, 0 },
+  { 'a', 9, 52 }, { 'f', 7, 0 }, { 'a', 7, 68 }, { 'a', 10, 80 }, { 'f', 7, 0 }, { 'a', 7, 92 },
+  { 'f', 10, 0 }, { 'a', 10, 804 }, { 'f', 7, 0 }, { 'a', 7, 72 }, { 'a', 2, 788 }, { 'f', 7, 0 },
+  { 'a', 7, 56 }, { 'a', 8, 28 }, { 'f', 8, 0 }, { 'a', 8, 68 }, { 'f', 8, 0 }, { 'a', 8, 44 },
+  { 'f', 2, 0 }, { 'a', 2, 848 }, { 'f', 10, 0 }, { 'a', 10, 76 }, { 'a', 11, 48 }, { 'a', 12, 84 },
+  { 'a', 13, 28 }, { 'f', 10, 0 }, { 'a', 10, 64 }, { 'r', 10, 147 }, { 'f', 13, 0 }, { 'a', 13, 60 },
+  { 'f', 12, 0 }, { 'f', 13, 0 }, { 'a', 13, 60 }, { 'f', 2, 0 }, { 'a', 2, 84 }, { 'a', 12, 40 },
+  { 'f', 13, 0 }, { 'f', 12, 0 }, { 'f', 0, 0 }, { 'a', 0, 60 }, { 'f', 10, 0 }, { 'f', 2, 0 },
+  { 'a', 2, 56 }, { 'f', 0, 0 }, { 'a', 0, 64 }, { 'f', 0, 0 }, { 'a', 0, 908 }, { 'a', 10, 72 },
+  { 'f', 10, 0 }, { 'a', 10, 60 }, { 'a', 12, 48 }, { 'f', 0, 0 }, { 'a', 0, 116 }, { 'f', 0, 0 },
+  { 'f', 10, 0 }, { 'a', 10, 56 }, { 'a', 0, 560 }, { 'a', 13, 84 }, { 'a', 14, 44 }, { 'f', 10, 0 },
+  { 'f', 13, 0 }, { 'a', 13, 128 }, { 'a', 10, 40 }, { 'f', 10, 0 }, { 'a', 10, 44 }, { 'a', 15, 64 },
+  { 'f', 13, 0 }, { 'r', 15, 146 }, { 'a', 13, 588 }, { 'r', 15, 246 }, { 'a', 16, 80 }, { 'f', 0, 0 },
+  { 'r', 15, 281 }, { 'a', 0, 52 }, { 'r', 15, 331 }, { 'f', 16, 0 }, { 'a', 16, 1004 }, { 'a', 17, 96 },
+  { 'f', 13, 0 }, { 'a', 13, 52 }, { 'f', 15, 0 }, { 'f', 17, 0 }, { 'a', 17, 64 }, { 'r', 17, 140 },
+  { 'a', 15, 92 }, { 'f', 13, 0 }, { 'r', 17, 195 }, { 'a', 13, 116 }, { 'f', 13, 0 }, { 'f', 16, 0 },
+  { 'a', 16, 84 }, { 'f', 16, 0 }, { 'a', 16, 112 }, { 'f', 16, 0 }, { 'f', 15, 0 }, { 'a', 15, 64 },
+  { 'r', 15, 112 }, { 'a', 16, 104 }, { 'f', 17, 0 }, { 'a', 17, 960 }, { 'a', 13, 836 }, { 'f', 16, 0 },
+  { 'a', 16, 52 }, { 'f', 17, 0 }, { 'a', 17, 76 }, { 'a', 18, 124 }, { 'f', 16, 0 }, { 'a', 16, 112 },
+  { 'f', 15, 0 }, { 'f', 17, 0 }, { 'a', 17, 852 }, { 'f', 13, 0 }, { 'f', 18, 0 }, { 'a', 18, 48 },
+  { 'f', 16, 0 }, { 'a', 16, 828 }, { 'a', 13, 564 }, { 'a', 15, 36 }, { 'f', 15, 0 }, { 'a', 15, 668 },
+  { 'f', 16, 0 }, { 'a', 16, 1000 }, { 'f', 17, 0 }, { 'f', 13, 0 }, { 'a', 13, 48 }, { 'a', 17, 44 },
+  { 'f', 16, 0 }, { 'a', 16, 64 }, { 'r', 16, 138 }, { 'a', 19, 112 }, { 'r', 16, 207 }, { 'a', 20, 48 },
+  { 'r', 16, 260 }, { 'f', 20, 0 }, { 'a', 20, 40 }, { 'r', 16, 358 }, { 'f', 15, 0 }, { 'f', 19, 0 },
+  { 'f', 20, 0 }, { 'a', 20, 988 }, { 'a', 19, 72 }, { 'f', 16, 0 }, { 'f', 20, 0 }, { 'a', 20, 52 },
+  { 'a', 16, 28 }, { 'a', 15, 60 }, { 'f', 6, 0 }, { 'f', 19, 0 }, { 'a', 19, 64 }, { 'r', 19, 169 },
+  { 'f', 15, 0 }, { 'a', 15, 64 }, { 'f', 16, 0 }, { 'r', 15, 179 }, { 'a', 16, 124 }, { 'r', 15, 217 },
+  { 'a', 6, 52 }, { 'f', 16, 0 }, { 'r', 15, 272 }, { 'a', 16, 756 }, { 'r', 15, 316 }, { 'a', 21, 1012 },
+  { 'a', 22, 636 }, { 'f', 19, 0 }, { 'a', 19, 100 }, { 'f', 15, 0 }, { 'f', 22, 0 }, { 'a', 22, 988 },
+  { 'a', 15, 52 }, { 'f', 19, 0 }, { 'f', 16, 0 }, { 'a', 16, 52 }, { 'f', 16, 0 }, { 'a', 16, 816 },
+  { 'f', 21, 0 }, { 'f', 15, 0 }, { 'a', 15, 96 }, { 'f', 16, 0 }, { 'a', 16, 64 }, { 'r', 16, 167 },
+  { 'f', 22, 0 }, { 'r', 16, 287 }, { 'f', 15, 0 }, { 'a', 15, 44 }, { 'r', 16, 364 }, { 'a', 22, 56 },
+  { 'r', 16, 405 }, { 'a', 21, 612 }, { 'a', 19, 48 }, { 'f', 16, 0 }, { 'a', 16, 644 }, { 'a', 23, 48 },
+  { 'a', 24, 104 }, { 'f', 23, 0 }, { 'f', 24, 0 }, { 'a', 24, 32 }, { 'a', 23, 48 }, { 'f', 16, 0 },
+  { 'f', 21, 0 }, { 'a', 21, 52 }, { 'f', 24, 0 }, { 'a', 24, 56 }, { 'a', 16, 72 }, { 'f', 24, 0 },
+  { 'f', 16, 0 }, { 'a', 16, 44 }, { 'a', 24, 124 }, { 'f', 24, 0 }, { 'a', 24, 64 }, { 'r', 24, 182 },
+  { 'a', 25, 28 }, { 'a', 26, 108 }, { 'a', 27, 716 }, { 'f', 25, 0 }, { 'a', 25, 60 }, { 'f', 26, 0 },
+  { 'f', 27, 0 }, { 'a', 27, 112 }, { 'f', 24, 0 }, { 'f', 25, 0 }, { 'a', 25, 100 }, { 'a', 24, 64 },
+  { 'f', 25, 0 }, { 'f', 27, 0 }, { 'a', 27, 92 }, { 'f', 27, 0 }, { 'a', 27, 876 }, { 'f', 24, 0 },
+  { 'a', 24, 100 }, { 'a', 25, 36 }, { 'f', 24, 0 }, { 'a', 24, 104 }, { 'f', 25, 0 }, { 'a', 25, 60 },
+  { 'a', 26, 980 }, { 'a', 28, 64 }, { 'f', 24, 0 }, { 'f', 25, 0 }, { 'f', 26, 0 }, { 'r', 28, 141 },
+  { 'a', 26, 44 }, { 'a', 25, 64 }, { 'f', 27, 0 }, { 'r', 25, 137 }, { 'a', 27, 120 }, { 'r', 25, 202 },
+  { 'a', 24, 64 }, { 'f', 27, 0 }, { 'a', 27, 48 }, { 'a', 29, 52 }, { 'f', 28, 0 }, { 'f', 29, 0 },
+  { 'a', 29, 60 }, { 'f', 24, 0 }, { 'a', 24, 900 }, { 'a', 28, 48 }, { 'f', 29, 0 }, { 'a', 29, 64 },
+  { 'f', 25, 0 }, { 'r', 29, 105 }, { 'f', 24, 0 }, { 'r', 29, 154 }, { 'a', 24, 100 }, { 'f', 2, 0 },
+  { 'r', 29, 207 }, { 'f', 24, 0 }, { 'a', 24, 64 }, { 'r', 24, 132 }, { 'r', 24, 229 }, { 'a', 2, 104 },
+  { 'r', 24, 323 }, { 'a', 25, 40 }, { 'f', 2, 0 }, { 'f', 29, 0 }, { 'a', 29, 52 }, { 'a', 2, 64 },
+  { 'f', 25, 0 }, { 'r', 2, 189 }, { 'a', 25, 44 }, { 'f', 24, 0 }, { 'f', 25, 0 }, { 'r', 2, 231 },
+  { 'r', 2, 290 }, { 'a', 25, 516 }, { 'a', 24, 752 }, { 'f', 4, 0 }, { 'a', 4, 60 }, { 'a', 30, 88 },
+  { 'a', 31, 88 }, { 'f', 4, 0 }, { 'f', 24, 0 }, { 'f', 2, 0 }, { 'f', 30, 0 }, { 'f', 31, 0 },
+  { 'a', 31, 120 }, { 'f', 25, 0 }, { 'a', 25, 60 }, { 'f', 25, 0 }, { 'f', 31, 0 }, { 'a', 31, 64 },
+  { 'r', 31, 170 }, { 'a', 25, 116 }, { 'a', 30, 784 }, { 'a', 2, 64 }, { 'r', 2, 171 }, { 'a', 24, 64 },
+  { 'f', 25, 0 }, { 'r', 2, 236 }, { 'r', 24, 182 }, { 'a', 25, 48 }, { 'f', 31, 0 }, { 'r', 2, 354 },
+  { 'r', 24, 275 }, { 'a', 31, 64 }, { 'r', 31, 110 }, { 'r', 2, 419 }, { 'a', 4, 64 }, { 'r', 31, 176 },
+  { 'r', 4, 102 }, { 'a', 32, 60 }, { 'r', 4, 144 }, { 'f', 24, 0 }, { 'a', 24, 128 }, { 'f', 30, 0 },
+  { 'a', 30, 652 }, { 'f', 11, 0 }, { 'f', 2, 0 }, { 'f', 32, 0 }, { 'a', 32, 68 }, { 'a', 2, 48 },
+  { 'f', 31, 0 }, { 'f', 24, 0 }, { 'a', 24, 56 }, { 'f', 2, 0 }, { 'a', 2, 28 }, { 'f', 32, 0 },
+  { 'f', 4, 0 }, { 'a', 4, 68 }, { 'f', 4, 0 }, { 'f', 2, 0 }, { 'a', 2, 36 }, { 'f', 30, 0 },
+  { 'a', 30, 112 }, { 'a', 4, 32 }, { 'f', 2, 0 }, { 'a', 2, 28 }, { 'f', 2, 0 }, { 'f', 4, 0 },
+  { 'a', 4, 52 }, { 'f', 30, 0 }, { 'a', 30, 44 }, { 'a', 2, 48 }, { 'a', 32, 64 }, { 'a', 31, 644 },
+  { 'f', 12, 0 }, { 'a', 12, 28 }, { 'f', 12, 0 }, { 'a', 12, 36 }, { 'f', 32, 0 }, { 'a', 32, 64 },
+  { 'r', 32, 155 }, { 'a', 11, 88 }, { 'f', 12, 0 }, { 'a', 12, 876 }, { 'a', 33, 32 }, { 'f', 31, 0 },
+  { 'f', 11, 0 }, { 'a', 11, 64 }, { 'r', 11, 107 }, { 'a', 31, 64 }, { 'f', 32, 0 }, { 'r', 11, 189 },
+  { 'r', 31, 139 }, { 'a', 32, 44 }, { 'f', 12, 0 }, { 'r', 11, 279 }, { 'r', 31, 262 }, { 'f', 33, 0 },
+  { 'a', 33, 52 }, { 'f', 33, 0 }, { 'r', 31, 305 }, { 'a', 33, 96 }, { 'a', 12, 64 }, { 'f', 32, 0 },
+  { 'r', 12, 158 }, { 'a', 32, 56 }, { 'f', 33, 0 }, { 'r', 12, 217 }, { 'a', 33, 804 }, { 'f', 32, 0 },
+  { 'f', 31, 0 }, { 'r', 12, 323 }, { 'f', 33, 0 }, { 'f', 11, 0 }, { 'r', 12, 432 }, { 'a', 11, 60 },
+  { 'a', 33, 88 }, { 'f', 11, 0 }, { 'f', 33, 0 }, { 'a', 33, 40 }, { 'a', 11, 52 }, { 'f', 33, 0 },
+  { 'f', 12, 0 }, { 'a', 12, 80 }, { 'a', 33, 76 }, { 'f', 7, 0 }, { 'f', 33, 0 }, { 'a', 33, 64 },
+  { 'r', 33, 152 }, { 'f', 12, 0 }, { 'a', 12, 28 }, { 'r', 33, 267 }, { 'a', 7, 52 }, { 'r', 33, 325 },
+  { 'a', 31, 56 }, { 'f', 31, 0 }, { 'a', 31, 100 }, { 'f', 12, 0 }, { 'f', 31, 0 }, { 'a', 31, 52 },
+  { 'a', 12, 88 }, { 'a', 32, 68 }, { 'f', 33, 0 }, { 'f', 12, 0 }, { 'a', 12, 60 }, { 'a', 33, 44 },
+  { 'f', 32, 0 }, { 'a', 32, 104 }, { 'f', 33, 0 }, { 'a', 33, 64 }, { 'f', 12, 0 }, { 'r', 33, 117 },
+  { 'a', 12, 56 }, { 'r', 33, 150 }, { 'a', 34, 36 }, { 'r', 33, 228 }, { 'f', 32, 0 }, { 'f', 34, 0 },
+  { 'a', 34, 48 }, { 'f', 12, 0 }, { 'a', 12, 76 }, { 'f', 10, 0 }, { 'a', 10, 104 }, { 'f', 12, 0 },
+  { 'f', 10, 0 }, { 'a', 10, 40 }, { 'f', 10, 0 }, { 'a', 10, 56 }, { 'a', 12, 28 }, { 'f', 12, 0 },
+  { 'f', 33, 0 }, { 'a', 33, 68 }, { 'a', 12, 108 }, { 'f', 33, 0 }, { 'a', 33, 52 }, { 'a', 32, 64 },
+  { 'f', 12, 0 }, { 'r', 32, 123 }, { 'a', 12, 988 }, { 'r', 32, 240 }, { 'a', 35, 64 }, { 'r', 35, 118 },
+  { 'r', 35, 216 }, { 'a', 36, 588 }, { 'f', 12, 0 }, { 'a', 12, 712 }, { 'a', 37, 40 }, { 'f', 32, 0 },
+  { 'a', 32, 124 }, { 'a', 38, 80 }, { 'f', 35, 0 }, { 'f', 36, 0 }, { 'f', 38, 0 }, { 'a', 38, 44 },
+  { 'f', 0, 0 }, { 'f', 32, 0 }, { 'a', 32, 64 }, { 'f', 12, 0 }, { 'a', 12, 40 }, { 'f', 32, 0 },
+  { 'a', 32, 48 }, { 'f', 12, 0 }, { 'a', 12, 64 }, { 'r', 12, 115 }, { 'a', 0, 64 }, { 'f', 32, 0 },
+  { 'r', 12, 238 }, { 'r', 0, 189 }, { 'a', 32, 64 }, { 'r', 32, 110 }, { 'r', 0, 253 }, { 'a', 36, 68 },
+  { 'a', 35, 112 }, { 'f', 36, 0 }, { 'f', 35, 0 }, { 'a', 35, 72 }, { 'a', 36, 28 }, { 'f', 12, 0 },
+  { 'a', 12, 64 }, { 'f', 15, 0 }, { 'r', 12, 129 }, { 'f', 35, 0 }, { 'a', 35, 64 }, { 'f', 0, 0 },
+  { 'f', 36, 0 }, { 'a', 36, 40 }, { 'f', 32, 0 }, { 'f', 36, 0 }, { 'a', 36, 100 }, { 'f', 36, 0 },
+  { 'f', 35, 0 }, { 'a', 35, 100 }, { 'f', 35, 0 }, { 'a', 35, 64 }, { 'r', 35, 104 }, { 'f', 12, 0 },
+  { 'a', 12, 64 }, { 'r', 35, 221 }, { 'r', 12, 101 }, { 'a', 36, 112 }, { 'r', 12, 211 }, { 'f', 36, 0 },
+  { 'a', 36, 48 }, { 'a', 32, 64 }, { 'r', 32, 105 }, { 'a', 0, 44 }, { 'f', 12, 0 }, { 'r', 32, 179 },
+  { 'a', 12, 676 }, { 'f', 35, 0 }, { 'a', 35, 60 }, { 'a', 15, 64 }, { 'a', 39, 28 }, { 'f', 15, 0 },
+  { 'a', 15, 64 }, { 'f', 13, 0 }, { 'f', 1, 0 }, { 'f', 35, 0 }, { 'r', 15, 164 }, { 'a', 35, 52 },
+  { 'f', 12, 0 }, { 'f', 32, 0 }, { 'r', 15, 224 }, { 'r', 15, 304 }, { 'f', 39, 0 }, { 'a', 39, 128 },
+  { 'f', 39, 0 }, { 'r', 15, 373 }, { 'a', 39, 84 }, { 'f', 24, 0 }, { 'f', 39, 0 }, { 'a', 39, 44 },
+  { 'f', 14, 0 }, { 'a', 14, 64 }, { 'a', 24, 632 }, { 'f', 15, 0 }, { 'a', 15, 84 }, { 'f', 15, 0 },
+  { 'a', 15, 64 }, { 'f', 14, 0 }, { 'a', 14, 112 }, { 'f', 24, 0 }, { 'a', 24, 828 }, { 'f', 15, 0 },
+  { 'f', 14, 0 }, { 'a', 14, 64 }, { 'r', 14, 182 }, { 'f', 24, 0 }, { 'f', 6, 0 }, { 'a', 6, 64 },
+  { 'f', 5, 0 }, { 'r', 14, 271 }, { 'r', 6, 127 }, { 'f', 23, 0 }, { 'a', 23, 92 }, { 'r', 6, 173 },
+  { 'a', 5, 120 }, { 'f', 23, 0 }, { 'r', 6, 222 }, { 'a', 23, 76 }, { 'r', 6, 277 }, { 'f', 5, 0 },
+  { 'a', 5, 44 }, { 'f', 16, 0 }, { 'a', 16, 64 }, { 'f', 25, 0 }, { 'r', 16, 99 }, { 'a', 25, 76 },
+  { 'f', 23, 0 }, { 'f', 14, 0 }, { 'f', 25, 0 }, { 'r', 16, 131 }, { 'a', 25, 48 }, { 'a', 14, 120 },
+  { 'f', 6, 0 }, { 'a', 6, 616 }, { 'a', 23, 100 }, { 'f', 14, 0 }, { 'a', 14, 92 }, { 'f', 14, 0 },
+  { 'a', 14, 92 }, { 'f', 14, 0 }, { 'f', 23, 0 }, { 'a', 23, 88 }, { 'f', 16, 0 }, { 'a', 16, 88 },
+  { 'f', 21, 0 }, { 'f', 16, 0 }, { 'a', 16, 64 }, { 'r', 16, 135 }, { 'f', 6, 0 }, { 'a', 6, 80 },
+  { 'f', 23, 0 }, { 'r', 16, 207 }, { 'a', 23, 860 }, { 'r', 16, 305 }, { 'f', 6, 0 }, { 'a', 6, 24 },
+  { 'r', 16, 353 }, { 'a', 21, 116 }, { 'a', 14, 64 }, { 'f', 16, 0 }, { 'f', 6, 0 }, { 'f', 21, 0 },
+  { 'a', 21, 64 }, { 'r', 21, 153 }, { 'f', 4, 0 }, { 'f', 14, 0 }, { 'f', 23, 0 }, { 'a', 23, 32 },
+  { 'f', 2, 0 }, { 'a', 2, 64 }, { 'f', 23, 0 }, { 'r', 2, 173 }, { 'a', 23, 104 }, { 'r', 2, 262 },
+  { 'a', 14, 64 }, { 'r', 14, 145 }, { 'a', 4, 44 }, { 'f', 23, 0 }, { 'r', 14, 191 }, { 'a', 23, 44 },
+  { 'r', 14, 287 }, { 'a', 6, 72 }, { 'f', 21, 0 }, { 'f', 6, 0 }, { 'a', 6, 48 }, { 'f', 2, 0 },
+  { 'a', 2, 40 }, { 'f', 6, 0 }, { 'f', 2, 0 }, { 'f', 14, 0 }, { 'a', 14, 52 }, { 'a', 2, 80 },
+  { 'a', 6, 48 }, { 'a', 21, 860 }, { 'f', 2, 0 }, { 'a', 2, 48 }, { 'a', 16, 64 }, { 'f', 21, 0 },
+  { 'r', 16, 181 }, { 'r', 16, 265 }, { 'a', 21, 72 }, { 'f', 21, 0 }, { 'a', 21, 76 }, { 'a', 24, 64 },
+  { 'f', 22, 0 }, { 'a', 22, 44 }, { 'f', 21, 0 }, { 'f', 24, 0 }, { 'f', 16, 0 }, { 'a', 16, 48 },
+  { 'a', 24, 48 }, { 'a', 21, 96 }, { 'f', 21, 0 }, { 'a', 21, 68 }, { 'f', 16, 0 }, { 'f', 37, 0 },
+  { 'a', 37, 52 }, { 'f', 24, 0 }, { 'a', 24, 68 }, { 'f', 21, 0 }, { 'a', 21, 44 }, { 'a', 16, 56 },
+  { 'f', 24, 0 }, { 'a', 24, 64 }, { 'r', 24, 116 }, { 'a', 15, 48 }, { 'r', 24, 222 }, { 'f', 29, 0 },
+  { 'a', 29, 64 }, { 'r', 24, 303 }, { 'f', 29, 0 }, { 'a', 29, 944 }, { 'a', 32, 64 }, { 'f', 15, 0 },
+  { 'r', 32, 147 }, { 'f', 10, 0 }, { 'f', 24, 0 }, { 'r', 32, 232 }, { 'a', 24, 48 }, { 'f', 3, 0 },
+  { 'r', 32, 314 }, { 'a', 3, 52 }, { 'r', 32, 372 }, { 'a', 10, 40 }, { 'f', 29, 0 }, { 'a', 29, 52 },
+  { 'a', 15, 104 }, { 'f', 15, 0 }, { 'a', 15, 36 }, { 'f', 32, 0 }, { 'a', 32, 120 }, { 'f', 15, 0 },
+  { 'a', 15, 124 }, { 'f', 28, 0 }, { 'f', 32, 0 }, { 'a', 32, 52 }, { 'a', 28, 96 }, { 'a', 12, 108 },
+  { 'f', 15, 0 }, { 'a', 15, 732 }, { 'f', 12, 0 }, { 'a', 12, 92 }, { 'f', 28, 0 }, { 'a', 28, 100 },
+  { 'f', 28, 0 }, { 'a', 28, 632 }, { 'f', 15, 0 }, { 'a', 15, 28 }, { 'f', 28, 0 }, { 'f', 12, 0 },
+  { 'a', 12, 52 }, { 'a', 28, 52 }, { 'f', 15, 0 }, { 'a', 15, 120 }, { 'a', 1, 752 }, { 'f', 15, 0 },
+  { 'a', 15, 112 }, { 'f', 1, 0 }, { 'a', 1, 92 }, { 'a', 13, 60 }, { 'f', 15, 0 }, { 'f', 13, 0 },
+  { 'a', 13, 120 }, { 'f', 13, 0 }, { 'f', 1, 0 }, { 'a', 1, 620 }, { 'a', 13, 64 }, { 'r', 13, 106 },
+  { 'a', 15, 984 }, { 'r', 13, 191 }, { 'a', 40, 52 }, { 'f', 1, 0 }, { 'r', 13, 249 }, { 'a', 1, 96 },
+  { 'a', 41, 64 }, { 'r', 41, 135 }, { 'a', 42, 64 }, { 'f', 13, 0 }, { 'f', 40, 0 }, { 'r', 41, 225 },
+  { 'r', 42, 177 }, { 'f', 1, 0 }, { 'f', 15, 0 }, { 'r', 41, 329 }, { 'r', 42, 258 }, { 'a', 15, 796 },
+  { 'f', 31, 0 }, { 'r', 42, 316 }, { 'a', 31, 28 }, { 'a', 1, 52 }, { 'a', 40, 128 }, { 'f', 41, 0 },
+  { 'f', 31, 0 }, { 'f', 15, 0 }, { 'a', 15, 84 }, { 'f', 40, 0 }, { 'f', 9, 0 }, { 'f', 42, 0 },
+  { 'a', 42, 56 }, { 'f', 15, 0 }, { 'f', 11, 0 }, { 'a', 11, 120 }, { 'a', 15, 56 }, { 'a', 9, 700 },
+  { 'f', 42, 0 }, { 'f', 11, 0 }, { 'a', 11, 64 }, { 'r', 11, 167 }, { 'f', 15, 0 }, { 'a', 15, 620 },
+  { 'r', 11, 271 }, { 'f', 9, 0 }, { 'a', 9, 80 }, { 'f', 19, 0 }, { 'a', 19, 64 }, { 'f', 15, 0 },
+  { 'r', 19, 121 }, { 'a', 15, 92 }, { 'f', 15, 0 }, { 'r', 19, 193 }, { 'a', 15, 88 }, { 'f', 11, 0 },
+  { 'r', 19, 261 }, { 'f', 27, 0 }, { 'f', 9, 0 }, { 'a', 9, 96 }, { 'f', 9, 0 }, { 'r', 19, 320 },
+  { 'a', 9, 56 }, { 'a', 27, 44 }, { 'f', 15, 0 }, { 'a', 15, 80 }, { 'f', 19, 0 }, { 'f', 9, 0 },
+  { 'f', 27, 0 }, { 'a', 27, 40 }, { 'a', 9, 56 }, { 'f', 15, 0 }, { 'a', 15, 32 }, { 'a', 19, 84 },
+  { 'f', 27, 0 }, { 'a', 27, 72 }, { 'a', 11, 40 }, { 'f', 27, 0 }, { 'f', 14, 0 }, { 'f', 15, 0 },
+  { 'a', 15, 108 }, { 'f', 19, 0 }, { 'f', 11, 0 }, { 'a', 11, 48 }, { 'f', 15, 0 }, { 'a', 15, 52 },
+  { 'a', 19, 64 }, { 'r', 19, 152 }, { 'a', 14, 112 }, { 'f', 8, 0 }, { 'a', 8, 120 }, { 'f', 15, 0 },
+  { 'f', 8, 0 }, { 'a', 8, 84 }, { 'f', 14, 0 }, { 'a', 14, 104 }, { 'a', 15, 100 }, { 'a', 27, 56 },
+  { 'f', 8, 0 }, { 'a', 8, 64 }, { 'r', 8, 99 }, { 'f', 14, 0 }, { 'f', 19, 0 }, { 'f', 15, 0 },
+  { 'a', 15, 112 }, { 'r', 8, 187 }, { 'f', 15, 0 }, { 'f', 27, 0 }, { 'a', 27, 52 }, { 'a', 15, 52 },
+  { 'a', 19, 44 }, { 'f', 8, 0 }, { 'f', 37, 0 }, { 'a', 37, 28 }, { 'a', 8, 56 }, { 'f', 37, 0 },
+  { 'a', 37, 40 }, { 'f', 19, 0 }, { 'a', 19, 516 }, { 'f', 37, 0 }, { 'a', 37, 80 }, { 'a', 14, 44 },
+  { 'a', 42, 92 }, { 'f', 42, 0 }, { 'a', 42, 88 }, { 'f', 37, 0 }, { 'a', 37, 68 }, { 'f', 42, 0 },
+  { 'a', 42, 652 }, { 'f', 19, 0 }, { 'f', 17, 0 }, { 'a', 17, 52 }, { 'f', 37, 0 }, { 'a', 37, 96 },
+  { 'f', 37, 0 }, { 'f', 42, 0 }, { 'a', 42, 48 }, { 'a', 37, 100 }, { 'a', 19, 36 }, { 'a', 40, 40 },
+  { 'f', 37, 0 }, { 'f', 19, 0 }, { 'a', 19, 88 }, { 'f', 19, 0 }, { 'a', 19, 44 }, { 'f', 19, 0 },
+  { 'f', 40, 0 }, { 'a', 40, 72 }, { 'a', 19, 56 }, { 'f', 19, 0 }, { 'a', 19, 48 }, { 'a', 37, 72 },
+  { 'f', 40, 0 }, { 'a', 40, 120 }, { 'f', 40, 0 }, { 'f', 19, 0 }, { 'a', 19, 64 }, { 'r', 19, 178 },
+  { 'a', 40, 56 }, { 'r', 19, 292 }, { 'f', 37, 0 }, { 'a', 37, 100 }, { 'r', 19, 331 }, { 'a', 31, 100 },
+  { 'f', 18, 0 }, { 'r', 19, 385 }, { 'f', 40, 0 }, { 'f', 37, 0 }, { 'f', 31, 0 }, { 'a', 31, 92 },
+  { 'a', 37, 112 }, { 'a', 40, 28 }, { 'a', 18, 48 }, { 'f', 31, 0 }, { 'f', 19, 0 }, { 'f', 40, 0 },
+  { 'f', 37, 0 }, { 'a', 37, 576 }, { 'a', 40, 64 }, { 'r', 40, 106 }, { 'a', 19, 52 }, { 'f', 19, 0 },
+  { 'a', 19, 60 }, { 'f', 37, 0 }, { 'f', 20, 0 }, { 'f', 19, 0 }, { 'a', 19, 64 }, { 'r', 19, 123 },
+  { 'a', 20, 56 }, { 'r', 19, 216 }, { 'a', 37, 64 }, { 'r', 37, 179 }, { 'a', 31, 64 }, { 'f', 20, 0 },
+  { 'r', 37, 298 }, { 'a', 20, 60 }, { 'f', 40, 0 }, { 'r', 37, 410 }, { 'a', 40, 124 }, { 'f', 31, 0 },
+  { 'a', 31, 112 }, { 'f', 19, 0 }, { 'f', 40, 0 }, { 'a', 40, 64 }, { 'r', 40, 186 }, { 'f', 20, 0 },
+  { 'f', 37, 0 }, { 'f', 31, 0 }, { 'a', 31, 80 }, { 'f', 31, 0 }, { 'a', 31, 720 }, { 'a', 37, 116 },
+  { 'a', 20, 52 }, { 'f', 37, 0 }, { 'a', 37, 36 }, { 'f', 40, 0 }, { 'f', 31, 0 }, { 'a', 31, 64 },
+  { 'r', 31, 159 }, { 'f', 20, 0 }, { 'a', 20, 60 }, { 'r', 31, 233 }, { 'f', 20, 0 }, { 'f', 37, 0 },
+  { 'r', 31, 306 }, { 'a', 37, 124 }, { 'r', 31, 415 }, { 'a', 20, 100 }, { 'f', 37, 0 }, { 'a', 37, 816 },
+  { 'f', 31, 0 }, { 'f', 8, 0 }, { 'a', 8, 48 }, { 'f', 5, 0 }, { 'f', 20, 0 }, { 'a', 20, 60 },
+  { 'f', 37, 0 }, { 'a', 37, 68 }, { 'a', 5, 656 }, { 'f', 20, 0 }, { 'f', 37, 0 }, { 'a', 37, 48 },
+  { 'a', 20, 64 }, { 'r', 20, 130 }, { 'a', 31, 24 }, { 'f', 5, 0 }, { 'a', 5, 44 }, { 'a', 40, 84 },
+  { 'f', 5, 0 }, { 'f', 31, 0 }, { 'f', 40, 0 }, { 'f', 38, 0 }, { 'a', 38, 64 }, { 'r', 38, 155 },
+  { 'a', 40, 112 }, { 'f', 20, 0 }, { 'f', 22, 0 }, { 'f', 14, 0 }, { 'a', 14, 64 }, { 'r', 14, 126 },
+  { 'a', 22, 552 }, { 'a', 20, 120 }, { 'f', 22, 0 }, { 'f', 40, 0 }, { 'f', 20, 0 }, { 'a', 20, 64 },
+  { 'f', 24, 0 }, { 'r', 20, 145 }, { 'r', 20, 218 }, { 'a', 24, 968 }, { 'f', 38, 0 }, { 'a', 38, 92 },
+  { 'f', 38, 0 }, { 'f', 14, 0 }, { 'a', 14, 104 }, { 'a', 38, 64 }, { 'r', 38, 158 }, { 'f', 20, 0 },
+  { 'a', 20, 48 }, { 'f', 24, 0 }, { 'f', 14, 0 }, { 'r', 38, 209 }, { 'a', 14, 52 }, { 'r', 38, 295 },
+  { 'a', 24, 768 }, { 'a', 40, 24 }, { 'f', 40, 0 }, { 'a', 40, 32 }, { 'f', 38, 0 }, { 'f', 9, 0 },
+  { 'f', 24, 0 }, { 'f', 40, 0 }, { 'a', 40, 64 }, { 'r', 40, 109 }, { 'a', 24, 64 }, { 'r', 40, 213 },
+  { 'r', 24, 98 }, { 'a', 9, 64 }, { 'f', 35, 0 }, { 'r', 9, 145 }, { 'a', 35, 876 }, { 'r', 9, 210 },
+  { 'a', 38, 68 }, { 'f', 38, 0 }, { 'f', 40, 0 }, { 'a', 40, 44 }, { 'f', 24, 0 }, { 'f', 9, 0 },
+  { 'a', 9, 88 }, { 'f', 35, 0 }, { 'f', 7, 0 }, { 'a', 7, 64 }, { 'r', 7, 138 }, { 'f', 9, 0 },
+  { 'a', 9, 56 }, { 'r', 7, 229 }, { 'f', 40, 0 }, { 'a', 40, 44 }, { 'r', 7, 291 }, { 'a', 35, 32 },
+  { 'a', 24, 96 }, { 'f', 40, 0 }, { 'f', 35, 0 }, { 'a', 35, 612 }, { 'f', 24, 0 }, { 'f', 7, 0 },
+  { 'f', 26, 0 }, { 'a', 26, 76 }, { 'a', 7, 92 }, { 'f', 26, 0 }, { 'f', 7, 0 }, { 'a', 7, 52 },
+  { 'f', 39, 0 }, { 'a', 39, 40 }, { 'f', 39, 0 }, { 'f', 0, 0 }, { 'a', 0, 28 }, { 'f', 7, 0 },
+  { 'f', 35, 0 }, { 'f', 0, 0 }, { 'a', 0, 112 }, { 'a', 35, 48 }, { 'f', 29, 0 }, { 'a', 29, 64 },
+  { 'f', 0, 0 }, { 'r', 29, 151 }, { 'a', 0, 56 }, { 'f', 32, 0 }, { 'a', 32, 64 }, { 'r', 32, 127 },
+  { 'r', 32, 207 }, { 'a', 7, 92 }, { 'r', 32, 277 }, { 'a', 39, 520 }, { 'a', 26, 28 }, { 'f', 7, 0 },
+  { 'a', 7, 64 }, { 'f', 29, 0 }, { 'r', 7, 116 }, { 'f', 26, 0 }, { 'a', 26, 96 }, { 'f', 39, 0 },
+  { 'a', 39, 112 }, { 'f', 26, 0 }, { 'f', 32, 0 }, { 'a', 32, 52 }, { 'a', 26, 984 }, { 'a', 29, 24 },
+  { 'f', 7, 0 }, { 'f', 39, 0 }, { 'a', 39, 112 }, { 'f', 29, 0 }, { 'a', 29, 116 }, { 'f', 29, 0 },
+  { 'a', 29, 104 }, { 'f', 26, 0 }, { 'f', 39, 0 }, { 'a', 39, 128 }, { 'f', 29, 0 }, { 'a', 29, 768 },
+  { 'f', 37, 0 }, { 'f', 39, 0 }, { 'a', 39, 56 }, { 'a', 37, 96 }, { 'a', 26, 588 }, { 'f', 29, 0 },
+  { 'a', 29, 624 }, { 'f', 37, 0 }, { 'a', 37, 92 }, { 'f', 6, 0 }, { 'f', 29, 0 }, { 'f', 16, 0 },
+  { 'a', 16, 112 }, { 'f', 37, 0 }, { 'a', 37, 108 }, { 'f', 16, 0 }, { 'a', 16, 64 }, { 'r', 16, 163 },
+  { 'f', 26, 0 }, { 'a', 26, 608 }, { 'r', 16, 218 }, { 'f', 37, 0 }, { 'a', 37, 64 }, { 'r', 16, 313 },
+  { 'r', 37, 157 }, { 'f', 10, 0 }, { 'r', 37, 271 }, { 'f', 26, 0 }, { 'a', 26, 84 }, { 'a', 10, 64 },
+  { 'f', 26, 0 }, { 'r', 10, 161 }, { 'a', 26, 64 }, { 'r', 26, 111 }, { 'a', 29, 60 }, { 'r', 26, 227 },
+  { 'f', 16, 0 }, { 'f', 34, 0 }, { 'f', 37, 0 }, { 'a', 37, 88 }, { 'f', 29, 0 }, { 'f', 26, 0 },
+  { 'f', 10, 0 }, { 'a', 10, 48 }, { 'f', 37, 0 }, { 'a', 37, 48 }, { 'f', 30, 0 }, { 'a', 30, 120 },
+  { 'f', 37, 0 }, { 'a', 37, 528 }, { 'a', 26, 592 }, { 'f', 37, 0 }, { 'a', 37, 96 }, { 'f', 30, 0 },
+  { 'a', 30, 48 }, { 'f', 30, 0 }, { 'a', 30, 68 }, { 'f', 37, 0 }, { 'a', 37, 124 }, { 'f', 30, 0 },
+  { 'a', 30, 524 }, { 'a', 29, 88 }, { 'f', 26, 0 }, { 'a', 26, 124 }, { 'f', 37, 0 }, { 'a', 37, 28 },
+  { 'a', 34, 76 }, { 'f', 37, 0 }, { 'f', 29, 0 }, { 'a', 29, 64 }, { 'r', 29, 109 }, { 'f', 26, 0 },
+  { 'f', 34, 0 }, { 'a', 34, 580 }, { 'r', 29, 179 }, { 'a', 26, 108 }, { 'f', 30, 0 }, { 'f', 34, 0 },
+  { 'a', 34, 64 }, { 'f', 33, 0 }, { 'r', 34, 181 }, { 'a', 33, 64 }, { 'r', 33, 176 }, { 'r', 34, 247 },
+  { 'f', 26, 0 }, { 'r', 33, 239 }, { 'f', 12, 0 }, { 'a', 12, 44 }, { 'r', 33, 300 }, { 'f', 29, 0 },
+  { 'r', 33, 396 }, { 'a', 29, 44 }, { 'a', 26, 104 }, { 'a', 30, 80 }, { 'a', 37, 560 }, { 'f', 32, 0 },
+  { 'f', 34, 0 }, { 'f', 26, 0 }, { 'f', 33, 0 }, { 'f', 30, 0 }, { 'f', 37, 0 }, { 'a', 37, 84 },
+  { 'a', 30, 852 }, { 'a', 33, 28 }, { 'f', 37, 0 }, { 'a', 37, 44 }, { 'a', 26, 32 }, { 'f', 26, 0 },
+  { 'a', 26, 56 }, { 'f', 30, 0 }, { 'f', 20, 0 }, { 'f', 33, 0 }, { 'a', 33, 52 }, { 'a', 20, 108 },
+  { 'a', 30, 40 }, { 'f', 26, 0 }, { 'a', 26, 64 }, { 'f', 30, 0 }, { 'r', 26, 101 }, { 'a', 30, 36 },
+  { 'f', 20, 0 }, { 'r', 26, 189 }, { 'a', 20, 92 }, { 'r', 26, 277 }, { 'a', 34, 64 }, { 'f', 30, 0 },
+  { 'r', 34, 104 }, { 'a', 30, 96 }, { 'f', 3, 0 }, { 'r', 34, 219 }, { 'a', 3, 64 }, { 'r', 3, 110 },
+  { 'f', 20, 0 }, { 'f', 26, 0 }, { 'a', 26, 64 }, { 'r', 26, 111 }, { 'f', 30, 0 }, { 'a', 30, 104 },
+  { 'r', 26, 200 }, { 'a', 20, 88 }, { 'r', 26, 252 }, { 'a', 32, 52 }, { 'f', 30, 0 }, { 'f', 34, 0 },
+  { 'a', 34, 80 }, { 'f', 3, 0 }, { 'f', 34, 0 }, { 'f', 20, 0 }, { 'a', 20, 80 }, { 'f', 26, 0 },
+  { 'a', 26, 40 }, { 'f', 20, 0 }, { 'f', 26, 0 }, { 'a', 26, 84 }, { 'f', 2, 0 }, { 'a', 2, 68 },
+  { 'a', 20, 116 }, { 'f', 26, 0 }, { 'f', 2, 0 }, { 'a', 2, 64 }, { 'r', 2, 168 }, { 'f', 4, 0 },
+  { 'a', 4, 128 }, { 'r', 2, 223 }, { 'f', 4, 0 }, { 'f', 20, 0 }, { 'a', 20, 44 }, { 'a', 4, 812 },
+  { 'a', 26, 660 }, { 'f', 36, 0 }, { 'a', 36, 124 }, { 'f', 2, 0 }, { 'f', 4, 0 }, { 'a', 4, 124 },
+  { 'a', 2, 108 }, { 'f', 26, 0 }, { 'a', 26, 64 }, { 'f', 4, 0 }, { 'f', 2, 0 }, { 'r', 26, 168 },
+  { 'f', 36, 0 }, { 'r', 26, 211 }, { 'a', 36, 36 }, { 'f', 36, 0 }, { 'r', 26, 327 }, { 'a', 36, 76 },
+  { 'a', 2, 56 }, { 'f', 23, 0 }, { 'a', 23, 76 }, { 'f', 36, 0 }, { 'a', 36, 64 }, { 'r', 36, 96 },
+  { 'f', 23, 0 }, { 'f', 26, 0 }, { 'a', 26, 64 }, { 'r', 36, 128 }, { 'r', 26, 185 }, { 'a', 23, 44 },
+  { 'f', 14, 0 }, { 'r', 36, 185 }, { 'a', 14, 36 }, { 'f', 14, 0 }, { 'r', 36, 300 }, { 'f', 23, 0 },
+  { 'a', 23, 60 }, { 'f', 23, 0 }, { 'f', 39, 0 }, { 'a', 39, 36 }, { 'a', 23, 516 }, { 'a', 14, 76 },
+  { 'f', 36, 0 }, { 'f', 26, 0 }, { 'f', 23, 0 }, { 'a', 23, 48 }, { 'f', 39, 0 }, { 'a', 39, 788 },
+  { 'f', 14, 0 }, { 'a', 14, 564 }, { 'f', 39, 0 }, { 'a', 39, 48 }, { 'a', 26, 60 }, { 'f', 26, 0 },
+  { 'a', 26, 40 }, { 'a', 36, 940 }, { 'f', 14, 0 }, { 'a', 14, 92 }, { 'f', 26, 0 }, { 'a', 26, 56 },
+  { 'f', 14, 0 }, { 'a', 14, 124 }, { 'f', 14, 0 }, { 'a', 14, 124 }, { 'f', 36, 0 }, { 'a', 36, 124 },
+  { 'a', 4, 36 }, { 'a', 34, 68 }, { 'f', 14, 0 }, { 'f', 36, 0 }, { 'a', 36, 720 }, { 'f', 4, 0 },
+  { 'f', 34, 0 }, { 'a', 34, 52 }, { 'a', 4, 96 }, { 'f', 34, 0 }, { 'a', 34, 60 }, { 'a', 14, 44 },
+  { 'f', 4, 0 }, { 'a', 4, 40 }, { 'f', 36, 0 }, { 'a', 36, 60 }, { 'f', 34, 0 }, { 'f', 14, 0 },
+  { 'f', 4, 0 }, { 'a', 4, 64 }, { 'a', 14, 988 }, { 'f', 36, 0 }, { 'a', 36, 64 }, { 'r', 36, 186 },
+  { 'f', 4, 0 }, { 'f', 14, 0 }, { 'a', 14, 84 }, { 'r', 36, 233 }, { 'a', 4, 44 }, { 'r', 36, 315 },
+  { 'a', 34, 88 }, { 'f', 34, 0 }, { 'a', 34, 104 }, { 'f', 14, 0 }, { 'a', 14, 804 }, { 'f', 36, 0 },
+  { 'f', 34, 0 }, { 'a', 34, 64 }, { 'r', 34, 105 }, { 'a', 36, 80 }, { 'r', 34, 157 }, { 'f', 14, 0 },
+  { 'r', 34, 190 }, { 'f', 36, 0 }, { 'a', 36, 88 }, { 'r', 34, 236 }, { 'a', 14, 128 }, { 'a', 3, 128 },
+  { 'f', 14, 0 }, { 'a', 14, 36 }, { 'f', 36, 0 }, { 'f', 14, 0 }, { 'a', 14, 52 }, { 'f', 3, 0 },
+  { 'a', 3, 120 }, { 'f', 34, 0 }, { 'a', 34, 64 }, { 'f', 34, 0 }, { 'f', 3, 0 }, { 'a', 3, 784 },
+  { 'f', 25, 0 }, { 'a', 25, 64 }, { 'r', 25, 131 }, { 'r', 25, 222 }, { 'a', 34, 52 }, { 'f', 1, 0 },
+  { 'a', 1, 64 }, { 'r', 1, 116 }, { 'a', 36, 64 }, { 'r', 36, 161 }, { 'a', 30, 108 }, { 'r', 36, 229 },
+  { 'a', 16, 48 }, { 'f', 25, 0 }, { 'f', 30, 0 }, { 'a', 30, 44 }, { 'f', 30, 0 }, { 'f', 3, 0 },
+  { 'a', 3, 40 }, { 'f', 16, 0 }, { 'a', 16, 64 }, { 'r', 16, 123 }, { 'f', 1, 0 }, { 'f', 36, 0 },
+  { 'a', 36, 120 }, { 'f', 3, 0 }, { 'a', 3, 40 }, { 'a', 1, 52 }, { 'f', 36, 0 }, { 'a', 36, 100 },
+  { 'f', 3, 0 }, { 'f', 36, 0 }, { 'a', 36, 124 }, { 'a', 3, 48 }, { 'f', 1, 0 }, { 'a', 1, 56 },
+  { 'f', 16, 0 }, { 'a', 16, 40 }, { 'f', 36, 0 }, { 'a', 36, 640 }, { 'f', 3, 0 }, { 'a', 3, 76 },
+  { 'a', 30, 64 }, { 'a', 25, 44 }, { 'f', 25, 0 }, { 'a', 25, 100 }, { 'f', 36, 0 }, { 'f', 3, 0 },
+  { 'f', 30, 0 }, { 'a', 30, 48 }, { 'f', 25, 0 }, { 'a', 25, 40 }, { 'f', 30, 0 }, { 'a', 30, 64 },
+  { 'r', 30, 179 }, { 'a', 3, 52 }, { 'r', 30, 244 }, { 'f', 25, 0 }, { 'a', 25, 56 }, { 'r', 30, 285 },
+  { 'a', 36, 120 }, { 'f', 3, 0 }, { 'a', 3, 608 }, { 'f', 8, 0 }, { 'a', 8, 744 }, { 'f', 26, 0 },
+  { 'f', 36, 0 }, { 'f', 30, 0 }, { 'f', 3, 0 }, { 'a', 3, 108 }, { 'f', 3, 0 }, { 'a', 3, 44 },
+  { 'a', 30, 112 }, { 'f', 30, 0 }, { 'f', 8, 0 }, { 'a', 8, 60 }, { 'f', 8, 0 }, { 'a', 8, 56 },
+  { 'a', 30, 64 }, { 'r', 30, 116 }, { 'a', 36, 28 }, { 'a', 26, 68 }, { 'a', 6, 112 }, { 'f', 36, 0 },
+  { 'a', 36, 64 }, { 'r', 36, 190 }, { 'f', 26, 0 }, { 'a', 26, 808 }, { 'f', 30, 0 }, { 'r', 36, 251 },
+  { 'f', 6, 0 }, { 'r', 36, 287 }, { 'a', 6, 592 }, { 'f', 29, 0 }, { 'a', 29, 64 }, { 'r', 29, 142 },
+  { 'a', 30, 64 }, { 'r', 29, 206 }, { 'f', 36, 0 }, { 'r', 30, 107 }, { 'a', 36, 64 }, { 'r', 29, 278 },
+  { 'r', 36, 169 }, { 'r', 30, 220 }, { 'a', 7, 96 }, { 'r', 36, 231 }, { 'f', 26, 0 }, { 'a', 26, 108 },
+  { 'f', 6, 0 }, { 'f', 14, 0 }, { 'r', 36, 313 }, { 'f', 26, 0 }, { 'a', 26, 664 }, { 'f', 29, 0 },
+  { 'r', 36, 419 }, { 'f', 30, 0 }, { 'f', 7, 0 }, { 'a', 7, 40 }, { 'a', 30, 48 }, { 'a', 29, 48 },
+  { 'f', 30, 0 }, { 'f', 21, 0 }, { 'a', 21, 104 }, { 'f', 7, 0 }, { 'f', 27, 0 }, { 'f', 36, 0 },
+  { 'a', 36, 36 }, { 'f', 36, 0 }, { 'f', 26, 0 }, { 'f', 21, 0 }, { 'a', 21, 572 }, { 'a', 26, 44 },
+  { 'f', 21, 0 }, { 'f', 26, 0 }, { 'a', 26, 124 }, { 'f', 26, 0 }, { 'a', 26, 100 }, { 'a', 21, 104 },
+  { 'a', 36, 28 }, { 'f', 26, 0 }, { 'f', 21, 0 }, { 'a', 21, 108 }, { 'a', 26, 104 }, { 'f', 36, 0 },
+  { 'f', 21, 0 }, { 'a', 21, 620 }, { 'f', 26, 0 }, { 'a', 26, 96 }, { 'a', 36, 124 }, { 'f', 36, 0 },
+  { 'a', 36, 60 }, { 'f', 21, 0 }, { 'f', 26, 0 }, { 'a', 26, 64 }, { 'r', 26, 173 }, { 'a', 21, 64 },
+  { 'r', 26, 228 }, { 'r', 21, 104 }, { 'a', 27, 28 }, { 'r', 26, 292 }, { 'r', 21, 224 }, { 'f', 36, 0 },
+  { 'a', 36, 48 }, { 'r', 26, 334 }, { 'r', 21, 323 }, { 'a', 7, 128 }, { 'r', 21, 447 }, { 'f', 27, 0 },
+  { 'f', 7, 0 }, { 'f', 21, 0 }, { 'a', 21, 64 }, { 'r', 21, 160 }, { 'a', 7, 104 }, { 'f', 26, 0 },
+  { 'f', 7, 0 }, { 'a', 7, 64 }, { 'r', 7, 108 }, { 'a', 26, 92 }, { 'r', 7, 230 }, { 'f', 17, 0 },
+  { 'f', 26, 0 }, { 'a', 26, 528 }, { 'r', 7, 291 }, { 'a', 17, 88 }, { 'r', 7, 411 }, { 'f', 21, 0 },
+  { 'a', 21, 52 }, { 'f', 28, 0 }, { 'a', 28, 128 }, { 'f', 26, 0 }, { 'f', 17, 0 }, { 'a', 17, 60 },
+  { 'a', 26, 44 }, { 'f', 28, 0 }, { 'a', 28, 92 }, { 'f', 7, 0 }, { 'f', 17, 0 }, { 'a', 17, 64 },
+  { 'r', 17, 187 }, { 'a', 7, 128 }, { 'r', 17, 262 }, { 'f', 28, 0 }, { 'a', 28, 64 }, { 'r', 17, 321 },
+  { 'r', 28, 171 }, { 'a', 27, 116 }, { 'f', 7, 0 }, { 'r', 28, 242 }, { 'f', 27, 0 }, { 'a', 27, 44 },
+  { 'f', 15, 0 }, { 'a', 15, 644 }, { 'a', 7, 88 }, { 'f', 11, 0 }, { 'f', 17, 0 }, { 'f', 28, 0 },
+  { 'f', 7, 0 }, { 'a', 7, 48 }, { 'f', 15, 0 }, { 'a', 15, 108 }, { 'a', 28, 92 }, { 'f', 15, 0 },
+  { 'a', 15, 64 }, { 'r', 15, 166 }, { 'a', 17, 116 }, { 'r', 15, 211 }, { 'a', 11, 112 }, { 'r', 15, 337 },
+  { 'f', 28, 0 }, { 'f', 17, 0 }, { 'f', 11, 0 }, { 'a', 11, 124 }, { 'a', 17, 52 }, { 'f', 42, 0 },
+  { 'a', 42, 48 }, { 'a', 28, 64 }, { 'f', 11, 0 }, { 'r', 28, 182 }, { 'a', 11, 56 }, { 'f', 15, 0 },
+  { 'f', 11, 0 }, { 'r', 28, 299 }, { 'a', 11, 996 }, { 'r', 28, 333 }, { 'a', 15, 28 }, { 'a', 30, 112 },
+  { 'f', 11, 0 }, { 'a', 11, 72 }, { 'a', 14, 112 }, { 'f', 23, 0 }, { 'f', 11, 0 }, { 'f', 15, 0 },
+  { 'a', 15, 52 }, { 'f', 10, 0 }, { 'f', 28, 0 }, { 'f', 30, 0 }, { 'a', 30, 952 }, { 'f', 14, 0 },
+  { 'a', 14, 92 }, { 'f', 14, 0 }, { 'a', 14, 128 }, { 'f', 14, 0 }, { 'a', 14, 64 }, { 'r', 14, 113 },
+  { 'a', 28, 44 }, { 'r', 14, 217 }, { 'a', 10, 80 }, { 'r', 14, 281 }, { 'f', 10, 0 }, { 'a', 10, 52 },
+  { 'f', 30, 0 }, { 'r', 14, 374 }, { 'f', 18, 0 }, { 'a', 18, 88 }, { 'a', 30, 880 }, { 'f', 14, 0 },
+  { 'a', 14, 64 }, { 'f', 18, 0 }, { 'a', 18, 64 }, { 'f', 14, 0 }, { 'f', 30, 0 }, { 'a', 30, 828 },
+  { 'a', 14, 48 }, { 'f', 18, 0 }, { 'f', 37, 0 }, { 'a', 37, 108 }, { 'f', 30, 0 }, { 'f', 14, 0 },
+  { 'a', 14, 64 }, { 'r', 14, 118 }, { 'a', 30, 60 }, { 'f', 37, 0 }, { 'r', 14, 172 }, { 'a', 37, 120 },
+  { 'f', 3, 0 }, { 'r', 14, 215 }, { 'a', 3, 108 }, { 'f', 37, 0 }, { 'f', 30, 0 }, { 'a', 30, 112 },
+  { 'f', 3, 0 }, { 'a', 3, 48 }, { 'f', 3, 0 }, { 'a', 3, 64 }, { 'r', 3, 184 }, { 'f', 30, 0 },
+  { 'f', 14, 0 }, { 'a', 14, 100 }, { 'r', 3, 309 }, { 'a', 30, 72 }, { 'r', 3, 380 }, { 'f', 14, 0 },
+  { 'a', 14, 104 }, { 'a', 37, 608 }, { 'f', 30, 0 }, { 'a', 30, 64 }, { 'f', 3, 0 }, { 'r', 30, 134 },
+  { 'a', 3, 96 }, { 'f', 14, 0 }, { 'r', 30, 194 }, { 'f', 37, 0 }, { 'a', 37, 40 }, { 'r', 30, 263 },
+  { 'a', 14, 52 }, { 'r', 30, 380 }, { 'a', 18, 52 }, { 'f', 3, 0 }, { 'f', 37, 0 }, { 'a', 37, 100 },
+  { 'f', 37, 0 }, { 'a', 37, 68 }, { 'f', 37, 0 }, { 'a', 37, 864 }, { 'f', 30, 0 }, { 'a', 30, 120 },
+  { 'f', 30, 0 }, { 'a', 30, 64 }, { 'r', 30, 101 }, { 'a', 3, 28 }, { 'r', 30, 217 }, { 'a', 11, 108 },
+  { 'r', 30, 336 }, { 'f', 3, 0 }, { 'a', 3, 64 }, { 'r', 30, 427 }, { 'r', 3, 133 }, { 'f', 11, 0 },
+  { 'a', 11, 32 }, { 'a', 23, 52 }, { 'f', 11, 0 }, { 'a', 11, 32 }, { 'f', 37, 0 }, { 'f', 33, 0 },
+  { 'a', 33, 96 }, { 'f', 30, 0 }, { 'a', 30, 112 }, { 'f', 11, 0 }, { 'a', 11, 752 }, { 'f', 33, 0 },
+  { 'f', 7, 0 }, { 'f', 30, 0 }, { 'a', 30, 44 }, { 'f', 3, 0 }, { 'a', 3, 64 }, { 'r', 3, 188 },
+  { 'f', 11, 0 }, { 'r', 3, 294 }, { 'f', 35, 0 }, { 'r', 3, 363 }, { 'a', 35, 28 }, { 'f', 35, 0 },
+  { 'r', 3, 428 }, { 'a', 35, 1020 }, { 'f', 29, 0 }, { 'a', 29, 44 }, { 'a', 11, 52 }, { 'f', 3, 0 },
+  { 'f', 34, 0 }, { 'a', 34, 88 }, { 'a', 3, 96 }, { 'f', 35, 0 }, { 'f', 11, 0 }, { 'a', 11, 640 },
+  { 'f', 34, 0 }, { 'a', 34, 92 }, { 'f', 3, 0 }, { 'f', 9, 0 }, { 'a', 9, 56 }, { 'a', 3, 516 },
+  { 'a', 35, 64 }, { 'f', 34, 0 }, { 'r', 35, 106 }, { 'a', 34, 76 }, { 'r', 35, 182 }, { 'a', 7, 96 },
+  { 'f', 11, 0 }, { 'r', 35, 272 }, { 'a', 11, 36 }, { 'f', 3, 0 }, { 'r', 35, 349 }, { 'a', 3, 76 },
+  { 'f', 34, 0 }, { 'f', 7, 0 }, { 'a', 7, 64 }, { 'f', 11, 0 }, { 'r', 7, 111 }, { 'f', 35, 0 },
+  { 'a', 35, 60 }, { 'r', 7, 159 }, { 'a', 11, 28 }, { 'r', 7, 192 }, { 'f', 3, 0 }, { 'f', 11, 0 },
+  { 'a', 11, 64 }, { 'f', 35, 0 }, { 'r', 7, 232 }, { 'r', 11, 115 }, { 'a', 35, 56 }, { 'r', 11, 226 },
+  { 'a', 3, 64 }, { 'r', 11, 344 }, { 'r', 3, 147 }, { 'a', 34, 32 }, { 'r', 3, 197 }, { 'f', 7, 0 },
+  { 'a', 7, 688 }, { 'a', 33, 48 }, { 'f', 0, 0 }, { 'f', 11, 0 }, { 'f', 34, 0 }, { 'a', 34, 128 },
+  { 'f', 3, 0 }, { 'a', 3, 88 }, { 'f', 3, 0 }, { 'f', 33, 0 }, { 'a', 33, 64 }, { 'r', 33, 105 },
+  { 'a', 3, 120 }, { 'f', 34, 0 }, { 'f', 7, 0 }, { 'r', 33, 163 }, { 'a', 7, 84 }, { 'r', 33, 289 },
+  { 'a', 34, 84 }, { 'f', 20, 0 }, { 'f', 3, 0 }, { 'f', 7, 0 }, { 'a', 7, 44 }, { 'f', 7, 0 },
+  { 'f', 34, 0 }, { 'a', 34, 56 }, { 'a', 7, 48 }, { 'f', 39, 0 }, { 'f', 34, 0 }, { 'f', 15, 0 },
+  { 'f', 35, 0 }, { 'f', 30, 0 }, { 'f', 42, 0 }, { 'f', 16, 0 }, { 'f', 7, 0 }, { 'f', 29, 0 },
+  { 'f', 21, 0 }, { 'f', 2, 0 }, { 'f', 9, 0 }, { 'f', 14, 0 }, { 'f', 8, 0 }, { 'f', 36, 0 },
+  { 'f', 33, 0 }, { 'f', 27, 0 }, { 'f', 26, 0 }, { 'f', 28, 0 }, { 'f', 17, 0 }, { 'f', 4, 0 },
+  { 'f', 12, 0 }, { 'f', 25, 0 }, { 'f', 32, 0 }, { 'f', 1, 0 }, { 'f', 10, 0 }, { 'f', 18, 0 },
+  { 'f', 23, 0 },
+};
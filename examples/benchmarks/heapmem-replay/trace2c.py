@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived
+#    from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+# COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+# HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+# STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+# OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Convert a heapmem trace to the C header used by the heapmem replay
+benchmark. The trace is the output of an application built with
+HEAPMEM_DEBUG=1 and HEAPMEM_CONF_TRACE=1. Every pointer in the trace is
+mapped to a slot, and slots are reused once their chunk has been freed.
+
+Usage: trace2c.py [trace file] > heapmem-trace.h
+
+Reads standard input when no trace file is given. Lines that are not
+heapmem trace lines are ignored.
+"""
+
+import re
+import sys
+
+TRACE_LINE = re.compile(r'heapmem: ([arf]) (.*) (\S+:\d+)\s*$')
+
+
+def is_null(ptr):
+    return ptr in ('(nil)', 'NULL', '0', '0x0')
+
+
+class SlotMap:
+    def __init__(self):
+        self.slots = {}
+        self.unused = []
+        self.count = 0
+
+    def add(self, ptr):
+        if self.unused:
+            slot = self.unused.pop()
+        else:
+            slot = self.count
+            self.count += 1
+        self.slots[ptr] = slot
+        return slot
+
+    def remove(self, ptr):
+        slot = self.slots.pop(ptr)
+        self.unused.append(slot)
+        return slot
+
+
+def convert(lines):
+    slots = SlotMap()
+    ops = []
+
+    for line in lines:
+        match = TRACE_LINE.search(line)
+        if match is None:
+            continue
+        op, args, _ = match.groups()
+        args = args.split()
+
+        if op == 'a':
+            ptr, size = args[0], int(args[1])
+            if not is_null(ptr):
+                ops.append(('a', slots.add(ptr), size))
+        elif op == 'f':
+            ptr = args[0]
+            # Chunks allocated before the trace started are skipped.
+            if ptr in slots.slots:
+                ops.append(('f', slots.remove(ptr), 0))
+        elif op == 'r':
+            old, new, size = args[0], args[1], int(args[2])
+            if is_null(old):
+                if not is_null(new):
+                    ops.append(('a', slots.add(new), size))
+            elif old not in slots.slots:
+                continue
+            elif size == 0:
+                ops.append(('f', slots.remove(old), 0))
+            elif not is_null(new):
+                slot = slots.remove(old)
+                ops.append(('r', slot, size))
+                slots.unused.remove(slot)
+                slots.slots[new] = slot
+
+    return ops, slots.count
+
+
+def main():
+    if len(sys.argv) > 1:
+        with open(sys.argv[1]) as f:
+            ops, count = convert(f)
+    else:
+        ops, count = convert(sys.stdin)
+
+    print('/* Generated by trace2c.py -- do not edit. */')
+    print('#define HEAPMEM_TRACE_SLOTS %d' % max(count, 1))
+    print('static const struct heapmem_trace_op heapmem_trace[] = {')
+    for i in range(0, len(ops), 6):
+        print('  ' + ' '.join("{ '%s', %d, %d }," % op
+                              for op in ops[i:i + 6]))
+    print('};')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Measures JSON parsing and serialization on the native platform:
+ *         jsonparse against the jsontok tokenizer, fed whole and in
+ *         chunks, and jsontree and snprintf() against jsonwriter.
+ */
+
+#include "contiki.h"
+#include "lib/crc32c.h"
+#include "lib/json/jsonparse.h"
+#include "lib/json/jsontok.h"
+#include "lib/json/jsontree.h"
+#include "lib/json/jsonwriter.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+/*---------------------------------------------------------------------------*/
+#define PARSE_RUNS      2000
+#define WRITE_RUNS      200000
+#define ENTRIES         40
+#define CHUNK_SIZE      64
+
+static char document[4096];
+static uint16_t document_len;
+static char payload[256];
+static uint16_t payload_pos;
+/*---------------------------------------------------------------------------*/
+PROCESS(json_throughput_process, "JSON throughput");
+AUTOSTART_PROCESSES(&json_throughput_process);
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+/* A SenML pack like those of LwM2M JSON, with escapes in some strings */
+static void
+write_document(void)
+{
+  struct jsonwriter w;
+  char name[24];
+  int i;
+
+  jsonwriter_init(&w, document, sizeof(document));
+  jsonwriter_object_begin(&w);
+  jsonwriter_name(&w, "bn");
+  jsonwriter_string(&w, "urn:dev:ow:10e2073a01080063/");
+  jsonwriter_name(&w, "bt");
+  jsonwriter_uint(&w, 1276020076);
+  jsonwriter_name(&w, "e");
+  jsonwriter_array_begin(&w);
+  for(i = 0; i < ENTRIES; i++) {
+    snprintf(name, sizeof(name), "3303/%d/5700", i);
+    jsonwriter_object_begin(&w);
+    jsonwriter_name(&w, "n");
+    jsonwriter_string(&w, name);
+    switch(i % 4) {
+    case 0:
+      jsonwriter_name(&w, "v");
+      jsonwriter_int(&w, -2300 + i * 37);
+      break;
+    case 1:
+      jsonwriter_name(&w, "sv");
+      jsonwriter_string(&w, "line 1\nline 2 \"quoted\" \\ \x01");
+      break;
+    case 2:
+      jsonwriter_name(&w, "bv");
+      jsonwriter_bool(&w, i & 4);
+      break;
+    default:
+      jsonwriter_name(&w, "v");
+      jsonwriter_raw(&w, "21.75", 5);
+      jsonwriter_name(&w, "u");
+      jsonwriter_null(&w);
+      break;
+    }
+    jsonwriter_object_end(&w);
+  }
+  jsonwriter_array_end(&w);
+  jsonwriter_object_end(&w);
+
+  if(jsonwriter_overflow(&w)) {
+    printf("document does not fit\n");
+    exit(1);
+  }
+  document_len = jsonwriter_len(&w);
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Tokenizes the document in chunks of chunk_size bytes and returns a
+ * CRC over the token types and decoded strings, or 0 on an error. The
+ * CRC does not depend on how strings are split into fragments.
+ */
+static uint32_t
+tokenize(uint16_t chunk_size, int decode)
+{
+  struct jsontok_state state;
+  struct jsontok_token token;
+  char decoded[64];
+  uint16_t offset;
+  uint16_t len;
+  uint32_t crc;
+  int n;
+  int r;
+
+  jsontok_init(&state);
+  crc = 0;
+  offset = 0;
+  len = MIN(chunk_size, document_len);
+  jsontok_feed(&state, document, len, len == document_len);
+  for(;;) {
+    r = jsontok_next(&state, &token);
+    if(r == JSONTOK_TOKEN) {
+      if(decode) {
+        if(token.type == JSON_TYPE_STRING ||
+           token.type == JSON_TYPE_PAIR_NAME) {
+          n = jsontok_copy_string(&token, decoded, sizeof(decoded));
+          if(n < 0) {
+            return 0;
+          }
+          crc = crc32c_data((unsigned char *)decoded, n, crc);
+        } else {
+          crc = crc32c_data((const unsigned char *)token.value,
+                            token.len, crc);
+        }
+        if(!(token.flags & JSONTOK_FLAG_PARTIAL)) {
+          crc = crc32c_data((unsigned char *)&token.type, 1, crc);
+        }
+      } else {
+        crc++;
+      }
+    } else if(r == JSONTOK_NEED_MORE) {
+      offset += len;
+      len = MIN(chunk_size, document_len - offset);
+      jsontok_feed(&state, document + offset, len,
+                   offset + len == document_len);
+    } else if(r == JSONTOK_DONE) {
+      return crc;
+    } else {
+      return 0;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static int
+check_tokenizer(void)
+{
+  static const char *const bad[] = {
+    "{\"a\":1,}", "[1 2]", "{\"a\" 1}", "[tru]", "{\"a\":\"x\n\"}",
+    "[1]]", "{1:2}", "[\"abc", "{\"a\":[}",
+  };
+  struct jsontok_state state;
+  struct jsontok_token token;
+  uint32_t crc;
+  uint16_t size;
+  unsigned i;
+  int r;
+
+  crc = tokenize(document_len, 1);
+  if(crc == 0) {
+    return 0;
+  }
+  /* every split must give the same tokens */
+  for(size = 1; size < 100; size++) {
+    if(tokenize(size, 1) != crc) {
+      printf("chunk size %u differs\n", size);
+      return 0;
+    }
+  }
+
+  for(i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+    jsontok_init(&state);
+    jsontok_feed(&state, bad[i], strlen(bad[i]), 1);
+    while((r = jsontok_next(&state, &token)) == JSONTOK_TOKEN);
+    if(r != JSONTOK_ERROR) {
+      printf("accepted %s\n", bad[i]);
+      return 0;
+    }
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long
+run_jsonparse(void)
+{
+  struct jsonparse_state state;
+  unsigned long tokens;
+  uint64_t start;
+  int i;
+
+  tokens = 0;
+  start = now_ns();
+  for(i = 0; i < PARSE_RUNS; i++) {
+    jsonparse_setup(&state, document, document_len);
+    while(jsonparse_next(&state) != JSON_TYPE_ERROR) {
+      tokens++;
+    }
+  }
+  if(tokens == 0) {
+    return 0;
+  }
+  return (uint64_t)document_len * PARSE_RUNS * 1000 / (now_ns() - start);
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long
+run_jsontok(uint16_t chunk_size)
+{
+  uint64_t start;
+  int i;
+
+  start = now_ns();
+  for(i = 0; i < PARSE_RUNS; i++) {
+    if(tokenize(chunk_size, 0) == 0) {
+      return 0;
+    }
+  }
+  return (uint64_t)document_len * PARSE_RUNS * 1000 / (now_ns() - start);
+}
+/*---------------------------------------------------------------------------*/
+/* The payload of examples/mqtt-client, written three ways */
+static struct jsontree_string tree_platform = JSONTREE_STRING("native");
+static struct jsontree_int tree_seq = { JSON_TYPE_INT, 0 };
+static struct jsontree_uint tree_uptime = { JSON_TYPE_UINT, 0 };
+static struct jsontree_string tree_route =
+  JSONTREE_STRING("fe80::212:4b00:615:a4cb");
+static struct jsontree_int tree_rssi = { JSON_TYPE_INT, 0 };
+
+JSONTREE_OBJECT(tree_d,
+                JSONTREE_PAIR("Platform", &tree_platform),
+                JSONTREE_PAIR("Seq #", &tree_seq),
+                JSONTREE_PAIR("Uptime (sec)", &tree_uptime),
+                JSONTREE_PAIR("Def Route", &tree_route),
+                JSONTREE_PAIR("RSSI (dBm)", &tree_rssi));
+JSONTREE_OBJECT(tree_root,
+                JSONTREE_PAIR("d", &tree_d));
+
+static int
+payload_putchar(int c)
+{
+  if(payload_pos < sizeof(payload) - 1) {
+    payload[payload_pos++] = c;
+  }
+  return c;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long
+write_jsontree(int seq)
+{
+  struct jsontree_context ctx;
+
+  tree_seq.value = seq;
+  tree_uptime.value = seq * 60;
+  tree_rssi.value = -seq % 90;
+  payload_pos = 0;
+  jsontree_setup(&ctx, (struct jsontree_value *)&tree_root, payload_putchar);
+  while(jsontree_print_next(&ctx));
+  payload[payload_pos] = '\0';
+  return payload_pos;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long
+write_snprintf(int seq)
+{
+  return snprintf(payload, sizeof(payload),
+                  "{\"d\":{\"Platform\":\"%s\",\"Seq #\":%d,"
+                  "\"Uptime (sec)\":%lu,\"Def Route\":\"%s\","
+                  "\"RSSI (dBm)\":%d}}",
+                  "native", seq, (unsigned long)seq * 60,
+                  "fe80::212:4b00:615:a4cb", -seq % 90);
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long
+write_jsonwriter(int seq)
+{
+  struct jsonwriter w;
+
+  jsonwriter_init(&w, payload, sizeof(payload));
+  jsonwriter_object_begin(&w);
+  jsonwriter_name(&w, "d");
+  jsonwriter_object_begin(&w);
+  jsonwriter_name(&w, "Platform");
+  jsonwriter_string(&w, "native");
+  jsonwriter_name(&w, "Seq #");
+  jsonwriter_int(&w, seq);
+  jsonwriter_name(&w, "Uptime (sec)");
+  jsonwriter_uint(&w, (unsigned long)seq * 60);
+  jsonwriter_name(&w, "Def Route");
+  jsonwriter_string(&w, "fe80::212:4b00:615:a4cb");
+  jsonwriter_name(&w, "RSSI (dBm)");
+  jsonwriter_int(&w, -seq % 90);
+  jsonwriter_object_end(&w);
+  jsonwriter_object_end(&w);
+  return jsonwriter_len(&w);
+}
+/*---------------------------------------------------------------------------*/
+/* Returns ns per payload */
+static unsigned long
+run_writer(unsigned long (*write)(int))
+{
+  unsigned long bytes;
+  uint64_t start;
+  int i;
+
+  bytes = 0;
+  start = now_ns();
+  for(i = 0; i < WRITE_RUNS; i++) {
+    bytes += write(i);
+  }
+  return bytes ? (now_ns() - start) / WRITE_RUNS : 0;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(json_throughput_process, ev, data)
+{
+  char expected[sizeof(payload)];
+
+  PROCESS_BEGIN();
+
+  write_document();
+  if(!check_tokenizer()) {
+    printf("jsontok check failed\n");
+    exit(1);
+  }
+
+  /* all three writers must produce the same payload */
+  write_snprintf(1234);
+  strcpy(expected, payload);
+  write_jsonwriter(1234);
+  if(strcmp(payload, expected) != 0) {
+    printf("jsonwriter: %s\n", payload);
+    exit(1);
+  }
+  write_jsontree(1234);
+  if(strcmp(payload, expected) != 0) {
+    printf("jsontree: %s\n", payload);
+    exit(1);
+  }
+
+  printf("parse a %u-byte document (MB/s)\n", document_len);
+  printf("  jsonparse:             %lu\n", run_jsonparse());
+  printf("  jsontok:               %lu\n", run_jsontok(document_len));
+  printf("  jsontok, %u-byte chunks: %lu\n", CHUNK_SIZE,
+         run_jsontok(CHUNK_SIZE));
+  printf("write a %u-byte MQTT payload (ns)\n",
+         (unsigned)strlen(expected));
+  printf("  jsontree:   %lu\n", run_writer(write_jsontree));
+  printf("  snprintf:   %lu\n", run_writer(write_snprintf));
+  printf("  jsonwriter: %lu\n", run_writer(write_jsonwriter));
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *         Compares the cost of appending to a list with list_add() and
+ *         with tail_list_add(), for queues of increasing depth.
+ */
+
+#include "contiki.h"
+#include "lib/list.h"
+#include "lib/tail-list.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+/*---------------------------------------------------------------------------*/
+#define MAX_DEPTH       4096
+#define OPERATIONS      20000
+
+static const uint16_t depths[] = { 1, 16, 64, 256, 1024, 4096 };
+
+struct item {
+  struct item *next;
+};
+
+static struct item items[MAX_DEPTH + 1];
+
+LIST(list);
+TAIL_LIST(tail_list);
+/*---------------------------------------------------------------------------*/
+PROCESS(list_append_process, "list append benchmark");
+AUTOSTART_PROCESSES(&list_append_process);
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Both functions keep the queue at the given depth, and measure the
+ * average cost of enqueueing the spare item and dequeueing the head,
+ * which becomes the next spare item.
+ */
+static unsigned long
+run_list(unsigned depth)
+{
+  struct item *spare;
+  uint64_t start;
+  unsigned i;
+
+  list_init(list);
+  for(i = 0; i < depth; i++) {
+    list_add(list, &items[i]);
+  }
+  spare = &items[depth];
+
+  start = now_ns();
+  for(i = 0; i < OPERATIONS; i++) {
+    list_add(list, spare);
+    spare = list_pop(list);
+  }
+
+  return (now_ns() - start) / OPERATIONS;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned long
+run_tail_list(unsigned depth)
+{
+  struct item *spare;
+  uint64_t start;
+  unsigned i;
+
+  tail_list_init(tail_list);
+  for(i = 0; i < depth; i++) {
+    tail_list_add(tail_list, &items[i]);
+  }
+  spare = &items[depth];
+
+  start = now_ns();
+  for(i = 0; i < OPERATIONS; i++) {
+    tail_list_add(tail_list, spare);
+    spare = tail_list_pop(tail_list);
+  }
+
+  return (now_ns() - start) / OPERATIONS;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(list_append_process, ev, data)
+{
+  unsigned i;
+
+  PROCESS_BEGIN();
+
+  printf(" depth  list_add(ns)  tail_list_add(ns)\n");
+  for(i = 0; i < sizeof(depths) / sizeof(depths[0]); i++) {
+    printf("%6u %13lu", depths[i], run_list(depths[i]));
+    printf(" %18lu\n", run_tail_list(depths[i]));
+  }
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Measures neighbor lookups and the recycling of neighbors in a
+ *         full table on the native platform. Build with NEIGHBORS=<n>
+ *         to set the table size, and with INDEX=off for the linear
+ *         scans.
+ */
+
+#include "contiki.h"
+#include "net/nbr-table.h"
+#include "lib/random.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+/*---------------------------------------------------------------------------*/
+#define LOOKUPS   2000000UL
+#define INSERTS   200000UL
+
+struct entry {
+  uint16_t value;
+};
+
+/* Like the IPv6 neighbor cache, the link statistics and the RPL parents:
+ * every neighbor is in the first table, every fourth is also in the
+ * second one, and a few are locked in the third one. */
+NBR_TABLE(struct entry, first);
+NBR_TABLE(struct entry, second);
+NBR_TABLE(struct entry, third);
+
+static uint32_t next_id;
+/*---------------------------------------------------------------------------*/
+PROCESS(nbr_table_lookup_process, "Neighbor table lookup");
+AUTOSTART_PROCESSES(&nbr_table_lookup_process);
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+/* Link-layer addresses that share a prefix, as in a real network */
+static void
+make_lladdr(linkaddr_t *lladdr, uint32_t id)
+{
+  memset(lladdr, 0, sizeof(*lladdr));
+  lladdr->u8[0] = 0x02;
+  lladdr->u8[1] = 0x12;
+  lladdr->u8[LINKADDR_SIZE - 3] = id >> 16;
+  lladdr->u8[LINKADDR_SIZE - 2] = id >> 8;
+  lladdr->u8[LINKADDR_SIZE - 1] = id;
+}
+/*---------------------------------------------------------------------------*/
+static struct entry *
+add(uint32_t id)
+{
+  linkaddr_t lladdr;
+  struct entry *e;
+
+  make_lladdr(&lladdr, id);
+  e = nbr_table_add_lladdr(first, &lladdr, NBR_TABLE_REASON_UNDEFINED, NULL);
+  if(e != NULL) {
+    e->value = id;
+    if(id % 4 == 0) {
+      nbr_table_add_lladdr(second, &lladdr, NBR_TABLE_REASON_UNDEFINED, NULL);
+    }
+  }
+  return e;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(nbr_table_lookup_process, ev, data)
+{
+  static linkaddr_t locked[4];
+  linkaddr_t lladdr;
+  struct entry *e;
+  unsigned long i, found;
+  uint64_t start, lookup_ns, miss_ns, insert_ns;
+
+  PROCESS_BEGIN();
+
+  nbr_table_register(first, NULL);
+  nbr_table_register(second, NULL);
+  nbr_table_register(third, NULL);
+
+  for(next_id = 1; next_id <= NBR_TABLE_MAX_NEIGHBORS; next_id++) {
+    add(next_id);
+  }
+  for(i = 0; i < 4; i++) {
+    make_lladdr(&locked[i], i * 3 + 1);
+    nbr_table_lock(third, nbr_table_add_lladdr(third, &locked[i],
+                                               NBR_TABLE_REASON_UNDEFINED,
+                                               NULL));
+  }
+
+  /* Lookups of present neighbors */
+  found = 0;
+  start = now_ns();
+  for(i = 0; i < LOOKUPS; i++) {
+    make_lladdr(&lladdr, 1 + random_rand() % NBR_TABLE_MAX_NEIGHBORS);
+    e = nbr_table_get_from_lladdr(first, &lladdr);
+    found += e != NULL && e->value == lladdr.u8[LINKADDR_SIZE - 1] +
+      (lladdr.u8[LINKADDR_SIZE - 2] << 8);
+  }
+  lookup_ns = (now_ns() - start) / LOOKUPS;
+
+  /* Lookups of unknown neighbors */
+  start = now_ns();
+  for(i = 0; i < LOOKUPS; i++) {
+    make_lladdr(&lladdr, 0x10000 + random_rand());
+    found += nbr_table_get_from_lladdr(first, &lladdr) != NULL;
+  }
+  miss_ns = (now_ns() - start) / LOOKUPS;
+
+  /* New neighbors in a full table: each one replaces another */
+  start = now_ns();
+  for(i = 0; i < INSERTS; i++) {
+    add(next_id++);
+  }
+  insert_ns = (now_ns() - start) / INSERTS;
+
+  printf("Neighbors: %u, index: %s, found: %lu\n", NBR_TABLE_MAX_NEIGHBORS,
+         NBR_TABLE_WITH_INDEX ? "on" : "off", found);
+  printf("lookup: %lu ns, miss: %lu ns, replacement: %lu ns\n",
+         (unsigned long)lookup_ns, (unsigned long)miss_ns,
+         (unsigned long)insert_ns);
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
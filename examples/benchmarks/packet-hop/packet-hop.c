@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Measures the MAC layer cost of one hop on the native platform:
+ *         a packet is put in the packetbuf, queued, and then framed and
+ *         handed to the radio once per transmission attempt, the way
+ *         CSMA does it. Build with DESCRIPTORS=off to measure the
+ *         copying packetbuf and queuebuf.
+ */
+
+#include "contiki.h"
+#include "net/packetbuf.h"
+#include "net/queuebuf.h"
+#include "net/mac/framer/framer-802154.h"
+#include "lib/random.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CYCLES() __rdtsc()
+#else
+#define CYCLES() 0
+#endif
+/*---------------------------------------------------------------------------*/
+#define HOPS           200000UL
+/* Packets queued before the first one is sent */
+#define QUEUE_DEPTH    4
+
+static const uint16_t sizes[] = { 40, 80, 100 };
+static const uint8_t attempts[] = { 1, 3 };
+
+static uint8_t payload[PACKETBUF_SIZE];
+static uint8_t radio_fifo[PACKETBUF_SIZE];
+static linkaddr_t receiver = { { 1, 2, 3, 4, 5, 6, 7, 8 } };
+/*---------------------------------------------------------------------------*/
+PROCESS(packet_hop_process, "Packet hop");
+AUTOSTART_PROCESSES(&packet_hop_process);
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+/* What the upper layer does: fill the packetbuf and hand it to the MAC,
+   which queues it */
+static struct queuebuf *
+enqueue(uint16_t size, uint8_t seqno)
+{
+  packetbuf_clear();
+  memcpy(packetbuf_dataptr(), payload, size);
+  packetbuf_set_datalen(size);
+  packetbuf_set_addr(PACKETBUF_ADDR_RECEIVER, &receiver);
+  packetbuf_set_attr(PACKETBUF_ATTR_MAC_SEQNO, seqno);
+  packetbuf_set_attr(PACKETBUF_ATTR_FRAME_TYPE, FRAME802154_DATAFRAME);
+  return queuebuf_new_from_packetbuf();
+}
+/*---------------------------------------------------------------------------*/
+/* What the MAC does for each transmission attempt */
+static void
+transmit(struct queuebuf *q)
+{
+  queuebuf_to_packetbuf_view(q);
+  packetbuf_set_addr(PACKETBUF_ADDR_SENDER, &linkaddr_node_addr);
+  packetbuf_set_attr(PACKETBUF_ATTR_MAC_ACK, 1);
+  if(framer_802154.create() >= 0) {
+    memcpy(radio_fifo, packetbuf_hdrptr(), packetbuf_totlen());
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+run(uint16_t size, uint8_t tx, uint64_t *ns, uint64_t *cycles)
+{
+  struct queuebuf *q[QUEUE_DEPTH];
+  uint64_t start_ns, start_cycles;
+  unsigned long hop;
+  int i, j;
+
+  start_ns = now_ns();
+  start_cycles = CYCLES();
+  for(hop = 0; hop < HOPS; hop += QUEUE_DEPTH) {
+    for(i = 0; i < QUEUE_DEPTH; i++) {
+      q[i] = enqueue(size, i + 1);
+    }
+    for(i = 0; i < QUEUE_DEPTH; i++) {
+      for(j = 0; j < tx; j++) {
+        transmit(q[i]);
+      }
+      queuebuf_free(q[i]);
+    }
+  }
+  *cycles = (CYCLES() - start_cycles) / HOPS;
+  *ns = (now_ns() - start_ns) / HOPS;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(packet_hop_process, ev, data)
+{
+  uint64_t ns, cycles;
+  unsigned i, j;
+
+  PROCESS_BEGIN();
+
+  for(i = 0; i < sizeof(payload); i++) {
+    payload[i] = random_rand();
+  }
+
+  printf("Packet descriptors: %s\n",
+         PACKETBUF_WITH_DESCRIPTORS ? "on" : "off");
+  printf(" bytes  attempts  ns/hop  cycles/hop\n");
+  for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    for(j = 0; j < sizeof(attempts); j++) {
+      run(sizes[i], attempts[j], &ns, &cycles);
+      printf("%6u %9u %7lu %11lu\n", sizes[i], attempts[j],
+             (unsigned long)ns, (unsigned long)cycles);
+    }
+  }
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Counts how many frames of a typical traffic mix the queuebuf
+ *         pool holds before it drops one, on the native platform.
+ *         Build with CLASSES=off for full-size queuebufs and with
+ *         CLASSES=on for size classes taking about the same RAM.
+ */
+
+#include "contiki.h"
+#include "net/packetbuf.h"
+#include "net/queuebuf.h"
+#include "lib/random.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+/*---------------------------------------------------------------------------*/
+#define TRIALS 20000
+
+/* Payload lengths handed to the MAC, in percent of the frames */
+struct mix_entry {
+  uint8_t percent;
+  uint8_t min;
+  uint8_t max;
+  const char *name;
+};
+
+static const struct mix_entry mix[] = {
+  { 30, 30, 50, "UDP/CoAP sensor reports" },
+  { 15, 20, 40, "ND and small ICMPv6" },
+  { 20, 50, 80, "RPL DIO/DAO" },
+  { 10, 0, 20, "keepalives and EBs" },
+  { 25, 90, 102, "6LoWPAN fragments" },
+};
+
+static struct queuebuf *queued[QUEUEBUF_NUM];
+static uint16_t lengths[QUEUEBUF_NUM];
+/*---------------------------------------------------------------------------*/
+PROCESS(queuebuf_mix_process, "Queuebuf mix");
+AUTOSTART_PROCESSES(&queuebuf_mix_process);
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+static uint16_t
+draw_length(void)
+{
+  unsigned i, p;
+
+  p = random_rand() % 100;
+  for(i = 0; i < sizeof(mix) / sizeof(mix[0]) - 1; i++) {
+    if(p < mix[i].percent) {
+      break;
+    }
+    p -= mix[i].percent;
+  }
+  return mix[i].min + random_rand() % (mix[i].max - mix[i].min + 1);
+}
+/*---------------------------------------------------------------------------*/
+static struct queuebuf *
+enqueue(uint16_t len, uint8_t fill)
+{
+  packetbuf_clear();
+  memset(packetbuf_dataptr(), fill, len);
+  packetbuf_set_datalen(len);
+  packetbuf_set_attr(PACKETBUF_ATTR_MAC_SEQNO, fill);
+  return queuebuf_new_from_packetbuf();
+}
+/*---------------------------------------------------------------------------*/
+/* Queues frames until one is dropped, checks them and frees them.
+   Returns the number of frames that were queued. */
+static int
+fill(uint16_t fixed_len)
+{
+  int n, i;
+
+  for(n = 0; n < QUEUEBUF_NUM; n++) {
+    lengths[n] = fixed_len ? fixed_len : draw_length();
+    queued[n] = enqueue(lengths[n], n + 1);
+    if(queued[n] == NULL) {
+      break;
+    }
+  }
+  for(i = 0; i < n; i++) {
+    const uint8_t *data = queuebuf_dataptr(queued[i]);
+    if(queuebuf_datalen(queued[i]) != lengths[i] ||
+       queuebuf_attr(queued[i], PACKETBUF_ATTR_MAC_SEQNO) != i + 1 ||
+       (lengths[i] > 0 &&
+        (data[0] != i + 1 || data[lengths[i] - 1] != i + 1))) {
+      printf("queuebuf %d corrupted\n", i);
+      exit(1);
+    }
+    queuebuf_free(queued[i]);
+  }
+  return n;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(queuebuf_mix_process, ev, data)
+{
+  unsigned long total;
+  int i, n, min;
+  uint64_t start;
+
+  PROCESS_BEGIN();
+
+  printf("Size classes: %s, %u queuebufs\n",
+         QUEUEBUF_WITH_SIZE_CLASSES ? "on" : "off", QUEUEBUF_NUM);
+
+  total = 0;
+  min = QUEUEBUF_NUM;
+  start = now_ns();
+  for(i = 0; i < TRIALS; i++) {
+    n = fill(0);
+    total += n;
+    if(n < min) {
+      min = n;
+    }
+  }
+  printf("mix: %lu.%02lu frames queued on average, %d at least, "
+         "%lu ns per frame\n",
+         total / TRIALS, total * 100 / TRIALS % 100, min,
+         (unsigned long)((now_ns() - start) / total));
+  printf("40-byte frames: %d queued\n", fill(40));
+  printf("102-byte frames: %d queued\n", fill(102));
+
+  if(queuebuf_numfree() != QUEUEBUF_NUM) {
+    printf("queuebufs leaked\n");
+    exit(1);
+  }
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *         Measures how accurately the native rtimer fires, with the
+ *         timing pattern of TSCH slot operation: a timer at the start of
+ *         every 10 ms timeslot, a second one at the Tx offset, followed
+ *         by a busy-wait for the duration of a full-size frame.
+ */
+
+#include "contiki.h"
+#include "sys/rtimer.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+/*---------------------------------------------------------------------------*/
+#define SLOT_DURATION   US_TO_RTIMERTICKS(10000)
+#define TX_OFFSET       US_TO_RTIMERTICKS(2120)
+/* 127 bytes and the PHY header at 32 us per byte */
+#define FRAME_DURATION  US_TO_RTIMERTICKS(130 * 32)
+#define NUM_SLOTS       500
+
+static struct rtimer timer;
+static rtimer_clock_t slot_start;
+static unsigned slots;
+static unsigned long busywait_total;
+static unsigned long busywait_max;
+/*---------------------------------------------------------------------------*/
+PROCESS(rtimer_jitter_process, "rtimer jitter");
+AUTOSTART_PROCESSES(&rtimer_jitter_process);
+/*---------------------------------------------------------------------------*/
+static void slot_begin(struct rtimer *t, void *ptr);
+/*---------------------------------------------------------------------------*/
+static void
+slot_tx(struct rtimer *t, void *ptr)
+{
+  rtimer_clock_t end = slot_start + TX_OFFSET + FRAME_DURATION;
+  unsigned long overshoot;
+
+  /* As when waiting for the end of a transmission */
+  RTIMER_BUSYWAIT_UNTIL_ABS(0, slot_start + TX_OFFSET, FRAME_DURATION);
+  overshoot = RTIMER_CLOCK_DIFF(RTIMER_NOW(), end);
+  busywait_total += overshoot;
+  if(overshoot > busywait_max) {
+    busywait_max = overshoot;
+  }
+
+  slot_start += SLOT_DURATION;
+  if(++slots < NUM_SLOTS) {
+    rtimer_set(t, slot_start, 0, slot_begin, NULL);
+  } else {
+    process_poll(&rtimer_jitter_process);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+slot_begin(struct rtimer *t, void *ptr)
+{
+  rtimer_set(t, slot_start + TX_OFFSET, 0, slot_tx, NULL);
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(rtimer_jitter_process, ev, data)
+{
+  const struct rtimer_arch_jitter *jitter;
+  unsigned i;
+
+  PROCESS_BEGIN();
+
+  printf("RTIMER_SECOND %lu, %u slots of %lu us\n",
+         (unsigned long)RTIMER_SECOND, NUM_SLOTS,
+         (unsigned long)SLOT_DURATION);
+
+  rtimer_arch_jitter_reset();
+  slot_start = RTIMER_NOW() + SLOT_DURATION;
+  rtimer_set(&timer, slot_start, 0, slot_begin, NULL);
+
+  PROCESS_WAIT_EVENT_UNTIL(ev == PROCESS_EVENT_POLL);
+
+  jitter = rtimer_arch_jitter();
+  if(jitter == NULL || jitter->count == 0) {
+    printf("no jitter statistics, build with NATIVE_CONF_RTIMER_JITTER_STATS=1\n");
+  } else {
+    printf("expirations %lu, late (us): min %lu avg %lu max %lu\n",
+           (unsigned long)jitter->count, (unsigned long)jitter->min,
+           (unsigned long)(jitter->total / jitter->count),
+           (unsigned long)jitter->max);
+    for(i = 0; i < RTIMER_ARCH_JITTER_BUCKETS; i++) {
+      if(jitter->histogram[i] != 0) {
+        if(i == 0) {
+          printf("  %13s: %lu\n", "0 us",
+                 (unsigned long)jitter->histogram[i]);
+        } else if(i == RTIMER_ARCH_JITTER_BUCKETS - 1) {
+          printf("  %7lu us or more: %lu\n", 1UL << (i - 1),
+                 (unsigned long)jitter->histogram[i]);
+        } else {
+          printf("  %5lu-%5lu us: %lu\n", 1UL << (i - 1), (1UL << i) - 1,
+                 (unsigned long)jitter->histogram[i]);
+        }
+      }
+    }
+  }
+  printf("busy-wait overshoot (us): avg %lu max %lu\n",
+         busywait_total / NUM_SLOTS, busywait_max);
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
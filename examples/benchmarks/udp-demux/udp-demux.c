@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Measures the demultiplexing of incoming UDP datagrams between
+ *         many UDP connections on the native platform. Build with
+ *         CONNS=<n> to set the number of connections, and with HASH=off
+ *         for the scan of the connection table.
+ */
+
+#include "contiki.h"
+#include "net/ipv6/uip.h"
+#include "net/ipv6/uip-ds6.h"
+#include "net/ipv6/uipbuf.h"
+#include "lib/random.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+/*---------------------------------------------------------------------------*/
+#define DATAGRAMS 2000000UL
+#define REOPENS   200000UL
+#define PAYLOAD   8
+#define PKT_LEN   (UIP_IPUDPH_LEN + PAYLOAD)
+
+static struct uip_udp_conn *conns[UIP_UDP_CONNS];
+static uint8_t packets[UIP_UDP_CONNS][PKT_LEN];
+static int nconns;
+static unsigned long deliveries;
+/*---------------------------------------------------------------------------*/
+PROCESS(udp_demux_process, "UDP demultiplexing");
+PROCESS(sink_process, "UDP sink");
+AUTOSTART_PROCESSES(&udp_demux_process);
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+/* Opens a connection owned by the sink, which gets the datagrams */
+static struct uip_udp_conn *
+open_conn(void)
+{
+  struct uip_udp_conn *c;
+
+  PROCESS_CONTEXT_BEGIN(&sink_process);
+  c = udp_new(NULL, 0, NULL);
+  PROCESS_CONTEXT_END(&sink_process);
+  return c;
+}
+/*---------------------------------------------------------------------------*/
+/* Builds a datagram from fe80::1 for connection i */
+static void
+build(int i)
+{
+  uipbuf_clear();
+  memset(uip_buf, 0, PKT_LEN);
+  UIP_IP_BUF->vtc = 0x60;
+  UIP_IP_BUF->proto = UIP_PROTO_UDP;
+  UIP_IP_BUF->ttl = 64;
+  uip_ip6addr(&UIP_IP_BUF->srcipaddr, 0xfe80, 0, 0, 0, 0, 0, 0, 1);
+  uip_ipaddr_copy(&UIP_IP_BUF->destipaddr,
+                  &uip_ds6_get_link_local(-1)->ipaddr);
+  uip_len = PKT_LEN;
+  uipbuf_set_len_field(UIP_IP_BUF, uip_len - UIP_IPH_LEN);
+
+  UIP_UDP_BUF->srcport = UIP_HTONS(5683);
+  UIP_UDP_BUF->destport = conns[i]->lport;
+  UIP_UDP_BUF->udplen = UIP_HTONS(UIP_UDPH_LEN + PAYLOAD);
+  memset(&uip_buf[UIP_IPUDPH_LEN], i, PAYLOAD);
+  UIP_UDP_BUF->udpchksum = ~uip_udpchksum();
+
+  memcpy(packets[i], uip_buf, PKT_LEN);
+}
+/*---------------------------------------------------------------------------*/
+/* Feeds the datagram for connection i to uIP */
+static void
+deliver(int i)
+{
+  memcpy(uip_buf, packets[i], PKT_LEN);
+  uip_len = PKT_LEN;
+  uip_ext_len = 0;
+  uip_input();
+}
+/*---------------------------------------------------------------------------*/
+static uint64_t
+run(int newest)
+{
+  unsigned long i;
+  uint64_t start;
+  int c;
+
+  deliveries = 0;
+  start = now_ns();
+  for(i = 0; i < DATAGRAMS; i++) {
+    c = newest ? nconns - 1 : random_rand() % nconns;
+    deliver(c);
+  }
+  return (now_ns() - start) / DATAGRAMS;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(sink_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  while(1) {
+    PROCESS_WAIT_EVENT();
+    if(ev == tcpip_event && uip_newdata()) {
+      deliveries++;
+    }
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(udp_demux_process, ev, data)
+{
+  unsigned long i;
+  uint64_t start, random_ns, newest_ns, reopen_ns;
+  int c;
+
+  PROCESS_BEGIN();
+
+  process_start(&sink_process, NULL);
+
+  while(nconns < UIP_UDP_CONNS && (conns[nconns] = open_conn()) != NULL) {
+    nconns++;
+  }
+  for(c = 0; c < nconns; c++) {
+    build(c);
+  }
+
+  random_ns = run(0);
+  newest_ns = run(1);
+
+  /* Closing a connection and opening another one, which takes a free
+   * local port */
+  start = now_ns();
+  for(i = 0; i < REOPENS; i++) {
+    c = random_rand() % nconns;
+    uip_udp_remove(conns[c]);
+    conns[c] = open_conn();
+  }
+  reopen_ns = (now_ns() - start) / REOPENS;
+
+  printf("Connections: %d, hash: %s, delivered: %lu\n", nconns,
+         UIP_CONN_HASH ? "on" : "off", deliveries);
+  printf("random: %lu ns, newest: %lu ns, reopen: %lu ns\n",
+         (unsigned long)random_ns, (unsigned long)newest_ns,
+         (unsigned long)reopen_ns);
+
+  exit(0);
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
@@ -42,6 +42,7 @@
 #include "dev/leds.h"
 #include "os/sys/log.h"
 #include "mqtt-client.h"
+#include "lib/json/jsonwriter.h"
 
 #include <string.h>
 #include <strings.h>
@@ -230,7 +231,6 @@ static char app_buffer[APP_BUFFER_SIZE];
 static struct mqtt_message *msg_ptr = 0;
 static struct etimer publish_periodic_timer;
 static struct ctimer ct;
-static char *buf_ptr;
 static uint16_t seq_nr_value = 0;
 /*---------------------------------------------------------------------------*/
 /* Parent RSSI functionality */
@@ -495,74 +495,53 @@ static void
 publish(void)
 {
   /* Publish MQTT topic in IBM quickstart format */
-  int len;
-  int remaining = APP_BUFFER_SIZE;
+  struct jsonwriter w;
+  const char *member;
   int i;
   char def_rt_str[64];
 
   seq_nr_value++;
 
-  buf_ptr = app_buffer;
-
-  len = snprintf(buf_ptr, remaining,
-                 "{"
-                 "\"d\":{"
-                 "\"Platform\":\""CONTIKI_TARGET_STRING"\","
+  jsonwriter_init(&w, app_buffer, APP_BUFFER_SIZE);
+  jsonwriter_object_begin(&w);
+  jsonwriter_name(&w, "d");
+  jsonwriter_object_begin(&w);
+  jsonwriter_name(&w, "Platform");
+  jsonwriter_string(&w, CONTIKI_TARGET_STRING);
 #ifdef CONTIKI_BOARD_STRING
-                 "\"Board\":\""CONTIKI_BOARD_STRING"\","
+  jsonwriter_name(&w, "Board");
+  jsonwriter_string(&w, CONTIKI_BOARD_STRING);
 #endif
-                 "\"Seq #\":%d,"
-                 "\"Uptime (sec)\":%lu",
-                 seq_nr_value, clock_seconds());
-
-  if(len < 0 || len >= remaining) {
-    LOG_ERR("Buffer too short. Have %d, need %d + \\0\n", remaining,
-            len);
-    return;
-  }
-
-  remaining -= len;
-  buf_ptr += len;
+  jsonwriter_name(&w, "Seq #");
+  jsonwriter_uint(&w, seq_nr_value);
+  jsonwriter_name(&w, "Uptime (sec)");
+  jsonwriter_uint(&w, clock_seconds());
 
   /* Put our Default route's string representation in a buffer */
   memset(def_rt_str, 0, sizeof(def_rt_str));
   ipaddr_sprintf(def_rt_str, sizeof(def_rt_str), uip_ds6_defrt_choose());
 
-  len = snprintf(buf_ptr, remaining,
-                 ",\"Def Route\":\"%s\",\"RSSI (dBm)\":%d",
-                 def_rt_str, def_rt_rssi);
-
-  if(len < 0 || len >= remaining) {
-    LOG_ERR("Buffer too short. Have %d, need %d + \\0\n", remaining,
-            len);
-    return;
-  }
-  remaining -= len;
-  buf_ptr += len;
+  jsonwriter_name(&w, "Def Route");
+  jsonwriter_string(&w, def_rt_str);
+  jsonwriter_name(&w, "RSSI (dBm)");
+  jsonwriter_int(&w, def_rt_rssi);
 
+  /* Extensions return ready-made "name":value members */
   for(i = 0; i < mqtt_client_extension_count; i++) {
-    len = snprintf(buf_ptr, remaining, ",%s",
-                   mqtt_client_extensions[i]->value());
-
-    if(len < 0 || len >= remaining) {
-      LOG_ERR("Buffer too short. Have %d, need %d + \\0\n", remaining,
-              len);
-      return;
-    }
-    remaining -= len;
-    buf_ptr += len;
+    member = mqtt_client_extensions[i]->value();
+    jsonwriter_raw(&w, member, strlen(member));
   }
 
-  len = snprintf(buf_ptr, remaining, "}}");
+  jsonwriter_object_end(&w);
+  jsonwriter_object_end(&w);
 
-  if(len < 0 || len >= remaining) {
-    LOG_ERR("Buffer too short. Have %d, need %d + \\0\n", remaining,
-            len);
+  if(jsonwriter_overflow(&w)) {
+    LOG_ERR("Buffer too short. Have %d\n", APP_BUFFER_SIZE);
     return;
   }
 
   mqtt_publish(&conn, NULL, pub_topic, (uint8_t *)app_buffer,
-               strlen(app_buffer), MQTT_QOS_LEVEL_0, MQTT_RETAIN_OFF);
+               jsonwriter_len(&w), MQTT_QOS_LEVEL_0, MQTT_RETAIN_OFF);
 
   LOG_DBG("Publish!\n");
 }
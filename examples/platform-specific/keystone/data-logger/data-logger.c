@@ -43,7 +43,7 @@
 #include "contiki.h"
 #include "sys/log.h"
 #include "dev/leds.h"
-#include "lib/ifft.h"
+#include "lib/rfft.h"
 #include <stdbool.h>
 
 /* Sensor headers */
@@ -94,11 +94,9 @@ get_light_reading()
  *          Set num samples to 1024, yielding first 512 results as frequency bins 
  *          spread over 8 kHz.  Each bin would cover 8000/512 ~ 16 Hz.
  * 
- * One thing to note is that the resulting 16-bit PCM in the audio stream has to be
- * down-converted to 8-bit for use with the FFT.  We just sign-shift each sample right by 8.
- * The Contiki IFFT performs conversion in place: input in xre and output in xre.
- * xim can be examined for phase, wherase xre contains the magnitude that we are most
- * interested in.
+ * The real FFT takes the 16-bit PCM samples as they are and works in place:
+ * input in xre, packed spectrum in xre, from which the magnitudes are
+ * computed in place as well. xim is only used as a print buffer.
  *
  * Limit this to the width of the console (half of this)
  */
@@ -143,7 +141,7 @@ t = (0:L-1)*T;        % Time vector
 Create 3 test tones at 1 KHz, quarter power at 3 KHz and 0.75 at 7 KHz.
 S = 1.0*sin(2*pi*1000*t) + 0.25*sin(2*pi*3000*t) +  0.75*sin(2*pi*7000*t);
 Y = fft(S);
-P2 = abs(Y); % note that Contiki's ifft does not divide by n (L) so neither do we here
+P2 = abs(Y/L); % rfft divides by n (L) as well
 P1 = P2(1:L/2+1);      % frequency bins = half the sample rate
 P1(2:end-1) = 2*P1(2:end-1);   % double power as we are taking only half of spectrum
 
@@ -176,18 +174,24 @@ static int16_t test_xre[NUM_FFT_SAMPLES] = {
 static void
 compute_and_print_fft()
 {
-    memset(xim, 0, sizeof(xim));
+    uint16_t* magnitude = (uint16_t*)xre;
+
 #ifdef TEST_FFT
-    memcpy(xre, test_xre, sizeof(test_xre));
+    /* scale the 8-bit test vector up to 16-bit PCM */
+    for (int i = 0; i < NUM_FFT_SAMPLES; i++) {
+        xre[i] = test_xre[i] << 8;
+    }
 #endif
-    
-    ifft(xre, xim, NUM_FFT_SAMPLES);
+
+    rfft(xre, NUM_FFT_SAMPLES);
+    rfft_magnitude(xre, magnitude, NUM_FFT_SAMPLES);
 
     /* need to post process:
-    *   divide by n, then double.
+    *   rfft already divides by n, so double for the one-sided spectrum
+    *   and scale from 16-bit down to 8-bit.
     */
     for (int i = 0; i < NUM_FREQ_BINS; i++) {
-        xre[i] /= (NUM_FFT_SAMPLES / 2);
+        xre[i] = magnitude[i] >> 7;
     }
 
     //printf("[ ");
@@ -372,8 +376,7 @@ PROCESS_THREAD(data_logger_process, ev, data)
 
                     if (fft_sample_count > 0) {
                         /* need to collect NUM_FFT_SAMPLES into xre.
-                         * Now this is a bit confusing: we need 8-bit samples stored in 16-bit values,
-                         * and audio buffer contains 16-bit PCM but its length is given in bytes. 
+                         * The audio buffer contains 16-bit PCM but its length is given in bytes.
                          */
                         fft_num_buffers_used++;
 
@@ -383,7 +386,7 @@ PROCESS_THREAD(data_logger_process, ev, data)
                         for (int i = 0; i < num_samples; i++) {
                             int16_t* samples = (int16_t*)buf->buffer; /* cast audio byte buffer as array of 16-bit PCM samples */
                             
-                            xre[NUM_FFT_SAMPLES - fft_sample_count] = samples[i] >> 8; /* convert to 8-bit as required by FFT */
+                            xre[NUM_FFT_SAMPLES - fft_sample_count] = samples[i];
                             //printf("%d ", xre[NUM_FFT_SAMPLES - fft_sample_count]);
 
                             fft_sample_count--;
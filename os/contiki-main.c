@@ -80,6 +80,9 @@ main(void)
   process_init();
   process_start(&etimer_process, NULL);
   ctimer_init();
+#if LOG_DEFERRED
+  process_start(&log_deferred_process, NULL);
+#endif /* LOG_DEFERRED */
   watchdog_init();
 
   energest_init();
@@ -32,7 +32,7 @@
 #include "dev/serial-line.h"
 #include <string.h> /* for memcpy() */
 
-#include "lib/ringbuf.h"
+#include "lib/ringbuf-ext.h"
 
 #ifdef SERIAL_LINE_CONF_BUFSIZE
 #define BUFSIZE SERIAL_LINE_CONF_BUFSIZE
@@ -55,7 +55,7 @@
 
 #define BS  (0x8)
 
-static struct ringbuf rxbuf;
+static struct ringbuf_ext rxbuf;
 static uint8_t rxbuf_data[BUFSIZE];
 
 PROCESS(serial_line_process, "Serial driver");
@@ -74,14 +74,14 @@ serial_line_input_byte(unsigned char c)
 
   if(!overflow) {
     /* Add character */
-    if(ringbuf_put(&rxbuf, c) == 0) {
+    if(ringbuf_ext_put(&rxbuf, c) == 0) {
       /* Buffer overflow: ignore the rest of the line */
       overflow = 1;
     }
   } else {
     /* Buffer overflowed:
      * Only (try to) add terminator characters, otherwise skip */
-    if(c == END && ringbuf_put(&rxbuf, c) != 0) {
+    if(c == END && ringbuf_ext_put(&rxbuf, c) != 0) {
       overflow = 0;
     }
   }
@@ -95,6 +95,8 @@ PROCESS_THREAD(serial_line_process, ev, data)
 {
   static char buf[BUFSIZE];
   static int ptr;
+  const uint8_t *input;
+  ringbuf_ext_index_t len, i;
 
   PROCESS_BEGIN();
 
@@ -102,25 +104,33 @@ PROCESS_THREAD(serial_line_process, ev, data)
   ptr = 0;
 
   while(1) {
-    /* Fill application buffer until newline or empty */
-    int c = ringbuf_get(&rxbuf);
-    
-    if(c == -1) {
+    /* Fill application buffer until newline or empty, taking the
+       received bytes directly from the ring buffer */
+    input = ringbuf_ext_peek_get(&rxbuf, &len);
+
+    if(len == 0) {
       /* Buffer empty, wait for poll */
       PROCESS_YIELD();
     } else {
-      if(c != END) {
+      for(i = 0; i < len && input[i] != END; i++) {
         /* handle backspace */
-        if (c == BS) {
-          if (ptr > 0) {
-              ptr--;
+        if(input[i] == BS) {
+          if(ptr > 0) {
+            ptr--;
           }
-        } else if(ptr < BUFSIZE-1) {
-          buf[ptr++] = (uint8_t)c;
+        } else if(ptr < BUFSIZE - 1) {
+          buf[ptr++] = input[i];
         } else {
           /* Ignore character (wait for EOL) */
         }
+      }
+
+      if(i == len) {
+        ringbuf_ext_commit_get(&rxbuf, len);
       } else {
+        /* Consume the bytes up to and including END */
+        ringbuf_ext_commit_get(&rxbuf, i + 1);
+
         /* Terminate */
         buf[ptr++] = (uint8_t)'\0';
 
@@ -143,7 +153,7 @@ PROCESS_THREAD(serial_line_process, ev, data)
 void
 serial_line_init(void)
 {
-  ringbuf_init(&rxbuf, rxbuf_data, sizeof(rxbuf_data));
+  ringbuf_ext_init(&rxbuf, rxbuf_data, sizeof(rxbuf_data));
   process_start(&serial_line_process, NULL);
 }
 /*---------------------------------------------------------------------------*/
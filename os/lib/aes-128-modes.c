@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Driver-independent AES-128 helpers: key schedule cache and
+ *         the CTR and CBC-MAC modes used by CCM*.
+ */
+
+#include "lib/aes-128.h"
+#include <string.h>
+
+/*---------------------------------------------------------------------------*/
+int
+aes_128_key_cache_lookup(struct aes_128_key_cache *cache,
+                         const uint8_t *key, uint8_t *slot)
+{
+  uint8_t i;
+
+  for(i = 0; i < cache->used; i++) {
+    if(memcmp(cache->keys[i], key, AES_128_KEY_LENGTH) == 0) {
+      *slot = i;
+      return 1;
+    }
+  }
+
+  if(cache->used < AES_128_KEY_CACHE_SIZE) {
+    i = cache->used++;
+  } else {
+    i = cache->next;
+    cache->next = (cache->next + 1) % AES_128_KEY_CACHE_SIZE;
+  }
+  memcpy(cache->keys[i], key, AES_128_KEY_LENGTH);
+  *slot = i;
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+void
+aes_128_ctr(const uint8_t *iv, uint8_t *data, uint16_t len)
+{
+  uint8_t block[AES_128_BLOCK_SIZE];
+  uint16_t counter;
+  uint8_t i;
+
+  if(AES_128.ctr) {
+    AES_128.ctr(iv, data, len);
+    return;
+  }
+
+  counter = (iv[14] << 8) | iv[15];
+  while(len) {
+    memcpy(block, iv, AES_128_BLOCK_SIZE - 2);
+    block[14] = counter >> 8;
+    block[15] = counter;
+    AES_128.encrypt(block);
+    for(i = 0; i < AES_128_BLOCK_SIZE && len; i++, len--) {
+      *data++ ^= block[i];
+    }
+    counter++;
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+aes_128_cbc_mac(uint8_t *mac, const uint8_t *data, uint16_t len)
+{
+  uint8_t i;
+
+  if(AES_128.cbc_mac) {
+    AES_128.cbc_mac(mac, data, len);
+    return;
+  }
+
+  while(len) {
+    for(i = 0; i < AES_128_BLOCK_SIZE && len; i++, len--) {
+      mac[i] ^= *data++;
+    }
+    AES_128.encrypt(mac);
+  }
+}
+/*---------------------------------------------------------------------------*/
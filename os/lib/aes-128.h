@@ -51,8 +51,22 @@
 #define AES_128            aes_128_driver
 #endif /* AES_128_CONF */
 
+/**
+ * Number of expanded keys the software drivers cache. CSMA and TSCH
+ * call set_key() before every frame, so a hit saves the key expansion.
+ */
+#ifdef AES_128_CONF_KEY_CACHE_SIZE
+#define AES_128_KEY_CACHE_SIZE AES_128_CONF_KEY_CACHE_SIZE
+#else /* AES_128_CONF_KEY_CACHE_SIZE */
+#define AES_128_KEY_CACHE_SIZE 1
+#endif /* AES_128_CONF_KEY_CACHE_SIZE */
+
 /**
  * Structure of AES drivers.
+ *
+ * The bulk operations are optional. When a driver leaves them NULL,
+ * aes_128_ctr() and aes_128_cbc_mac() fall back to calling encrypt()
+ * once per block.
  */
 struct aes_128_driver {
   
@@ -65,8 +79,53 @@ struct aes_128_driver {
    * \brief Encrypts.
    */
   void (* encrypt)(uint8_t *plaintext_and_result);
+
+  /**
+   * \brief      XORs \p data with the CTR keystream (optional).
+   * \param iv   The first counter block. The counter is the big-endian
+   *             number in its last two bytes, as in CCM* with L = 2.
+   */
+  void (* ctr)(const uint8_t *iv, uint8_t *data, uint16_t len);
+
+  /**
+   * \brief      Continues the CBC-MAC \p mac over \p data (optional).
+   *             A trailing partial block is zero-padded.
+   */
+  void (* cbc_mac)(uint8_t *mac, const uint8_t *data, uint16_t len);
+};
+
+/**
+ * Cache of the keys whose schedules a software driver has expanded.
+ * The driver keeps the schedules in a parallel array indexed by slot.
+ */
+struct aes_128_key_cache {
+  uint8_t keys[AES_128_KEY_CACHE_SIZE][AES_128_KEY_LENGTH];
+  uint8_t used;
+  uint8_t next;
 };
 
 extern const struct aes_128_driver AES_128;
+extern const struct aes_128_driver aes_128_driver;
+extern const struct aes_128_driver aes_128_ttable_driver;
+
+/**
+ * \brief       Looks up \p key in \p cache.
+ * \param slot  Set to the slot holding the key. On a miss the key has
+ *              been stored in a free or the least recently added slot.
+ * \return      Non-zero on a hit, zero if the caller must expand the
+ *              key into the schedule at \p slot.
+ */
+int aes_128_key_cache_lookup(struct aes_128_key_cache *cache,
+                             const uint8_t *key, uint8_t *slot);
+
+/**
+ * \brief Encrypts or decrypts \p data in CTR mode with AES_128.
+ */
+void aes_128_ctr(const uint8_t *iv, uint8_t *data, uint16_t len);
+
+/**
+ * \brief Continues the CBC-MAC \p mac over \p data with AES_128.
+ */
+void aes_128_cbc_mac(uint8_t *mac, const uint8_t *data, uint16_t len);
 
 #endif /* AES_128_H_ */
@@ -59,25 +59,6 @@ set_iv(uint8_t *iv,
   iv[15] = counter;
 }
 /*---------------------------------------------------------------------------*/
-/* XORs the block m[pos] ... m[pos + 15] with K_{counter} */
-static void
-ctr_step(const uint8_t *nonce,
-    uint8_t pos,
-    uint8_t *m_and_result,
-    uint8_t m_len,
-    uint8_t counter)
-{
-  uint8_t a[AES_128_BLOCK_SIZE];
-  uint8_t i;
-  
-  set_iv(a, CCM_STAR_ENCRYPTION_FLAGS, nonce, counter);
-  AES_128.encrypt(a);
-  
-  for(i = 0; (pos + i < m_len) && (i < AES_128_BLOCK_SIZE); i++) {
-    m_and_result[pos + i] ^= a[i];
-  }
-}
-/*---------------------------------------------------------------------------*/
 static void
 mic(const uint8_t *nonce,
     const uint8_t *m, uint8_t m_len,
@@ -85,43 +66,29 @@ mic(const uint8_t *nonce,
     uint8_t *result,
     uint8_t mic_len)
 {
+  uint8_t b[AES_128_BLOCK_SIZE];
   uint8_t x[AES_128_BLOCK_SIZE];
-  uint8_t pos;
-  uint8_t i;
+  uint8_t first;
   
-  set_iv(x, CCM_STAR_AUTH_FLAGS(a_len, mic_len), nonce, m_len);
-  AES_128.encrypt(x);
+  memset(x, 0, sizeof(x));
+  set_iv(b, CCM_STAR_AUTH_FLAGS(a_len, mic_len), nonce, m_len);
+  aes_128_cbc_mac(x, b, AES_128_BLOCK_SIZE);
   
   if(a_len) {
-    x[1] = x[1] ^ a_len;
-    for(i = 2; (i - 2 < a_len) && (i < AES_128_BLOCK_SIZE); i++) {
-      x[i] ^= a[i - 2];
-    }
-    
-    AES_128.encrypt(x);
-    
-    pos = 14;
-    while(pos < a_len) {
-      for(i = 0; (pos + i < a_len) && (i < AES_128_BLOCK_SIZE); i++) {
-        x[i] ^= a[pos + i];
-      }
-      pos += AES_128_BLOCK_SIZE;
-      AES_128.encrypt(x);
-    }
+    /* the first block starts with the 2-byte length of a */
+    first = MIN(a_len, AES_128_BLOCK_SIZE - 2);
+    memset(b, 0, sizeof(b));
+    b[1] = a_len;
+    memcpy(b + 2, a, first);
+    aes_128_cbc_mac(x, b, AES_128_BLOCK_SIZE);
+    aes_128_cbc_mac(x, a + first, a_len - first);
   }
   
-  if(m_len) {
-    pos = 0;
-    while(pos < m_len) {
-      for(i = 0; (pos + i < m_len) && (i < AES_128_BLOCK_SIZE); i++) {
-        x[i] ^= m[pos + i];
-      }
-      pos += AES_128_BLOCK_SIZE;
-      AES_128.encrypt(x);
-    }
-  }
+  aes_128_cbc_mac(x, m, m_len);
   
-  ctr_step(nonce, 0, x, AES_128_BLOCK_SIZE, 0);
+  /* encrypt the tag with K_0 */
+  set_iv(b, CCM_STAR_ENCRYPTION_FLAGS, nonce, 0);
+  aes_128_ctr(b, x, mic_len);
   
   memcpy(result, x, mic_len);
 }
@@ -129,15 +96,10 @@ mic(const uint8_t *nonce,
 static void
 ctr(const uint8_t *nonce, uint8_t *m, uint8_t m_len)
 {
-  uint8_t pos;
-  uint8_t counter;
+  uint8_t a[AES_128_BLOCK_SIZE];
   
-  pos = 0;
-  counter = 1;
-  while(pos < m_len) {
-    ctr_step(nonce, pos, m, m_len, counter++);
-    pos += AES_128_BLOCK_SIZE;
-  }
+  set_iv(a, CCM_STAR_ENCRYPTION_FLAGS, nonce, 1);
+  aes_128_ctr(a, m, m_len);
 }
 /*---------------------------------------------------------------------------*/
 static void
@@ -49,12 +49,30 @@
  * calculation module is an iterative CRC calculator that can be used
  * to cumulatively update a CRC checksum for every incoming byte.
  *
+ * The implementation is selected at build time with CRC16_CONF_IMPL:
+ * - CRC16_IMPL_BITWISE computes each byte with a few shifts, and needs
+ *   no table. This is the default.
+ * - CRC16_IMPL_TABLE looks up each byte in a 512-byte table in ROM.
+ * - CRC16_IMPL_SLICE8 additionally lets crc16_data() process eight
+ *   bytes per step, using 3.5 kB of tables in RAM that are computed on
+ *   first use. This is the default on the native platform.
+ *
  * @{
  */
 
 #ifndef CRC16_H_
 #define CRC16_H_
 
+#define CRC16_IMPL_BITWISE 0
+#define CRC16_IMPL_TABLE   1
+#define CRC16_IMPL_SLICE8  2
+
+#ifdef CRC16_CONF_IMPL
+#define CRC16_IMPL CRC16_CONF_IMPL
+#else
+#define CRC16_IMPL CRC16_IMPL_BITWISE
+#endif /* CRC16_CONF_IMPL */
+
 /**
  * \brief      Update an accumulated CRC16 checksum with one byte.
  * \param b    The byte to be added to the checksum
@@ -65,11 +83,6 @@
  *             with one byte. It can be used as a running checksum, or
  *             to checksum an entire data block.
  *
- *             \note The algorithm used in this implementation is
- *             tailored for a running checksum and does not perform as
- *             well as a table-driven algorithm when checksumming an
- *             entire data block.
- *
  */
 unsigned short crc16_add(unsigned char b, unsigned short crc);
 
@@ -82,10 +95,9 @@ unsigned short crc16_add(unsigned char b, unsigned short crc);
  *
  *             This function calculates the CRC16 checksum of a data area.
  *
- *             \note The algorithm used in this implementation is
- *             tailored for a running checksum and does not perform as
- *             well as a table-driven algorithm when checksumming an
- *             entire data block.
+ *             \note With CRC16_IMPL_BITWISE, this is considerably
+ *             slower than the table-driven implementations for large
+ *             data areas.
  */
 unsigned short crc16_data(const unsigned char *data, int datalen,
 			  unsigned short acc);
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+/** \addtogroup lib
+ * @{
+ *
+ * \defgroup crc32c CRC-32C calculation
+ *
+ * The CRC-32C (Castagnoli) checksum detects more errors in stored data
+ * than the CRC16. The checksum can be computed over a data area in
+ * several calls, by passing the result of each call as the accumulated
+ * value of the next one. The first call takes zero.
+ *
+ * The implementation is selected at build time with CRC32C_CONF_IMPL:
+ * - CRC32C_IMPL_BITWISE processes one bit at a time and needs no table.
+ *   This is the default.
+ * - CRC32C_IMPL_TABLE looks up each byte in a 1 kB table in ROM.
+ * - CRC32C_IMPL_SLICE8 processes eight bytes per step, using 7 kB of
+ *   tables in RAM that are computed on first use. This is the default
+ *   on the native platform.
+ * @{
+ */
+/*---------------------------------------------------------------------------*/
+#ifndef CRC32C_H_
+#define CRC32C_H_
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+
+#include <stdint.h>
+/*---------------------------------------------------------------------------*/
+#define CRC32C_IMPL_BITWISE 0
+#define CRC32C_IMPL_TABLE   1
+#define CRC32C_IMPL_SLICE8  2
+
+#ifdef CRC32C_CONF_IMPL
+#define CRC32C_IMPL CRC32C_CONF_IMPL
+#else
+#define CRC32C_IMPL CRC32C_IMPL_BITWISE
+#endif /* CRC32C_CONF_IMPL */
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief      Calculate the CRC-32C over a data area
+ * \param data Pointer to the data
+ * \param len  The length of the data
+ * \param acc  The CRC of the preceding data, or zero
+ * \return     The CRC-32C checksum
+ */
+uint32_t crc32c_data(const unsigned char *data, int len, uint32_t acc);
+/*---------------------------------------------------------------------------*/
+#endif /* CRC32C_H_ */
+/*---------------------------------------------------------------------------*/
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         FatFs disk I/O layer on top of a Contiki-NG disk driver, with an
+ *         optional sequential read-ahead buffer.
+ */
+
+#include "contiki.h"
+#include "ff.h"
+#include "diskio.h"
+#include "dev/disk/disk.h"
+
+#include <string.h>
+/*---------------------------------------------------------------------------*/
+#ifdef FATFS_CONF_DISK_DRIVER
+#define FATFS_DISK_DRIVER FATFS_CONF_DISK_DRIVER
+#else
+#define FATFS_DISK_DRIVER mmc_driver
+#endif
+
+/*
+ * Number of sectors fetched in one command when single-sector reads are
+ * sequential, 0 to disable. One buffer is shared by all drives.
+ */
+#ifdef FATFS_CONF_READ_AHEAD
+#define FATFS_READ_AHEAD FATFS_CONF_READ_AHEAD
+#else
+#define FATFS_READ_AHEAD 0
+#endif
+
+extern const struct disk_driver FATFS_DISK_DRIVER;
+
+#if FATFS_READ_AHEAD > 1
+static BYTE ra_buf[FATFS_READ_AHEAD][_MAX_SS];
+static DWORD ra_sector;
+static UINT ra_count;
+/* The drive that the buffered sectors were read from */
+static BYTE ra_buf_drv;
+/* The drive of the last read, used to detect sequential reads */
+static BYTE ra_drv;
+static DWORD next_sector = 0xFFFFFFFF;
+#endif
+/*---------------------------------------------------------------------------*/
+static DRESULT
+result(disk_result_t res)
+{
+  switch(res) {
+  case DISK_RESULT_OK:
+    return RES_OK;
+  case DISK_RESULT_WR_PROTECTED:
+    return RES_WRPRT;
+  case DISK_RESULT_NO_INIT:
+    return RES_NOTRDY;
+  case DISK_RESULT_INVALID_ARG:
+    return RES_PARERR;
+  default:
+    return RES_ERROR;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static DSTATUS
+status(disk_status_t status)
+{
+  DSTATUS stat = 0;
+
+  if(!(status & DISK_STATUS_INIT)) {
+    stat |= STA_NOINIT;
+  }
+  if(!(status & DISK_STATUS_DISK)) {
+    stat |= STA_NODISK;
+  }
+  if(!(status & DISK_STATUS_WRITABLE)) {
+    stat |= STA_PROTECT;
+  }
+  return stat;
+}
+/*---------------------------------------------------------------------------*/
+DSTATUS
+disk_initialize(BYTE pdrv)
+{
+#if FATFS_READ_AHEAD > 1
+  if(pdrv == ra_buf_drv) {
+    ra_count = 0;
+  }
+#endif
+  return status(FATFS_DISK_DRIVER.initialize(pdrv));
+}
+/*---------------------------------------------------------------------------*/
+DSTATUS
+disk_status(BYTE pdrv)
+{
+  return status(FATFS_DISK_DRIVER.status(pdrv));
+}
+/*---------------------------------------------------------------------------*/
+DRESULT
+disk_read(BYTE pdrv, BYTE *buff, DWORD sector, UINT count)
+{
+#if FATFS_READ_AHEAD > 1
+  int sequential;
+
+  sequential = pdrv == ra_drv && sector == next_sector;
+  next_sector = sector + count;
+  ra_drv = pdrv;
+
+  if(count == 1) {
+    if(ra_count > 0 && pdrv == ra_buf_drv &&
+       sector - ra_sector < ra_count) {
+      memcpy(buff, ra_buf[sector - ra_sector], _MAX_SS);
+      return RES_OK;
+    }
+    if(sequential) {
+      /* The caller is walking the disk: fetch the next sectors in one go */
+      ra_count = 0;
+      if(FATFS_DISK_DRIVER.read(pdrv, ra_buf, sector,
+                                FATFS_READ_AHEAD) == DISK_RESULT_OK) {
+        ra_buf_drv = pdrv;
+        ra_sector = sector;
+        ra_count = FATFS_READ_AHEAD;
+        memcpy(buff, ra_buf[0], _MAX_SS);
+        return RES_OK;
+      }
+      /* Probably past the end of the disk: fall back to a single read */
+    }
+  }
+#endif
+  return result(FATFS_DISK_DRIVER.read(pdrv, buff, sector, count));
+}
+/*---------------------------------------------------------------------------*/
+DRESULT
+disk_write(BYTE pdrv, const BYTE *buff, DWORD sector, UINT count)
+{
+#if FATFS_READ_AHEAD > 1
+  UINT i;
+
+  /* Keep the read-ahead buffer coherent with what is written */
+  if(pdrv == ra_buf_drv) {
+    for(i = 0; i < ra_count; i++) {
+      if(ra_sector + i - sector < count) {
+        memcpy(ra_buf[i], buff + (ra_sector + i - sector) * _MAX_SS, _MAX_SS);
+      }
+    }
+  }
+#endif
+  return result(FATFS_DISK_DRIVER.write(pdrv, buff, sector, count));
+}
+/*---------------------------------------------------------------------------*/
+DRESULT
+disk_ioctl(BYTE pdrv, BYTE cmd, void *buff)
+{
+  /* The FatFs commands have the same codes as disk_ioctl_t */
+  return result(FATFS_DISK_DRIVER.ioctl(pdrv, cmd, buff));
+}
+/*---------------------------------------------------------------------------*/
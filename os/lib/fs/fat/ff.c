@@ -61,6 +61,15 @@
 #endif
 
 
+/* Window cache */
+#if _FS_WINDOWS < 1 || _FS_WINDOWS > 16
+#error Wrong _FS_WINDOWS setting
+#endif
+#if _FS_WINDOWS > 1 && _FS_TINY
+#error _FS_WINDOWS > 1 needs _FS_TINY == 0
+#endif
+
+
 /* Timestamp */
 #if _FS_NORTC == 1
 #if _NORTC_YEAR < 1980 || _NORTC_YEAR > 2107 || _NORTC_MON < 1 || _NORTC_MON > 12 || _NORTC_MDAY < 1 || _NORTC_MDAY > 31
@@ -864,32 +873,133 @@ void clear_lock (	/* Clear lock entries of the volume */
 /* Move/Flush disk access window in the file system object               */
 /*-----------------------------------------------------------------------*/
 #if !_FS_READONLY
+static
+FRESULT write_sector (	/* Returns FR_OK or FR_DISK_ERROR */
+	FATFS* fs,			/* File system object */
+	const BYTE* buff,	/* Sector data */
+	DWORD sect			/* Sector number */
+)
+{
+	UINT nf;
+
+
+	if (disk_write(fs->drv, buff, sect, 1) != RES_OK) return FR_DISK_ERR;
+	if (sect - fs->fatbase < fs->fsize) {		/* Is it in the FAT area? */
+		for (nf = fs->n_fats; nf >= 2; nf--) {	/* Reflect the change to all FAT copies */
+			sect += fs->fsize;
+			disk_write(fs->drv, buff, sect, 1);
+		}
+	}
+	return FR_OK;
+}
+
+
 static
 FRESULT sync_window (	/* Returns FR_OK or FR_DISK_ERROR */
 	FATFS* fs			/* File system object */
 )
 {
-	DWORD wsect;
-	UINT nf;
 	FRESULT res = FR_OK;
+#if _FS_WINDOWS > 1
+	UINT i;
+#endif
 
 
 	if (fs->wflag) {	/* Write back the sector if it is dirty */
-		wsect = fs->winsect;	/* Current sector number */
-		if (disk_write(fs->drv, fs->win, wsect, 1) != RES_OK) {
+		if (write_sector(fs, fs->win, fs->winsect) != FR_OK) {
 			res = FR_DISK_ERR;
 		} else {
 			fs->wflag = 0;
-			if (wsect - fs->fatbase < fs->fsize) {		/* Is it in the FAT area? */
-				for (nf = fs->n_fats; nf >= 2; nf--) {	/* Reflect the change to all FAT copies */
-					wsect += fs->fsize;
-					disk_write(fs->drv, fs->win, wsect, 1);
-				}
+		}
+	}
+#if _FS_WINDOWS > 1
+	for (i = 0; i < _FS_WINDOWS - 1; i++) {	/* Write back the dirty cached windows */
+		if (fs->cflag[i]) {
+			if (write_sector(fs, fs->cbuf[fs->corder[i]], fs->csect[i]) != FR_OK) {
+				res = FR_DISK_ERR;
+			} else {
+				fs->cflag[i] = 0;
 			}
 		}
 	}
+#endif
+	return res;
+}
+#endif
+
+
+#if _FS_WINDOWS > 1
+#if !_FS_READONLY
+static
+void discard_windows (	/* Drop cached windows that are about to be overwritten */
+	FATFS* fs,			/* File system object */
+	DWORD sect,			/* First sector */
+	DWORD n				/* Number of sectors */
+)
+{
+	UINT i;
+
+
+	for (i = 0; i < _FS_WINDOWS - 1; i++) {
+		if (fs->csect[i] - sect < n) {
+			fs->csect[i] = 0xFFFFFFFF;
+			fs->cflag[i] = 0;
+		}
+	}
+}
+#endif
+
+
+static
+FRESULT swap_window (	/* Returns FR_OK or FR_DISK_ERROR */
+	FATFS* fs,			/* File system object */
+	DWORD sector		/* Sector number to make appearance in the fs->win[] */
+)
+{
+	FRESULT res = FR_OK;
+	UINT i, n;
+	DWORD sect;
+	BYTE flag, ord, b, *p, *q;
+
+
+	for (i = 0; i < _FS_WINDOWS - 2 && fs->csect[i] != sector; i++) ;
+	q = fs->cbuf[fs->corder[i]];
+	if (fs->csect[i] == sector) {	/* Cached: exchange it with the current window */
+		p = fs->win;
+		for (n = SS(fs); n; n--) {
+			b = *p; *p++ = *q; *q++ = b;
+		}
+		sect = fs->csect[i]; flag = fs->cflag[i];
+		fs->csect[i] = fs->winsect; fs->cflag[i] = fs->wflag;
+		fs->winsect = sect; fs->wflag = flag;
+	} else {						/* Not cached: park the current window in the least recently used buffer */
+#if !_FS_READONLY
+		if (fs->cflag[i]) {
+			if (write_sector(fs, q, fs->csect[i]) != FR_OK) return FR_DISK_ERR;
+			fs->cflag[i] = 0;
+		}
+#endif
+		mem_cpy(q, fs->win, SS(fs));
+		fs->csect[i] = fs->winsect; fs->cflag[i] = fs->wflag;
+		fs->wflag = 0;
+		if (disk_read(fs->drv, fs->win, sector, 1) != RES_OK) {
+			sector = 0xFFFFFFFF;	/* Invalidate window if data is not reliable */
+			res = FR_DISK_ERR;
+		}
+		fs->winsect = sector;
+	}
+	/* The parked window is now the most recently used */
+	sect = fs->csect[i]; flag = fs->cflag[i]; ord = fs->corder[i];
+	for ( ; i; i--) {
+		fs->csect[i] = fs->csect[i - 1];
+		fs->cflag[i] = fs->cflag[i - 1];
+		fs->corder[i] = fs->corder[i - 1];
+	}
+	fs->csect[0] = sect; fs->cflag[0] = flag; fs->corder[0] = ord;
 	return res;
 }
+#else
+#define discard_windows(fs, sect, n)
 #endif
 
 
@@ -903,6 +1013,9 @@ FRESULT move_window (	/* Returns FR_OK or FR_DISK_ERROR */
 
 
 	if (sector != fs->winsect) {	/* Window offset changed? */
+#if _FS_WINDOWS > 1
+		res = swap_window(fs, sector);
+#else
 #if !_FS_READONLY
 		res = sync_window(fs);		/* Write-back changes */
 #endif
@@ -913,6 +1026,7 @@ FRESULT move_window (	/* Returns FR_OK or FR_DISK_ERROR */
 			}
 			fs->winsect = sector;
 		}
+#endif
 	}
 	return res;
 }
@@ -946,6 +1060,7 @@ FRESULT sync_fs (	/* FR_OK:succeeded, !=0:error */
 			st_dword(fs->win + FSI_Nxt_Free, fs->last_clst);
 			/* Write it into the FSInfo sector */
 			fs->winsect = fs->volbase + 1;
+			discard_windows(fs, fs->winsect, 1);
 			disk_write(fs->drv, fs->win, fs->winsect, 1);
 			fs->fsi_flag = 0;
 		}
@@ -1513,6 +1628,7 @@ FRESULT dir_next (	/* FR_OK(0):succeeded, FR_NO_FILE:End of table, FR_DENIED:Cou
 					if (_FS_EXFAT) dp->obj.stat |= 4;			/* The directory needs to be updated */
 					if (sync_window(fs) != FR_OK) return FR_DISK_ERR;	/* Flush disk access window */
 					mem_set(fs->win, 0, SS(fs));				/* Clear window buffer */
+					discard_windows(fs, clust2sect(fs, clst), fs->csize);
 					for (n = 0, fs->winsect = clust2sect(fs, clst); n < fs->csize; n++, fs->winsect++) {	/* Fill the new cluster with 0 */
 						fs->wflag = 1;
 						if (sync_window(fs) != FR_OK) return FR_DISK_ERR;
@@ -2916,6 +3032,13 @@ BYTE check_fs (	/* 0:FAT, 1:exFAT, 2:Valid BS but not FAT, 3:Not a BS, 4:Disk er
 	DWORD sect	/* Sector# (lba) to check if it is an FAT-VBR or not */
 )
 {
+#if _FS_WINDOWS > 1
+	UINT i;
+
+	for (i = 0; i < _FS_WINDOWS - 1; i++) {	/* Invalidate window cache */
+		fs->csect[i] = 0xFFFFFFFF; fs->cflag[i] = 0; fs->corder[i] = (BYTE)i;
+	}
+#endif
 	fs->wflag = 0; fs->winsect = 0xFFFFFFFF;		/* Invaidate window */
 	if (move_window(fs, sect) != FR_OK) return 4;	/* Load boot record */
 
@@ -4577,6 +4700,7 @@ FRESULT f_mkdir (
 			tm = GET_FATTIME();
 			if (res == FR_OK) {					/* Initialize the new directory table */
 				dsc = clust2sect(fs, dcl);
+				discard_windows(fs, dsc, fs->csize);
 				dir = fs->win;
 				mem_set(dir, 0, SS(fs));
 				if (!_FS_EXFAT || fs->fs_type != FS_EXFAT) {
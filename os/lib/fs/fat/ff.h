@@ -130,6 +130,12 @@ typedef struct {
 	DWORD	database;		/* Data base sector */
 	DWORD	winsect;		/* Current sector appearing in the win[] */
 	BYTE	win[_MAX_SS];	/* Disk access window for Directory, FAT (and file data at tiny cfg) */
+#if _FS_WINDOWS > 1
+	DWORD	csect[_FS_WINDOWS - 1];	/* Sectors held in the window cache, most recently used first */
+	BYTE	cflag[_FS_WINDOWS - 1];	/* cbuf[] flags (b0:dirty) */
+	BYTE	corder[_FS_WINDOWS - 1];	/* Index of the cbuf[] holding csect[] */
+	BYTE	cbuf[_FS_WINDOWS - 1][_MAX_SS];	/* Window cache buffers */
+#endif
 } FATFS;
 
 
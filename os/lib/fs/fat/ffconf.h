@@ -0,0 +1,234 @@
+/*---------------------------------------------------------------------------/
+/  FatFs - FAT file system module configuration file  R0.12b
+/---------------------------------------------------------------------------/
+/
+/  Every option can be overridden from the project configuration through the
+/  corresponding FATFS_CONF_ macro.
+/
+/---------------------------------------------------------------------------*/
+
+#define _FFCONF 68020	/* Revision ID */
+
+#include "contiki.h"
+
+/*---------------------------------------------------------------------------/
+/ Function Configurations
+/---------------------------------------------------------------------------*/
+
+#ifdef FATFS_CONF_READONLY
+#define _FS_READONLY	FATFS_CONF_READONLY
+#else
+#define _FS_READONLY	0
+#endif
+/* This option switches read-only configuration. (0:Read/Write or 1:Read-only)
+/  Read-only configuration removes writing API functions, f_write(), f_sync(),
+/  f_unlink(), f_mkdir(), f_chmod(), f_rename(), f_truncate(), f_getfree()
+/  and optional writing functions as well. */
+
+
+#define _FS_MINIMIZE	0
+/* This option defines minimization level to remove some basic API functions.
+/
+/   0: All basic functions are enabled.
+/   1: f_stat(), f_getfree(), f_unlink(), f_mkdir(), f_truncate() and f_rename()
+/      are removed.
+/   2: f_opendir(), f_readdir() and f_closedir() are removed in addition to 1.
+/   3: f_lseek() function is removed in addition to 2. */
+
+
+#define	_USE_STRFUNC	0
+/* This option switches string functions, f_gets(), f_putc(), f_puts() and
+/  f_printf().
+/
+/  0: Disable string functions.
+/  1: Enable without LF-CRLF conversion.
+/  2: Enable with LF-CRLF conversion. */
+
+
+#define _USE_FIND		0
+/* This option switches filtered directory read functions, f_findfirst() and
+/  f_findnext(). (0:Disable, 1:Enable 2:Enable with matching altname[] too) */
+
+
+#ifdef FATFS_CONF_USE_MKFS
+#define	_USE_MKFS		FATFS_CONF_USE_MKFS
+#else
+#define	_USE_MKFS		0
+#endif
+/* This option switches f_mkfs() function. (0:Disable or 1:Enable) */
+
+
+#ifdef FATFS_CONF_USE_FASTSEEK
+#define	_USE_FASTSEEK	FATFS_CONF_USE_FASTSEEK
+#else
+#define	_USE_FASTSEEK	1
+#endif
+/* This option switches fast seek function. (0:Disable or 1:Enable) */
+
+
+#define	_USE_EXPAND		0
+/* This option switches f_expand function. (0:Disable or 1:Enable) */
+
+
+#define _USE_CHMOD		0
+/* This option switches attribute manipulation functions, f_chmod() and f_utime().
+/  (0:Disable or 1:Enable) Also _FS_READONLY needs to be 0 to enable this option. */
+
+
+#define _USE_LABEL		0
+/* This option switches volume label functions, f_getlabel() and f_setlabel().
+/  (0:Disable or 1:Enable) */
+
+
+#define	_USE_FORWARD	0
+/* This option switches f_forward() function. (0:Disable or 1:Enable) */
+
+
+/*---------------------------------------------------------------------------/
+/ Locale and Namespace Configurations
+/---------------------------------------------------------------------------*/
+
+#define _CODE_PAGE	437
+/* This option specifies the OEM code page to be used on the target system.
+/  Incorrect setting of the code page can cause a file open failure. */
+
+
+#ifdef FATFS_CONF_USE_LFN
+#define	_USE_LFN	FATFS_CONF_USE_LFN
+#else
+#define	_USE_LFN	0
+#endif
+#define	_MAX_LFN	255
+/* The _USE_LFN switches the support of long file name (LFN).
+/
+/   0: Disable support of LFN. _MAX_LFN has no effect.
+/   1: Enable LFN with static working buffer on the BSS. Always NOT thread-safe.
+/   2: Enable LFN with dynamic working buffer on the STACK.
+/   3: Enable LFN with dynamic working buffer on the HEAP.
+/
+/  Enabling LFN needs option/unicode.c to be added to the project. */
+
+
+#define	_LFN_UNICODE	0
+/* This option switches character encoding on the API. (0:ANSI/OEM or 1:UTF-16)
+/  To use Unicode string for the path name, enable LFN and set _LFN_UNICODE = 1. */
+
+
+#define _STRF_ENCODE	3
+/* When _LFN_UNICODE == 1, this option selects the character encoding ON THE FILE
+/  to be read/written via string I/O functions, f_gets(), f_putc(), f_puts and
+/  f_printf(). */
+
+
+#define _FS_RPATH	0
+/* This option configures support of relative path.
+/
+/   0: Disable relative path and remove related functions.
+/   1: Enable relative path. f_chdir() and f_chdrive() are available.
+/   2: f_getcwd() function is available in addition to 1. */
+
+
+/*---------------------------------------------------------------------------/
+/ Drive/Volume Configurations
+/---------------------------------------------------------------------------*/
+
+#ifdef FATFS_CONF_VOLUMES
+#define _VOLUMES	FATFS_CONF_VOLUMES
+#else
+#define _VOLUMES	1
+#endif
+/* Number of volumes (logical drives) to be used. Logical drive n is mapped
+/  to device n of the disk driver. */
+
+
+#define _STR_VOLUME_ID	0
+#define _VOLUME_STRS	"RAM","NAND","CF","SD","SD2","USB","USB2","USB3"
+/* _STR_VOLUME_ID switches string support of volume ID.
+/  When _STR_VOLUME_ID is set to 1, also pre-defined strings can be used as drive
+/  number in the path name. */
+
+
+#define	_MULTI_PARTITION	0
+/* This option switches support of multi-partition on a physical drive.
+/  When multi-partition is disabled (0), each volume is bound to the same
+/  physical drive number and only the first FAT partition is mounted. */
+
+
+#define	_MIN_SS		512
+#define	_MAX_SS		512
+/* These options configure the range of sector size to be supported. (512,
+/  1024, 2048 or 4096) Always set both 512 for most systems, all type of memory
+/  cards and harddisk. */
+
+
+#define	_USE_TRIM	0
+/* This option switches support of ATA-TRIM. (0:Disable or 1:Enable) */
+
+
+#define _FS_NOFSINFO	0
+/* If you need to know correct free space on the FAT32 volume, set bit 0 of
+/  this option, and f_getfree() function at first time after volume mount will
+/  force a full FAT scan. Bit 1 controls the use of last allocated cluster
+/  number. */
+
+
+/*---------------------------------------------------------------------------/
+/ System Configurations
+/---------------------------------------------------------------------------*/
+
+#ifdef FATFS_CONF_TINY
+#define	_FS_TINY	FATFS_CONF_TINY
+#else
+#define	_FS_TINY	0
+#endif
+/* This option switches tiny buffer configuration. (0:Normal or 1:Tiny)
+/  At the tiny configuration, size of file object (FIL) is reduced _MAX_SS bytes.
+/  Instead of private sector buffer eliminated from the file object, common
+/  sector buffer in the file system object (FATFS) is used for the file data
+/  transfer. */
+
+
+#ifdef FATFS_CONF_WINDOWS
+#define _FS_WINDOWS	FATFS_CONF_WINDOWS
+#else
+#define _FS_WINDOWS	1
+#endif
+/* This option sets the number of sector windows in the file system object
+/  (FATFS) for FAT and directory access. With more than one window, sectors
+/  that the window moves away from are kept in a write-back cache of
+/  _FS_WINDOWS - 1 sectors, so that following a FAT chain while updating a
+/  directory entry, or appending to a file, does not write and re-read the
+/  same sectors. Each extra window costs _MAX_SS bytes of RAM per volume.
+/  Requires _FS_TINY == 0. */
+
+
+#define _FS_EXFAT	0
+/* This option switches support of exFAT file system. (0:Disable or 1:Enable)
+/  When enable exFAT, also LFN needs to be enabled. (_USE_LFN >= 1) */
+
+
+#define _FS_NORTC	1
+#define _NORTC_MON	1
+#define _NORTC_MDAY	1
+#define _NORTC_YEAR	2016
+/* The option _FS_NORTC switches timestamp functiton. If the system does not
+/  have any RTC function or valid timestamp is not needed, set _FS_NORTC = 1 to
+/  disable the timestamp function. All objects modified by FatFs will have a
+/  fixed timestamp defined by _NORTC_MON, _NORTC_MDAY and _NORTC_YEAR in local
+/  time. */
+
+
+#define	_FS_LOCK	0
+/* The option _FS_LOCK switches file lock function to control duplicated file
+/  open and illegal operation to open objects. This option must be 0 when
+/  _FS_READONLY is 1. */
+
+
+#define _FS_REENTRANT	0
+#define _FS_TIMEOUT		1000
+#define	_SYNC_t			HANDLE
+/* The option _FS_REENTRANT switches the re-entrancy (thread safe) of the FatFs
+/  module itself. Contiki-NG processes are not preempted, so it is disabled. */
+
+
+/*--- End of configuration options ---*/
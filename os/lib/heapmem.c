@@ -58,6 +58,31 @@
 
 #include "heapmem.h"
 
+/*
+ * The HEAPMEM_CONF_TRACE parameter makes the debug versions of the
+ * API functions print one line per call, which can be used to record
+ * allocation traces of an application.
+ */
+#if HEAPMEM_DEBUG && defined(HEAPMEM_CONF_TRACE)
+#define HEAPMEM_TRACE HEAPMEM_CONF_TRACE
+#else
+#define HEAPMEM_TRACE 0
+#endif /* HEAPMEM_DEBUG && HEAPMEM_CONF_TRACE */
+
+#if HEAPMEM_TRACE
+#include <stdio.h>
+#define TRACE(...) do {                         \
+    if(!trace_nested) {                         \
+      printf("heapmem: " __VA_ARGS__);          \
+    }                                           \
+  } while(0)
+/* Set while heapmem_realloc() calls the other API functions, so that
+   only the realloc operation itself is traced. */
+static uint8_t trace_nested;
+#else
+#define TRACE(...)
+#endif /* HEAPMEM_TRACE */
+
 /* The HEAPMEM_CONF_ARENA_SIZE parameter determines the size of the
    space that will be statically allocated in this module. */
 #ifdef HEAPMEM_CONF_ARENA_SIZE
@@ -81,6 +106,21 @@
 #define CHUNK_SEARCH_MAX 16
 #endif /* HEAPMEM_CONF_SEARCH_MAX */
 
+/*
+ * The HEAPMEM_CONF_SEGREGATED parameter selects the segregated-fit
+ * allocator, which keeps one free list per size class and coalesces
+ * free chunks at deallocation time by using boundary tags.
+ */
+#ifdef HEAPMEM_CONF_SEGREGATED
+#define HEAPMEM_SEGREGATED HEAPMEM_CONF_SEGREGATED
+#else
+#define HEAPMEM_SEGREGATED 0
+#endif /* HEAPMEM_CONF_SEGREGATED */
+
+#if HEAPMEM_SEGREGATED && HEAPMEM_SIZE_CLASSES > 16
+#error "HEAPMEM_CONF_SIZE_CLASSES must not exceed 16"
+#endif
+
 /*
  * The HEAPMEM_CONF_REALLOC parameter determines whether heapmem_realloc() is
  * enabled (non-zero value) or not (zero value).
@@ -134,6 +174,10 @@ typedef struct chunk {
   struct chunk *prev;
   struct chunk *next;
   size_t size;
+#if HEAPMEM_SEGREGATED
+  /* The size of the chunk that precedes this one in memory. */
+  size_t prev_size;
+#endif
   uint8_t flags;
 #if HEAPMEM_DEBUG
   const char *file;
@@ -147,7 +191,18 @@ static char heap_base[HEAPMEM_ARENA_SIZE];
 static size_t heap_usage;
 
 static chunk_t *first_chunk = (chunk_t *)heap_base;
+#if HEAPMEM_SEGREGATED
+static chunk_t *free_lists[HEAPMEM_SIZE_CLASSES];
+/* Bit i is set when free_lists[i] is not empty. */
+static uint16_t class_map;
+/* The size of the last chunk in the heap. */
+static size_t tail_size;
+
+#define PREV_CHUNK(chunk)                                               \
+  ((chunk_t *)((char *)(chunk) - sizeof(chunk_t) - (chunk)->prev_size))
+#else
 static chunk_t *free_list;
+#endif /* HEAPMEM_SEGREGATED */
 
 /* extend_space: Increases the current footprint used in the heap, and
    returns a pointer to the old end. */
@@ -166,6 +221,210 @@ extend_space(size_t size)
   return old_usage;
 }
 
+/* heapmem_size_class: Find the size class of a chunk size. */
+unsigned
+heapmem_size_class(size_t size)
+{
+  unsigned class;
+
+  for(class = 0; class < HEAPMEM_SIZE_CLASSES - 1; class++) {
+    if(size < ((size_t)HEAPMEM_MIN_CLASS_SIZE << class)) {
+      break;
+    }
+  }
+  return class;
+}
+
+#if HEAPMEM_SEGREGATED
+/* set_chunk_size: Set the size of a chunk, and update the boundary tag
+   of the chunk that follows it. */
+static void
+set_chunk_size(chunk_t * const chunk, size_t size)
+{
+  chunk->size = size;
+  if(IS_LAST_CHUNK(chunk)) {
+    tail_size = size;
+  } else {
+    NEXT_CHUNK(chunk)->prev_size = size;
+  }
+}
+
+/* insert_free: Put a free chunk on the list of its size class. */
+static void
+insert_free(chunk_t * const chunk)
+{
+  unsigned class;
+
+  class = heapmem_size_class(chunk->size);
+  chunk->prev = NULL;
+  chunk->next = free_lists[class];
+  if(chunk->next != NULL) {
+    chunk->next->prev = chunk;
+  }
+  free_lists[class] = chunk;
+  class_map |= 1 << class;
+}
+
+/* remove_free: Remove a free chunk from the list of its size class. */
+static void
+remove_free(chunk_t * const chunk)
+{
+  unsigned class;
+
+  if(chunk->prev != NULL) {
+    chunk->prev->next = chunk->next;
+  } else {
+    class = heapmem_size_class(chunk->size);
+    free_lists[class] = chunk->next;
+    if(chunk->next == NULL) {
+      class_map &= ~(1 << class);
+    }
+  }
+
+  if(chunk->next != NULL) {
+    chunk->next->prev = chunk->prev;
+  }
+}
+
+/*
+ * free_chunk: Mark a chunk as being free, merge it with the adjacent
+ * chunks that are free, and put the result on a free list. Since every
+ * chunk is merged when it is freed, two free chunks are never adjacent,
+ * and the last chunk of the heap is never free.
+ */
+static void
+free_chunk(chunk_t *chunk)
+{
+  chunk_t *neighbor;
+
+  chunk->flags &= ~CHUNK_FLAG_ALLOCATED;
+
+  if(!IS_LAST_CHUNK(chunk)) {
+    neighbor = NEXT_CHUNK(chunk);
+    if(CHUNK_FREE(neighbor)) {
+      remove_free(neighbor);
+      chunk->size += sizeof(chunk_t) + neighbor->size;
+    }
+  }
+
+  if(chunk != first_chunk) {
+    neighbor = PREV_CHUNK(chunk);
+    if(CHUNK_FREE(neighbor)) {
+      remove_free(neighbor);
+      neighbor->size += sizeof(chunk_t) + chunk->size;
+      chunk = neighbor;
+    }
+  }
+
+  if(IS_LAST_CHUNK(chunk)) {
+    /* Release the chunk back into the wilderness. */
+    heap_usage -= sizeof(chunk_t) + chunk->size;
+    tail_size = chunk == first_chunk ? 0 : chunk->prev_size;
+  } else {
+    NEXT_CHUNK(chunk)->prev_size = chunk->size;
+    insert_free(chunk);
+  }
+}
+
+/* allocate_chunk: Mark a chunk as being allocated, and remove it
+   from its free list. */
+static void
+allocate_chunk(chunk_t * const chunk)
+{
+  chunk->flags |= CHUNK_FLAG_ALLOCATED;
+  remove_free(chunk);
+}
+
+/* split_chunk: Keep the part of an allocated chunk beyond the
+   offset free, if it is large enough to form a chunk. */
+static void
+split_chunk(chunk_t * const chunk, size_t offset)
+{
+  chunk_t *new_chunk;
+  size_t new_size;
+
+  offset = ALIGN(offset);
+
+  if(offset + sizeof(chunk_t) < chunk->size) {
+    new_chunk = (chunk_t *)(GET_PTR(chunk) + offset);
+    new_size = chunk->size - sizeof(chunk_t) - offset;
+    chunk->size = offset;
+
+    new_chunk->flags = 0;
+    new_chunk->prev_size = offset;
+    set_chunk_size(new_chunk, new_size);
+    free_chunk(new_chunk);
+  }
+}
+
+/* coalesce_chunks: Merge an allocated chunk with the free chunk that
+   follows it, if there is one. */
+static void
+coalesce_chunks(chunk_t *chunk)
+{
+  chunk_t *next;
+
+  if(!IS_LAST_CHUNK(chunk)) {
+    next = NEXT_CHUNK(chunk);
+    if(CHUNK_FREE(next)) {
+      remove_free(next);
+      set_chunk_size(chunk, chunk->size + sizeof(chunk_t) + next->size);
+    }
+  }
+}
+
+/*
+ * get_free_chunk: Look for the best fit among the first chunks in the
+ * size class of the request. If none of them fits, take the first
+ * chunk of the smallest larger class that has any, as all chunks
+ * there are large enough.
+ */
+static chunk_t *
+get_free_chunk(const size_t size)
+{
+  int i;
+  unsigned class;
+  chunk_t *chunk, *best;
+
+  class = heapmem_size_class(size);
+
+  best = NULL;
+  i = CHUNK_SEARCH_MAX;
+  for(chunk = free_lists[class]; chunk != NULL; chunk = chunk->next) {
+    if(i-- == 0) {
+      break;
+    }
+    if(size <= chunk->size) {
+      if(best == NULL || chunk->size < best->size) {
+        best = chunk;
+      }
+      if(best->size == size) {
+        break;
+      }
+    }
+  }
+
+  if(best == NULL) {
+    for(class++; class < HEAPMEM_SIZE_CLASSES; class++) {
+      if(class_map & (1 << class)) {
+        best = free_lists[class];
+        break;
+      }
+    }
+  }
+
+  if(best != NULL) {
+    allocate_chunk(best);
+    split_chunk(best, size);
+  }
+
+  return best;
+}
+
+#else /* HEAPMEM_SEGREGATED */
+
+#define set_chunk_size(chunk, new_size) ((chunk)->size = (new_size))
+
 /* free_chunk: Mark a chunk as being free, and put it on the free list. */
 static void
 free_chunk(chunk_t * const chunk)
@@ -305,6 +564,7 @@ get_free_chunk(const size_t size)
 
   return best;
 }
+#endif /* HEAPMEM_SEGREGATED */
 
 /*
  * heapmem_alloc: Allocate an object of the specified size, returning
@@ -335,9 +595,13 @@ heapmem_alloc(size_t size)
   if(chunk == NULL) {
     chunk = extend_space(sizeof(chunk_t) + size);
     if(chunk == NULL) {
+      TRACE("a %p %lu %s:%u\n", NULL, (unsigned long)size, file, line);
       return NULL;
     }
-    chunk->size = size;
+#if HEAPMEM_SEGREGATED
+    chunk->prev_size = tail_size;
+#endif
+    set_chunk_size(chunk, size);
   }
 
   chunk->flags = CHUNK_FLAG_ALLOCATED;
@@ -348,6 +612,7 @@ heapmem_alloc(size_t size)
 #endif
 
   PRINTF("%s ptr %p size %lu\n", __func__, GET_PTR(chunk), (unsigned long)size);
+  TRACE("a %p %lu %s:%u\n", GET_PTR(chunk), (unsigned long)size, file, line);
 
   return GET_PTR(chunk);
 }
@@ -378,6 +643,7 @@ heapmem_free(void *ptr)
 
     PRINTF("%s ptr %p, allocated at %s:%u\n", __func__, ptr,
            chunk->file, chunk->line);
+    TRACE("f %p %s:%u\n", ptr, file, line);
 
     free_chunk(chunk);
   }
@@ -415,6 +681,17 @@ heapmem_realloc(void *ptr, size_t size)
   PRINTF("%s ptr %p size %u at %s:%u\n",
          __func__, ptr, (unsigned)size, file, line);
 
+#if HEAPMEM_TRACE
+  if(!trace_nested) {
+    trace_nested = 1;
+    newptr = heapmem_realloc_debug(ptr, size, file, line);
+    trace_nested = 0;
+    TRACE("r %p %p %lu %s:%u\n", ptr, newptr, (unsigned long)size,
+          file, line);
+    return newptr;
+  }
+#endif /* HEAPMEM_TRACE */
+
   /* Special cases in which we can hand off the execution to other functions. */
   if(ptr == NULL) {
     return heapmem_alloc(size);
@@ -447,7 +724,7 @@ heapmem_realloc(void *ptr, size_t size)
      * extend the heap.
      */
     if(extend_space(size_adj) != NULL) {
-      chunk->size = size;
+      set_chunk_size(chunk, size);
       return ptr;
     }
   } else {
@@ -496,13 +773,29 @@ heapmem_stats(heapmem_stats_t *stats)
       chunk = NEXT_CHUNK(chunk)) {
     if(CHUNK_ALLOCATED(chunk)) {
       stats->allocated += chunk->size;
+      stats->classes[heapmem_size_class(chunk->size)].allocated++;
     } else {
+#if !HEAPMEM_SEGREGATED
       coalesce_chunks(chunk);
+#endif
       stats->available += chunk->size;
+      stats->classes[heapmem_size_class(chunk->size)].free++;
+      if(chunk->size > stats->largest_free) {
+        stats->largest_free = chunk->size;
+      }
     }
     stats->overhead += sizeof(chunk_t);
   }
   stats->available += HEAPMEM_ARENA_SIZE - heap_usage;
   stats->footprint = heap_usage;
   stats->chunks = stats->overhead / sizeof(chunk_t);
+
+  /* The unused end of the arena counts as a free block. */
+  if(HEAPMEM_ARENA_SIZE - heap_usage > stats->largest_free) {
+    stats->largest_free = HEAPMEM_ARENA_SIZE - heap_usage;
+  }
+  if(stats->available > 0) {
+    stats->fragmentation = 100 -
+      (unsigned)(stats->largest_free * 100 / stats->available);
+  }
 }
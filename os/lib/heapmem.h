@@ -47,6 +47,14 @@
  * adds some memory overhead compared to a single-linked list, it
  * improves the performance of list management.
  *
+ * With HEAPMEM_CONF_SEGREGATED set to a non-zero value, the free
+ * chunks are instead kept in one list per size class, and each chunk
+ * header records the size of the chunk preceding it in memory (a
+ * boundary tag). A freed chunk is then merged with its free neighbours
+ * immediately, and an allocation takes the first chunk of a larger
+ * class when its own class has no chunk that fits, so that neither
+ * operation has to walk the heap.
+ *
  * Internally, allocated chunks can be retrieved using the pointer to
  * the allocated memory returned by heapmem_alloc() and
  * heapmem_realloc(), because the chunk structure immediately precedes
@@ -76,16 +84,53 @@
 
 #include <stdlib.h>
 
+/*
+ * The chunks are grouped by size into HEAPMEM_CONF_SIZE_CLASSES
+ * classes. Class i holds the chunks smaller than
+ * HEAPMEM_CONF_MIN_CLASS_SIZE << i, and the last class holds all
+ * larger chunks. The classes are used for the free lists of the
+ * segregated mode, and for the statistics in both modes.
+ */
+#ifdef HEAPMEM_CONF_SIZE_CLASSES
+#define HEAPMEM_SIZE_CLASSES HEAPMEM_CONF_SIZE_CLASSES
+#else
+#define HEAPMEM_SIZE_CLASSES 8
+#endif /* HEAPMEM_CONF_SIZE_CLASSES */
+
+#ifdef HEAPMEM_CONF_MIN_CLASS_SIZE
+#define HEAPMEM_MIN_CLASS_SIZE HEAPMEM_CONF_MIN_CLASS_SIZE
+#else
+#define HEAPMEM_MIN_CLASS_SIZE 16
+#endif /* HEAPMEM_CONF_MIN_CLASS_SIZE */
+
 typedef struct heapmem_stats {
   size_t allocated;
   size_t overhead;
   size_t available;
   size_t footprint;
   size_t chunks;
+  /* The largest free block, which may be the unused end of the arena. */
+  size_t largest_free;
+  /* The share of the available memory, in percent, that lies outside
+     the largest free block. */
+  unsigned fragmentation;
+  /* The number of allocated and free chunks in each size class. */
+  struct {
+    unsigned allocated;
+    unsigned free;
+  } classes[HEAPMEM_SIZE_CLASSES];
 } heapmem_stats_t;
 
 #if HEAPMEM_DEBUG
 
+/*
+ * With HEAPMEM_CONF_TRACE set to a non-zero value, each call prints a
+ * trace line that starts with "heapmem:", followed by the operation
+ * ('a', 'r' or 'f'), the pointers involved, the requested size, and
+ * the caller's file and line. Such traces can be replayed with the
+ * heapmem benchmark in examples/benchmarks/heapmem-replay.
+ */
+
 #define heapmem_alloc(size) heapmem_alloc_debug((size), __FILE__, __LINE__)
 #define heapmem_realloc(ptr, size) heapmem_realloc_debug((ptr), (size), __FILE__, __LINE__)
 #define heapmem_free(ptr) heapmem_free_debug((ptr), __FILE__, __LINE__)
@@ -161,6 +206,14 @@ void heapmem_free(void *ptr);
 
 void heapmem_stats(heapmem_stats_t *stats);
 
+/**
+ * \brief      Obtain the size class of a chunk size.
+ * \param size The size of a chunk, in bytes.
+ * \return     The size class, between 0 and HEAPMEM_SIZE_CLASSES - 1.
+ */
+
+unsigned heapmem_size_class(size_t size);
+
 #endif /* !HEAPMEM_H */
 
 /** @} */
@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Streaming, zero-copy JSON tokenizer.
+ */
+
+#include "jsontok.h"
+#include <limits.h>
+#include <string.h>
+
+/* What the grammar allows next */
+enum {
+  EXPECT_VALUE,
+  EXPECT_VALUE_OR_END,
+  EXPECT_NAME,
+  EXPECT_NAME_OR_END,
+  EXPECT_COLON,
+  EXPECT_COMMA_OR_END,
+  EXPECT_NOTHING
+};
+
+/* The token being scanned when a chunk ended */
+enum {
+  LEX_NONE,
+  LEX_STRING,
+  LEX_NAME,
+  LEX_NUMBER,
+  LEX_LITERAL
+};
+/*--------------------------------------------------------------------*/
+static int
+fail(struct jsontok_state *state, char error)
+{
+  state->error = error;
+  return JSONTOK_ERROR;
+}
+/*--------------------------------------------------------------------*/
+static void
+end_value(struct jsontok_state *state)
+{
+  state->lex = LEX_NONE;
+  state->expect = state->depth == 0 ? EXPECT_NOTHING : EXPECT_COMMA_OR_END;
+}
+/*--------------------------------------------------------------------*/
+static int
+set_token(struct jsontok_state *state, struct jsontok_token *token,
+          char type, const char *value, uint16_t len, uint8_t flags)
+{
+  token->type = type;
+  token->value = value;
+  token->len = len;
+  token->depth = state->depth;
+  token->flags = flags;
+  return JSONTOK_TOKEN;
+}
+/*--------------------------------------------------------------------*/
+/* The length of the escape sequence starting with the n bytes at esc */
+static uint8_t
+escape_length(const char *esc, uint8_t n)
+{
+  return n >= 2 && esc[1] == 'u' ? 6 : 2;
+}
+/*--------------------------------------------------------------------*/
+static int
+scan_string(struct jsontok_state *state, struct jsontok_token *token)
+{
+  char type = state->lex == LEX_NAME ? JSON_TYPE_PAIR_NAME : JSON_TYPE_STRING;
+  const char *p;
+  const char *end;
+  uint16_t start;
+  uint8_t flags;
+  uint8_t n;
+  char c;
+
+  /* Complete an escape that the previous chunk ended in */
+  if(state->atom_len > 0) {
+    while(state->pos < state->len &&
+          state->atom_len < escape_length(state->atom, state->atom_len)) {
+      state->atom[state->atom_len++] = state->buf[state->pos++];
+    }
+    if(state->atom_len < escape_length(state->atom, state->atom_len)) {
+      return state->last ? fail(state, JSON_ERROR_SYNTAX) : JSONTOK_NEED_MORE;
+    }
+    n = state->atom_len;
+    state->atom_len = 0;
+    return set_token(state, token, type, state->atom, n,
+                     JSONTOK_FLAG_PARTIAL | JSONTOK_FLAG_ESCAPED);
+  }
+
+  start = state->pos;
+  flags = 0;
+  /* scan with local cursors: stores through state would alias the input */
+  p = state->buf + start;
+  end = state->buf + state->len;
+  while(p < end) {
+    c = *p;
+    if(c == '"') {
+      state->pos = p + 1 - state->buf;
+      if(state->lex == LEX_NAME) {
+        state->lex = LEX_NONE;
+        state->expect = EXPECT_COLON;
+      } else {
+        end_value(state);
+      }
+      return set_token(state, token, type, state->buf + start,
+                       p - state->buf - start, flags);
+    }
+    if(c == '\\') {
+      flags |= JSONTOK_FLAG_ESCAPED;
+      n = escape_length(p, MIN(end - p, 2));
+      if(p + n > end) {
+        /* Hold the split escape until the next chunk completes it */
+        state->atom_len = end - p;
+        memcpy(state->atom, p, state->atom_len);
+        p = end;
+        break;
+      }
+      p += n;
+      continue;
+    }
+    if((unsigned char)c < 0x20) {
+      state->pos = p - state->buf;
+      return fail(state, JSON_ERROR_SYNTAX);
+    }
+    p++;
+  }
+  state->pos = p - state->buf;
+
+  if(state->last) {
+    return fail(state, JSON_ERROR_SYNTAX);
+  }
+  if(state->pos - start - state->atom_len == 0) {
+    return JSONTOK_NEED_MORE;
+  }
+  return set_token(state, token, type, state->buf + start,
+                   state->pos - start - state->atom_len,
+                   flags | JSONTOK_FLAG_PARTIAL);
+}
+/*--------------------------------------------------------------------*/
+static int
+is_atom_char(char c)
+{
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+    c == '-' || c == '+' || c == '.' || c == 'E';
+}
+/*--------------------------------------------------------------------*/
+static int
+scan_atom(struct jsontok_state *state, struct jsontok_token *token)
+{
+  const char *value;
+  uint16_t start;
+  uint16_t len;
+
+  start = state->pos;
+  len = 0;
+  while(start + len < state->len && is_atom_char(state->buf[start + len])) {
+    len++;
+  }
+  state->pos = start + len;
+
+  if(state->atom_len > 0 || (state->pos == state->len && !state->last)) {
+    /* The token crosses a chunk boundary: gather it in the state */
+    if(state->atom_len + len > JSONTOK_ATOM_SIZE) {
+      return fail(state, JSON_ERROR_SYNTAX);
+    }
+    memcpy(state->atom + state->atom_len, state->buf + start, len);
+    state->atom_len += len;
+    if(state->pos == state->len && !state->last) {
+      return JSONTOK_NEED_MORE;
+    }
+    value = state->atom;
+    len = state->atom_len;
+    state->atom_len = 0;
+  } else {
+    value = state->buf + start;
+  }
+
+  if(state->lex == LEX_NUMBER) {
+    end_value(state);
+    return set_token(state, token, JSON_TYPE_NUMBER, value, len, 0);
+  }
+
+  if(len == 4 && memcmp(value, "true", 4) == 0) {
+    end_value(state);
+    return set_token(state, token, JSON_TYPE_TRUE, value, len, 0);
+  }
+  if(len == 5 && memcmp(value, "false", 5) == 0) {
+    end_value(state);
+    return set_token(state, token, JSON_TYPE_FALSE, value, len, 0);
+  }
+  if(len == 4 && memcmp(value, "null", 4) == 0) {
+    end_value(state);
+    return set_token(state, token, JSON_TYPE_NULL, value, len, 0);
+  }
+  return fail(state, JSON_ERROR_SYNTAX);
+}
+/*--------------------------------------------------------------------*/
+void
+jsontok_init(struct jsontok_state *state)
+{
+  memset(state, 0, sizeof(*state));
+  state->expect = EXPECT_VALUE;
+  state->lex = LEX_NONE;
+}
+/*--------------------------------------------------------------------*/
+void
+jsontok_feed(struct jsontok_state *state, const char *data, uint16_t len,
+             int last)
+{
+  state->buf = data;
+  state->len = len;
+  state->pos = 0;
+  state->last = last;
+}
+/*--------------------------------------------------------------------*/
+int
+jsontok_next(struct jsontok_state *state, struct jsontok_token *token)
+{
+  uint16_t pos;
+  char open;
+  char c;
+
+  if(state->error) {
+    return JSONTOK_ERROR;
+  }
+
+  switch(state->lex) {
+  case LEX_STRING:
+  case LEX_NAME:
+    return scan_string(state, token);
+  case LEX_NUMBER:
+  case LEX_LITERAL:
+    return scan_atom(state, token);
+  }
+
+  for(;;) {
+    pos = state->pos;
+    while(pos < state->len &&
+          ((c = state->buf[pos]) == ' ' || c == '\n' ||
+           c == '\r' || c == '\t')) {
+      pos++;
+    }
+    state->pos = pos;
+    if(state->pos == state->len) {
+      if(!state->last) {
+        return JSONTOK_NEED_MORE;
+      }
+      if(state->expect == EXPECT_NOTHING) {
+        return JSONTOK_DONE;
+      }
+      return fail(state, JSON_ERROR_SYNTAX);
+    }
+
+    c = state->buf[state->pos];
+    switch(c) {
+    case '{':
+    case '[':
+      if(state->expect != EXPECT_VALUE &&
+         state->expect != EXPECT_VALUE_OR_END) {
+        return fail(state, c == '{' ? JSON_ERROR_UNEXPECTED_OBJECT :
+                    JSON_ERROR_UNEXPECTED_ARRAY);
+      }
+      if(state->depth == JSONTOK_MAX_DEPTH) {
+        return fail(state, JSON_ERROR_SYNTAX);
+      }
+      set_token(state, token, c, state->buf + state->pos, 1, 0);
+      state->stack[state->depth++] = c;
+      state->expect = c == '{' ? EXPECT_NAME_OR_END : EXPECT_VALUE_OR_END;
+      state->pos++;
+      return JSONTOK_TOKEN;
+
+    case '}':
+    case ']':
+      open = c == '}' ? '{' : '[';
+      if(state->depth == 0 || state->stack[state->depth - 1] != open ||
+         (state->expect != EXPECT_COMMA_OR_END &&
+          state->expect != (open == '{' ? EXPECT_NAME_OR_END :
+                            EXPECT_VALUE_OR_END))) {
+        return fail(state, c == '}' ? JSON_ERROR_UNEXPECTED_END_OF_OBJECT :
+                    JSON_ERROR_UNEXPECTED_END_OF_ARRAY);
+      }
+      state->depth--;
+      set_token(state, token, c, state->buf + state->pos, 1, 0);
+      state->pos++;
+      end_value(state);
+      return JSONTOK_TOKEN;
+
+    case ',':
+      if(state->expect != EXPECT_COMMA_OR_END) {
+        return fail(state, JSON_ERROR_SYNTAX);
+      }
+      state->expect = state->stack[state->depth - 1] == '{' ?
+        EXPECT_NAME : EXPECT_VALUE;
+      state->pos++;
+      break;
+
+    case ':':
+      if(state->expect != EXPECT_COLON) {
+        return fail(state, JSON_ERROR_SYNTAX);
+      }
+      state->expect = EXPECT_VALUE;
+      state->pos++;
+      break;
+
+    case '"':
+      if(state->expect == EXPECT_NAME || state->expect == EXPECT_NAME_OR_END) {
+        state->lex = LEX_NAME;
+      } else if(state->expect == EXPECT_VALUE ||
+                state->expect == EXPECT_VALUE_OR_END) {
+        state->lex = LEX_STRING;
+      } else {
+        return fail(state, JSON_ERROR_UNEXPECTED_STRING);
+      }
+      state->pos++;
+      return scan_string(state, token);
+
+    default:
+      if(state->expect != EXPECT_VALUE &&
+         state->expect != EXPECT_VALUE_OR_END) {
+        return fail(state, JSON_ERROR_SYNTAX);
+      }
+      if(c == '-' || (c >= '0' && c <= '9')) {
+        state->lex = LEX_NUMBER;
+      } else if(c == 't' || c == 'f' || c == 'n') {
+        state->lex = LEX_LITERAL;
+      } else {
+        return fail(state, JSON_ERROR_SYNTAX);
+      }
+      return scan_atom(state, token);
+    }
+  }
+}
+/*--------------------------------------------------------------------*/
+static int
+hex_value(const char *s, uint16_t *value)
+{
+  uint8_t i;
+  char c;
+
+  *value = 0;
+  for(i = 0; i < 4; i++) {
+    c = s[i];
+    if(c >= '0' && c <= '9') {
+      c -= '0';
+    } else if(c >= 'a' && c <= 'f') {
+      c -= 'a' - 10;
+    } else if(c >= 'A' && c <= 'F') {
+      c -= 'A' - 10;
+    } else {
+      return 0;
+    }
+    *value = (*value << 4) | c;
+  }
+  return 1;
+}
+/*--------------------------------------------------------------------*/
+int
+jsontok_copy_string(const struct jsontok_token *token, char *buf, int size)
+{
+  const char *s = token->value;
+  const char *end = token->value + token->len;
+  uint32_t cp;
+  uint16_t u;
+  int o;
+  char c;
+
+  for(o = 0; s < end; s++) {
+    c = *s;
+    if(c == '\\') {
+      if(++s == end) {
+        return -1;
+      }
+      switch(*s) {
+      case 'b': c = '\b'; break;
+      case 'f': c = '\f'; break;
+      case 'n': c = '\n'; break;
+      case 'r': c = '\r'; break;
+      case 't': c = '\t'; break;
+      case 'u':
+        if(end - s < 5 || !hex_value(s + 1, &u)) {
+          return -1;
+        }
+        s += 4;
+        cp = u;
+        /* a surrogate pair in the same slice */
+        if(u >= 0xd800 && u < 0xdc00 && end - s >= 7 &&
+           s[1] == '\\' && s[2] == 'u' && hex_value(s + 3, &u) &&
+           u >= 0xdc00 && u < 0xe000) {
+          cp = 0x10000 + ((cp - 0xd800) << 10) + (u - 0xdc00);
+          s += 6;
+        }
+        /* encode as UTF-8 */
+        if(cp < 0x80) {
+          c = cp;
+          break;
+        }
+        if(o + (cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4) >= size) {
+          return -1;
+        }
+        if(cp < 0x800) {
+          buf[o++] = 0xc0 | (cp >> 6);
+        } else if(cp < 0x10000) {
+          buf[o++] = 0xe0 | (cp >> 12);
+          buf[o++] = 0x80 | ((cp >> 6) & 0x3f);
+        } else {
+          buf[o++] = 0xf0 | (cp >> 18);
+          buf[o++] = 0x80 | ((cp >> 12) & 0x3f);
+          buf[o++] = 0x80 | ((cp >> 6) & 0x3f);
+        }
+        buf[o++] = 0x80 | (cp & 0x3f);
+        continue;
+      default:
+        /* \" \\ and \/ stand for themselves */
+        c = *s;
+        break;
+      }
+    }
+    if(o + 1 >= size) {
+      return -1;
+    }
+    buf[o++] = c;
+  }
+  if(size > 0) {
+    buf[o] = '\0';
+  }
+  return o;
+}
+/*--------------------------------------------------------------------*/
+int
+jsontok_equals(const struct jsontok_token *token, const char *str)
+{
+  return strlen(str) == token->len && memcmp(token->value, str, token->len) == 0;
+}
+/*--------------------------------------------------------------------*/
+int
+jsontok_get_long(const struct jsontok_token *token, long *value)
+{
+  unsigned long v;
+  unsigned long limit;
+  uint16_t i;
+  int negative;
+
+  if(token->type != JSON_TYPE_NUMBER || token->len == 0) {
+    return 0;
+  }
+  i = 0;
+  negative = token->value[0] == '-';
+  if(negative) {
+    i++;
+  }
+  if(i == token->len) {
+    return 0;
+  }
+  limit = negative ? -(unsigned long)LONG_MIN : LONG_MAX;
+  for(v = 0; i < token->len; i++) {
+    if(token->value[i] < '0' || token->value[i] > '9' ||
+       v > (limit - (token->value[i] - '0')) / 10) {
+      return 0;
+    }
+    v = v * 10 + (token->value[i] - '0');
+  }
+  *value = negative ? (long)(0 - v) : (long)v;
+  return 1;
+}
+/*--------------------------------------------------------------------*/
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Streaming, zero-copy JSON tokenizer.
+ *
+ *         The tokenizer returns one token at a time as a slice of the
+ *         input: a type, a pointer and a length. Nothing is copied or
+ *         decoded. The input may arrive in chunks, e.g. TCP segments or
+ *         CoAP Block1 payloads. The tokenizer stops at the end of a chunk
+ *         and continues where it left off when the next chunk is fed.
+ *
+ *         Strings and names can be any length. A string that crosses a
+ *         chunk boundary is returned in fragments: every fragment but the
+ *         last has JSONTOK_FLAG_PARTIAL set. A fragment never splits an
+ *         escape sequence. Numbers and true, false and null that cross a
+ *         boundary are gathered in a small buffer in the state, of
+ *         JSONTOK_ATOM_SIZE bytes.
+ */
+
+#ifndef JSONTOK_H_
+#define JSONTOK_H_
+
+#include "contiki.h"
+#include "json.h"
+
+#ifdef JSONTOK_CONF_MAX_DEPTH
+#define JSONTOK_MAX_DEPTH JSONTOK_CONF_MAX_DEPTH
+#else
+#define JSONTOK_MAX_DEPTH 10
+#endif /* JSONTOK_CONF_MAX_DEPTH */
+
+#ifdef JSONTOK_CONF_ATOM_SIZE
+#define JSONTOK_ATOM_SIZE JSONTOK_CONF_ATOM_SIZE
+#else
+#define JSONTOK_ATOM_SIZE 24
+#endif /* JSONTOK_CONF_ATOM_SIZE */
+
+/* Token types besides those in json.h */
+#define JSON_TYPE_OBJECT_END '}'
+#define JSON_TYPE_ARRAY_END  ']'
+
+/* Return values of jsontok_next() */
+#define JSONTOK_ERROR     -1
+#define JSONTOK_NEED_MORE  0
+#define JSONTOK_TOKEN      1
+#define JSONTOK_DONE       2
+
+/* Token flags */
+#define JSONTOK_FLAG_PARTIAL 0x01 /* more of this string follows */
+#define JSONTOK_FLAG_ESCAPED 0x02 /* the slice contains escapes */
+
+struct jsontok_token {
+  const char *value;
+  uint16_t len;
+  /* JSON_TYPE_OBJECT, _OBJECT_END, _ARRAY, _ARRAY_END, _PAIR_NAME,
+     _STRING, _NUMBER, _TRUE, _FALSE or _NULL */
+  char type;
+  /* Nesting depth: 0 for a top-level value, 1 inside it, and so on */
+  uint8_t depth;
+  uint8_t flags;
+};
+
+struct jsontok_state {
+  const char *buf;
+  uint16_t len;
+  uint16_t pos;
+  uint8_t last;
+  uint8_t expect;
+  uint8_t lex;
+  uint8_t depth;
+  uint8_t error;
+  uint8_t atom_len;
+  uint8_t escape_len;
+  char stack[JSONTOK_MAX_DEPTH];
+  char atom[JSONTOK_ATOM_SIZE];
+};
+
+/**
+ * \brief       Initialize a tokenizer state.
+ * \param state The tokenizer state
+ */
+void jsontok_init(struct jsontok_state *state);
+
+/**
+ * \brief       Hand the next chunk of input to the tokenizer.
+ * \param state The tokenizer state
+ * \param data  The chunk, which must stay valid while its tokens are used
+ * \param len   The length of the chunk
+ * \param last  Non-zero if this is the end of the input
+ */
+void jsontok_feed(struct jsontok_state *state, const char *data,
+                  uint16_t len, int last);
+
+/**
+ * \brief       Get the next token.
+ * \param state The tokenizer state
+ * \param token Filled in with the token if JSONTOK_TOKEN is returned
+ * \return      JSONTOK_TOKEN if a token was found; JSONTOK_NEED_MORE if
+ *              the chunk is used up and the next one must be fed;
+ *              JSONTOK_DONE at the end of a complete document; or
+ *              JSONTOK_ERROR on a syntax error, with the code from json.h
+ *              in state->error.
+ */
+int jsontok_next(struct jsontok_state *state, struct jsontok_token *token);
+
+/**
+ * \brief       Decode a string token into a buffer.
+ * \param token A string or name token, or a fragment of one
+ * \param buf   The buffer, always NUL-terminated
+ * \param size  The size of the buffer
+ * \return      The length of the decoded string, or -1 if it did not fit
+ *
+ *              Escapes are decoded, \\u escapes to UTF-8.
+ */
+int jsontok_copy_string(const struct jsontok_token *token, char *buf,
+                        int size);
+
+/**
+ * \brief       Compare a token with a string.
+ * \return      Non-zero if the (undecoded) token equals the string
+ */
+int jsontok_equals(const struct jsontok_token *token, const char *str);
+
+/**
+ * \brief       Parse a number token as an integer.
+ * \param token A number token
+ * \param value Set to the value
+ * \return      Non-zero on success, zero if the token is not an integer
+ *              or does not fit in a long
+ */
+int jsontok_get_long(const struct jsontok_token *token, long *value);
+
+#endif /* JSONTOK_H_ */
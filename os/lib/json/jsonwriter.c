@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Buffered JSON writer.
+ */
+
+#include "jsonwriter.h"
+#include <string.h>
+
+static const char hex[] = "0123456789abcdef";
+/*--------------------------------------------------------------------*/
+static void
+put(struct jsonwriter *w, const char *data, uint16_t len)
+{
+  if(w->overflow || w->len + len >= w->size) {
+    w->overflow = 1;
+    return;
+  }
+  memcpy(w->buf + w->len, data, len);
+  w->len += len;
+  w->buf[w->len] = '\0';
+}
+/*--------------------------------------------------------------------*/
+static void
+put_char(struct jsonwriter *w, char c)
+{
+  if(w->overflow || w->len + 1 >= w->size) {
+    w->overflow = 1;
+    return;
+  }
+  w->buf[w->len++] = c;
+  w->buf[w->len] = '\0';
+}
+/*--------------------------------------------------------------------*/
+/* Writes the separator that goes before a value */
+static void
+begin_value(struct jsonwriter *w)
+{
+  if(w->after_name) {
+    w->after_name = 0;
+    return;
+  }
+  if(w->has_element & (1UL << w->depth)) {
+    put_char(w, ',');
+  }
+  w->has_element |= 1UL << w->depth;
+}
+/*--------------------------------------------------------------------*/
+static void
+begin_container(struct jsonwriter *w, char open)
+{
+  begin_value(w);
+  put_char(w, open);
+  if(w->depth == JSONWRITER_MAX_DEPTH) {
+    w->overflow = 1;
+    return;
+  }
+  w->depth++;
+  w->has_element &= ~(1UL << w->depth);
+}
+/*--------------------------------------------------------------------*/
+static void
+end_container(struct jsonwriter *w, char close)
+{
+  if(w->depth > 0) {
+    w->depth--;
+  }
+  put_char(w, close);
+}
+/*--------------------------------------------------------------------*/
+static void
+put_string(struct jsonwriter *w, const char *str, uint16_t len)
+{
+  char *out;
+  char *end;
+  unsigned char c;
+
+  if(w->overflow) {
+    return;
+  }
+  /* copy directly into the buffer, keeping room for the final NUL */
+  out = w->buf + w->len;
+  end = w->buf + w->size - 1;
+  if(out == end) {
+    w->overflow = 1;
+    return;
+  }
+  *out++ = '"';
+  while(len-- > 0) {
+    c = *str++;
+    if(c >= 0x20 && c != '"' && c != '\\') {
+      if(out == end) {
+        break;
+      }
+      *out++ = c;
+      continue;
+    }
+    if(end - out < 6) {
+      break;
+    }
+    *out++ = '\\';
+    switch(c) {
+    case '"':  *out++ = '"';  break;
+    case '\\': *out++ = '\\'; break;
+    case '\b': *out++ = 'b';  break;
+    case '\f': *out++ = 'f';  break;
+    case '\n': *out++ = 'n';  break;
+    case '\r': *out++ = 'r';  break;
+    case '\t': *out++ = 't';  break;
+    default:
+      *out++ = 'u';
+      *out++ = '0';
+      *out++ = '0';
+      *out++ = hex[c >> 4];
+      *out++ = hex[c & 0xf];
+      break;
+    }
+  }
+  if(len != (uint16_t)-1 || out == end) {
+    /* ran out of room: drop the partial string */
+    w->buf[w->len] = '\0';
+    w->overflow = 1;
+    return;
+  }
+  *out++ = '"';
+  *out = '\0';
+  w->len = out - w->buf;
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_init(struct jsonwriter *w, char *buf, uint16_t size)
+{
+  w->buf = buf;
+  w->size = size;
+  w->len = 0;
+  w->has_element = 0;
+  w->depth = 0;
+  w->after_name = 0;
+  w->overflow = size == 0;
+  if(size > 0) {
+    buf[0] = '\0';
+  }
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_object_begin(struct jsonwriter *w)
+{
+  begin_container(w, '{');
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_object_end(struct jsonwriter *w)
+{
+  end_container(w, '}');
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_array_begin(struct jsonwriter *w)
+{
+  begin_container(w, '[');
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_array_end(struct jsonwriter *w)
+{
+  end_container(w, ']');
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_name(struct jsonwriter *w, const char *name)
+{
+  begin_value(w);
+  put_string(w, name, strlen(name));
+  put_char(w, ':');
+  w->after_name = 1;
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_string(struct jsonwriter *w, const char *str)
+{
+  jsonwriter_string_len(w, str, strlen(str));
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_string_len(struct jsonwriter *w, const char *str, uint16_t len)
+{
+  begin_value(w);
+  put_string(w, str, len);
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_uint(struct jsonwriter *w, unsigned long value)
+{
+  char digits[20];
+  uint8_t i;
+
+  begin_value(w);
+  i = sizeof(digits);
+  do {
+    digits[--i] = '0' + value % 10;
+    value /= 10;
+  } while(value > 0);
+  put(w, digits + i, sizeof(digits) - i);
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_int(struct jsonwriter *w, long value)
+{
+  char digits[21];
+  unsigned long v;
+  uint8_t i;
+
+  begin_value(w);
+  v = value < 0 ? 0 - (unsigned long)value : (unsigned long)value;
+  i = sizeof(digits);
+  do {
+    digits[--i] = '0' + v % 10;
+    v /= 10;
+  } while(v > 0);
+  if(value < 0) {
+    digits[--i] = '-';
+  }
+  put(w, digits + i, sizeof(digits) - i);
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_bool(struct jsonwriter *w, int value)
+{
+  begin_value(w);
+  if(value) {
+    put(w, "true", 4);
+  } else {
+    put(w, "false", 5);
+  }
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_null(struct jsonwriter *w)
+{
+  begin_value(w);
+  put(w, "null", 4);
+}
+/*--------------------------------------------------------------------*/
+void
+jsonwriter_raw(struct jsonwriter *w, const char *json, uint16_t len)
+{
+  begin_value(w);
+  put(w, json, len);
+}
+/*--------------------------------------------------------------------*/
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *         Buffered JSON writer.
+ *
+ *         Serializes JSON straight into a caller-supplied buffer and
+ *         inserts the separators itself. If the output does not fit, the
+ *         writer stops writing and sets a sticky overflow flag, so a
+ *         whole document can be written without checking every call.
+ *         The output is always NUL-terminated.
+ *
+ *         Example, producing {"temp":21,"ok":true}:
+ *
+ *         jsonwriter_init(&w, buf, sizeof(buf));
+ *         jsonwriter_object_begin(&w);
+ *         jsonwriter_name(&w, "temp");
+ *         jsonwriter_int(&w, 21);
+ *         jsonwriter_name(&w, "ok");
+ *         jsonwriter_bool(&w, 1);
+ *         jsonwriter_object_end(&w);
+ *         if(jsonwriter_overflow(&w)) { ... }
+ */
+
+#ifndef JSONWRITER_H_
+#define JSONWRITER_H_
+
+#include "contiki.h"
+#include "json.h"
+
+#ifdef JSONWRITER_CONF_MAX_DEPTH
+#define JSONWRITER_MAX_DEPTH JSONWRITER_CONF_MAX_DEPTH
+#else
+#define JSONWRITER_MAX_DEPTH 10
+#endif /* JSONWRITER_CONF_MAX_DEPTH */
+
+#if JSONWRITER_MAX_DEPTH > 31
+#error "JSONWRITER_MAX_DEPTH must be at most 31"
+#endif
+
+struct jsonwriter {
+  char *buf;
+  uint16_t size;
+  uint16_t len;
+  /* bit n is set once the container at depth n has an element */
+  uint32_t has_element;
+  uint8_t depth;
+  uint8_t after_name;
+  uint8_t overflow;
+};
+
+/**
+ * \brief      Start writing into a buffer.
+ * \param w    The writer
+ * \param buf  The output buffer
+ * \param size The size of the buffer, including the terminating NUL
+ */
+void jsonwriter_init(struct jsonwriter *w, char *buf, uint16_t size);
+
+void jsonwriter_object_begin(struct jsonwriter *w);
+void jsonwriter_object_end(struct jsonwriter *w);
+void jsonwriter_array_begin(struct jsonwriter *w);
+void jsonwriter_array_end(struct jsonwriter *w);
+
+/**
+ * \brief      Write the name of the next member of an object.
+ */
+void jsonwriter_name(struct jsonwriter *w, const char *name);
+
+/**
+ * \brief      Write a string value, escaping it as needed.
+ */
+void jsonwriter_string(struct jsonwriter *w, const char *str);
+
+/**
+ * \brief      Write the first len bytes of str as a string value.
+ */
+void jsonwriter_string_len(struct jsonwriter *w, const char *str,
+                           uint16_t len);
+
+void jsonwriter_int(struct jsonwriter *w, long value);
+void jsonwriter_uint(struct jsonwriter *w, unsigned long value);
+void jsonwriter_bool(struct jsonwriter *w, int value);
+void jsonwriter_null(struct jsonwriter *w);
+
+/**
+ * \brief      Write an already serialized value, e.g. a formatted number.
+ */
+void jsonwriter_raw(struct jsonwriter *w, const char *json, uint16_t len);
+
+/**
+ * \brief      The length of the output so far, without the NUL.
+ */
+static inline uint16_t
+jsonwriter_len(const struct jsonwriter *w)
+{
+  return w->len;
+}
+
+/**
+ * \brief      Non-zero if the output did not fit the buffer or the
+ *             nesting went deeper than JSONWRITER_MAX_DEPTH.
+ */
+static inline int
+jsonwriter_overflow(const struct jsonwriter *w)
+{
+  return w->overflow;
+}
+
+#endif /* JSONWRITER_H_ */
@@ -43,61 +43,170 @@
  * \author Adam Dunkels <adam@sics.se>
  */
 #include <string.h>
+#include <limits.h>
 
 #include "contiki.h"
 #include "lib/memb.h"
 
+/*---------------------------------------------------------------------------*/
+#if MEMB_STATS
+static struct memb *pools;
+#endif /* MEMB_STATS */
+
+#if MEMB_FREELIST
+/* The free list link is kept in the last bytes of a free block, where
+   it is least likely to overwrite a next pointer that is read after
+   the block has been freed. Blocks too small to hold a link are not
+   free-listed and are found with a scan instead. A link that has been
+   overwritten after the block was freed is detected when it is popped:
+   the free list is then dropped and free blocks are found with a scan,
+   as without the free list. */
+typedef unsigned short memb_link_t;
+#define HAS_LINK(m) ((m)->size >= sizeof(memb_link_t))
+#define LINK(m, i)  ((char *)(m)->mem + ((i) + 1) * (m)->size - \
+                     sizeof(memb_link_t))
+#endif /* MEMB_FREELIST */
+/*---------------------------------------------------------------------------*/
+#if MEMB_STATS
+static void
+memb_register(struct memb *m)
+{
+  if(!m->registered) {
+    m->registered = 1;
+    m->next = pools;
+    pools = m;
+  }
+}
+#endif /* MEMB_STATS */
 /*---------------------------------------------------------------------------*/
 void
 memb_init(struct memb *m)
 {
   memset(m->count, 0, m->num);
   memset(m->mem, 0, m->size * m->num);
+#if MEMB_FREELIST || MEMB_STATS
+  m->used = 0;
+#endif /* MEMB_FREELIST || MEMB_STATS */
+#if MEMB_FREELIST
+  m->free = 0;
+  m->unused = 0;
+#endif /* MEMB_FREELIST */
+#if MEMB_STATS
+  memb_register(m);
+#endif /* MEMB_STATS */
 }
 /*---------------------------------------------------------------------------*/
-void *
-memb_alloc(struct memb *m)
+static int
+find_free(struct memb *m)
 {
   int i;
 
+#if MEMB_FREELIST
+  memb_link_t next;
+
+  if(m->used >= m->num) {
+    return -1;
+  }
+  if(m->free != 0) {
+    i = m->free - 1;
+    memcpy(&next, LINK(m, i), sizeof(next));
+    if(m->count[i] == 0 && next <= m->num) {
+      m->free = next;
+      return i;
+    }
+    /* Written to after it was freed, or not free at all. Blocks that
+       were never allocated are left to the scan as well, so that none
+       is handed out twice. */
+    m->free = 0;
+    m->unused = m->num;
+  } else if(m->unused < m->num) {
+    i = m->unused++;
+    if(m->count[i] == 0) {
+      return i;
+    }
+    /* Not free after all: count[] was changed behind our back, so the
+       order in which the blocks are used can no longer be trusted */
+    m->unused = m->num;
+  }
+#endif /* MEMB_FREELIST */
+
   for(i = 0; i < m->num; ++i) {
     if(m->count[i] == 0) {
-      /* If this block was unused, we increase the reference count to
-	 indicate that it now is used and return a pointer to the
-	 memory block. */
-      ++(m->count[i]);
-      return (void *)((char *)m->mem + (i * m->size));
+      return i;
+    }
+  }
+  return -1;
+}
+/*---------------------------------------------------------------------------*/
+void *
+memb_alloc(struct memb *m)
+{
+  int i;
+
+#if MEMB_STATS
+  memb_register(m);
+#endif /* MEMB_STATS */
+
+  i = find_free(m);
+  if(i < 0) {
+    /* No free block was found, so we return NULL to indicate failure
+       to allocate block. */
+#if MEMB_STATS
+    if(m->failures < USHRT_MAX) {
+      m->failures++;
     }
+#endif /* MEMB_STATS */
+    return NULL;
   }
 
-  /* No free block was found, so we return NULL to indicate failure to
-     allocate block. */
-  return NULL;
+  /* The block was unused, so we increase the reference count to
+     indicate that it now is used and return a pointer to the memory
+     block. */
+  ++(m->count[i]);
+#if MEMB_FREELIST || MEMB_STATS
+  m->used++;
+#endif /* MEMB_FREELIST || MEMB_STATS */
+#if MEMB_STATS
+  if(m->used > m->high_watermark) {
+    m->high_watermark = m->used;
+  }
+#endif /* MEMB_STATS */
+  return (void *)((char *)m->mem + (i * m->size));
 }
 /*---------------------------------------------------------------------------*/
 char
 memb_free(struct memb *m, void *ptr)
 {
   int i;
-  char *ptr2;
+  size_t offset;
 
-  /* Walk through the list of blocks and try to find the block to
-     which the pointer "ptr" points to. */
-  ptr2 = (char *)m->mem;
-  for(i = 0; i < m->num; ++i) {
-    
-    if(ptr2 == (char *)ptr) {
-      /* We've found to block to which "ptr" points so we decrease the
-	 reference count and return the new value of it. */
-      if(m->count[i] > 0) {
-	/* Make sure that we don't deallocate free memory. */
-	--(m->count[i]);
+  /* Find the block to which the pointer "ptr" points */
+  if(!memb_inmemb(m, ptr)) {
+    return -1;
+  }
+  offset = (char *)ptr - (char *)m->mem;
+  if(offset % m->size != 0) {
+    return -1;
+  }
+  i = offset / m->size;
+
+  /* Decrease the reference count and return the new value of it,
+     making sure that we don't deallocate free memory. */
+  if(m->count[i] > 0) {
+    if(--(m->count[i]) == 0) {
+#if MEMB_FREELIST || MEMB_STATS
+      m->used--;
+#endif /* MEMB_FREELIST || MEMB_STATS */
+#if MEMB_FREELIST
+      if(HAS_LINK(m)) {
+        memb_link_t next = m->free;
+        memcpy(LINK(m, i), &next, sizeof(next));
+        m->free = i + 1;
       }
-      return m->count[i];
+#endif /* MEMB_FREELIST */
     }
-    ptr2 += m->size;
   }
-  return -1;
+  return m->count[i];
 }
 /*---------------------------------------------------------------------------*/
 int
@@ -110,6 +219,9 @@ memb_inmemb(struct memb *m, void *ptr)
 int
 memb_numfree(struct memb *m)
 {
+#if MEMB_FREELIST || MEMB_STATS
+  return m->num - m->used;
+#else /* MEMB_FREELIST || MEMB_STATS */
   int i;
   int num_free = 0;
 
@@ -120,5 +232,26 @@ memb_numfree(struct memb *m)
   }
 
   return num_free;
+#endif /* MEMB_FREELIST || MEMB_STATS */
 }
+/*---------------------------------------------------------------------------*/
+#if MEMB_STATS
+struct memb *
+memb_stats_head(void)
+{
+  return pools;
+}
+/*---------------------------------------------------------------------------*/
+void
+memb_stats_reset(void)
+{
+  struct memb *m;
+
+  for(m = pools; m != NULL; m = m->next) {
+    m->high_watermark = m->used;
+    m->failures = 0;
+  }
+}
+#endif /* MEMB_STATS */
+/*---------------------------------------------------------------------------*/
 /** @} */
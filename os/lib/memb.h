@@ -48,6 +48,20 @@
  * memory by the memb_alloc() function, and are deallocated with the
  * memb_free() function.
  *
+ * By default, memb_alloc() scans the pool for a free block. With
+ * MEMB_CONF_FREELIST set to 1, allocation and deallocation take
+ * constant time instead: free blocks are kept in a free list that is
+ * linked through the last two bytes of each free block, and blocks
+ * that have never been allocated are handed out in order. This costs
+ * six bytes of RAM per pool. If a block is written to after it was
+ * freed, the free list is dropped and the blocks on it are found by
+ * the scan.
+ *
+ * With MEMB_CONF_STATS, every pool keeps track of its high watermark
+ * and of the number of failed allocations. Pools register themselves
+ * on memb_init() or on their first allocation, and can be listed with
+ * memb_stats_head(), or from the shell with the memb-stats command.
+ *
  * @{
  */
 
@@ -65,6 +79,36 @@
 
 #include "sys/cc.h"
 
+/** Constant-time allocation from a free list. The link is stored in
+    the freed block, so this is off by default. */
+#ifdef MEMB_CONF_FREELIST
+#define MEMB_FREELIST MEMB_CONF_FREELIST
+#else /* MEMB_CONF_FREELIST */
+#define MEMB_FREELIST 0
+#endif /* MEMB_CONF_FREELIST */
+
+/** Per-pool usage statistics */
+#ifdef MEMB_CONF_STATS
+#define MEMB_STATS MEMB_CONF_STATS
+#else /* MEMB_CONF_STATS */
+#define MEMB_STATS 0
+#endif /* MEMB_CONF_STATS */
+
+/* Initializers of the optional fields of struct memb */
+#if MEMB_FREELIST
+#define MEMB_FREELIST_INIT 0, 0, 0,
+#elif MEMB_STATS
+#define MEMB_FREELIST_INIT 0,
+#else
+#define MEMB_FREELIST_INIT
+#endif
+
+#if MEMB_STATS
+#define MEMB_STATS_INIT(name) #name
+#else /* MEMB_STATS */
+#define MEMB_STATS_INIT(name)
+#endif /* MEMB_STATS */
+
 /**
  * Declare a memory block.
  *
@@ -91,13 +135,34 @@ MEMB(connections, struct connection, 16);
         static structure CC_CONCAT(name,_memb_mem)[num]; \
         static struct memb name = {sizeof(structure), num, \
                                           CC_CONCAT(name,_memb_count), \
-                                          (void *)CC_CONCAT(name,_memb_mem)}
+                                          (void *)CC_CONCAT(name,_memb_mem), \
+                                          MEMB_FREELIST_INIT \
+                                          MEMB_STATS_INIT(name)}
 
 struct memb {
   unsigned short size;
   unsigned short num;
   char *count;
   void *mem;
+#if MEMB_FREELIST || MEMB_STATS
+  /** The number of allocated blocks */
+  unsigned short used;
+#endif /* MEMB_FREELIST || MEMB_STATS */
+#if MEMB_FREELIST
+  /** One more than the index of the first free-listed block, or 0 */
+  unsigned short free;
+  /** The blocks from this index on have never been allocated */
+  unsigned short unused;
+#endif /* MEMB_FREELIST */
+#if MEMB_STATS
+  const char *name;
+  struct memb *next;
+  /** The largest number of blocks allocated at once */
+  unsigned short high_watermark;
+  /** The number of allocations that failed because the pool was full */
+  unsigned short failures;
+  unsigned char registered;
+#endif /* MEMB_STATS */
 };
 
 /**
@@ -132,6 +197,20 @@ int memb_inmemb(struct memb *m, void *ptr);
 
 int  memb_numfree(struct memb *m);
 
+#if MEMB_STATS
+/**
+ * Get the first pool that has been initialized or used. The others
+ * follow through the next field.
+ */
+struct memb *memb_stats_head(void);
+
+/**
+ * Clear the failure counters of all pools and set their high
+ * watermarks to the number of blocks allocated now.
+ */
+void memb_stats_reset(void);
+#endif /* MEMB_STATS */
+
 /** @} */
 /** @} */
 
@@ -37,13 +37,14 @@
  * \defgroup queue Queue library
  *
  * This library provides functions for the creation and manipulation of
- * queues. The library is implemented as a wrapper around the list library.
+ * queues. The library is implemented as a wrapper around the tail list
+ * library, so elements are enqueued in constant time.
  *
  * A queue is declared using the QUEUE macro. Queue elements must be
  * allocated by the calling code and must be of a C struct datatype. In this
  * struct, the first field must be a pointer called \e next. This field will
  * be used by the library to maintain the queue. Application code must not
- * modify this field directly.
+ * modify this field directly. An element can only be in the queue once.
  * @{
  */
 /*---------------------------------------------------------------------------*/
@@ -51,14 +52,14 @@
 #define QUEUE_H_
 /*---------------------------------------------------------------------------*/
 #include "contiki.h"
-#include "lib/list.h"
+#include "lib/tail-list.h"
 
 #include <stdbool.h>
 /*---------------------------------------------------------------------------*/
 /**
  * \brief The queue data type
  */
-typedef list_t queue_t;
+typedef tail_list_t queue_t;
 /*---------------------------------------------------------------------------*/
 /**
  * \brief Define a queue.
@@ -72,7 +73,7 @@ typedef list_t queue_t;
  *
  * \param name The name of the queue.
  */
-#define QUEUE(name) LIST(name)
+#define QUEUE(name) TAIL_LIST(name)
 /*---------------------------------------------------------------------------*/
 struct queue {
   struct queue *next;
@@ -85,18 +86,21 @@ struct queue {
 static inline void
 queue_init(queue_t queue)
 {
-  list_init(queue);
+  tail_list_init(queue);
 }
 /*---------------------------------------------------------------------------*/
 /**
  * \brief Adds an element to the tail of the queue
  * \param queue The queue
  * \param element A pointer to the element to be added
+ *
+ * Nothing happens if the element is already in the queue: unlike with
+ * list_add(), it is not moved to the tail. Dequeue it first to move it.
  */
 static inline void
 queue_enqueue(queue_t queue, void *element)
 {
-  list_add(queue, element);
+  tail_list_add(queue, element);
 }
 /*---------------------------------------------------------------------------*/
 /**
@@ -109,7 +113,7 @@ queue_enqueue(queue_t queue, void *element)
 static inline void *
 queue_dequeue(queue_t queue)
 {
-  return list_pop(queue);
+  return tail_list_pop(queue);
 }
 /*---------------------------------------------------------------------------*/
 /**
@@ -120,7 +124,7 @@ queue_dequeue(queue_t queue)
 static inline void *
 queue_peek(queue_t queue)
 {
-  return list_head(queue);
+  return tail_list_head(queue);
 }
 /*---------------------------------------------------------------------------*/
 /**
@@ -132,7 +136,7 @@ queue_peek(queue_t queue)
 static inline bool
 queue_is_empty(queue_t queue)
 {
-  return *queue == NULL ? true : false;
+  return tail_list_is_empty(queue);
 }
 /*---------------------------------------------------------------------------*/
 #endif /* QUEUE_H_ */
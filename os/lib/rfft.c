@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+/**
+ * \addtogroup rfft
+ * @{
+ *
+ * \file
+ *         Fixed-point real FFT.
+ */
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+#include "lib/rfft.h"
+/*---------------------------------------------------------------------------*/
+#define QUARTER     (RFFT_MAX_SIZE / 4)
+#define MAX_LOG2    10
+
+/* sin(pi / 2 * i / QUARTER) in Q15 for i = 0 ... QUARTER */
+static const int16_t sin_tab[QUARTER + 1] = {
+  0, 201, 402, 603, 804, 1005, 1206, 1407, 1608, 1809,
+  2009, 2210, 2411, 2611, 2811, 3012, 3212, 3412, 3612, 3812,
+  4011, 4211, 4410, 4609, 4808, 5007, 5205, 5404, 5602, 5800,
+  5998, 6195, 6393, 6590, 6787, 6983, 7180, 7376, 7571, 7767,
+  7962, 8157, 8351, 8546, 8740, 8933, 9127, 9319, 9512, 9704,
+  9896, 10088, 10279, 10469, 10660, 10850, 11039, 11228, 11417, 11605,
+  11793, 11980, 12167, 12354, 12540, 12725, 12910, 13095, 13279, 13463,
+  13646, 13828, 14010, 14192, 14373, 14553, 14733, 14912, 15091, 15269,
+  15447, 15624, 15800, 15976, 16151, 16326, 16500, 16673, 16846, 17018,
+  17190, 17361, 17531, 17700, 17869, 18037, 18205, 18372, 18538, 18703,
+  18868, 19032, 19195, 19358, 19520, 19681, 19841, 20001, 20160, 20318,
+  20475, 20632, 20788, 20943, 21097, 21251, 21403, 21555, 21706, 21856,
+  22006, 22154, 22302, 22449, 22595, 22740, 22884, 23028, 23170, 23312,
+  23453, 23593, 23732, 23870, 24008, 24144, 24279, 24414, 24548, 24680,
+  24812, 24943, 25073, 25202, 25330, 25457, 25583, 25708, 25833, 25956,
+  26078, 26199, 26320, 26439, 26557, 26674, 26791, 26906, 27020, 27133,
+  27246, 27357, 27467, 27576, 27684, 27791, 27897, 28002, 28106, 28209,
+  28311, 28411, 28511, 28610, 28707, 28803, 28899, 28993, 29086, 29178,
+  29269, 29359, 29448, 29535, 29622, 29707, 29792, 29875, 29957, 30038,
+  30118, 30196, 30274, 30350, 30425, 30499, 30572, 30644, 30715, 30784,
+  30853, 30920, 30986, 31050, 31114, 31177, 31238, 31298, 31357, 31415,
+  31471, 31527, 31581, 31634, 31686, 31737, 31786, 31834, 31881, 31927,
+  31972, 32015, 32058, 32099, 32138, 32177, 32214, 32251, 32286, 32319,
+  32352, 32383, 32413, 32442, 32470, 32496, 32522, 32546, 32568, 32590,
+  32610, 32629, 32647, 32664, 32679, 32693, 32706, 32718, 32729, 32738,
+  32746, 32753, 32758, 32762, 32766, 32767, 32767
+};
+
+/* 9-bit reversal of i, for the RFFT_MAX_SIZE / 2-point complex FFT */
+static const uint16_t bitrev_tab[RFFT_MAX_SIZE / 2] = {
+  0, 256, 128, 384, 64, 320, 192, 448, 32, 288, 160, 416,
+  96, 352, 224, 480, 16, 272, 144, 400, 80, 336, 208, 464,
+  48, 304, 176, 432, 112, 368, 240, 496, 8, 264, 136, 392,
+  72, 328, 200, 456, 40, 296, 168, 424, 104, 360, 232, 488,
+  24, 280, 152, 408, 88, 344, 216, 472, 56, 312, 184, 440,
+  120, 376, 248, 504, 4, 260, 132, 388, 68, 324, 196, 452,
+  36, 292, 164, 420, 100, 356, 228, 484, 20, 276, 148, 404,
+  84, 340, 212, 468, 52, 308, 180, 436, 116, 372, 244, 500,
+  12, 268, 140, 396, 76, 332, 204, 460, 44, 300, 172, 428,
+  108, 364, 236, 492, 28, 284, 156, 412, 92, 348, 220, 476,
+  60, 316, 188, 444, 124, 380, 252, 508, 2, 258, 130, 386,
+  66, 322, 194, 450, 34, 290, 162, 418, 98, 354, 226, 482,
+  18, 274, 146, 402, 82, 338, 210, 466, 50, 306, 178, 434,
+  114, 370, 242, 498, 10, 266, 138, 394, 74, 330, 202, 458,
+  42, 298, 170, 426, 106, 362, 234, 490, 26, 282, 154, 410,
+  90, 346, 218, 474, 58, 314, 186, 442, 122, 378, 250, 506,
+  6, 262, 134, 390, 70, 326, 198, 454, 38, 294, 166, 422,
+  102, 358, 230, 486, 22, 278, 150, 406, 86, 342, 214, 470,
+  54, 310, 182, 438, 118, 374, 246, 502, 14, 270, 142, 398,
+  78, 334, 206, 462, 46, 302, 174, 430, 110, 366, 238, 494,
+  30, 286, 158, 414, 94, 350, 222, 478, 62, 318, 190, 446,
+  126, 382, 254, 510, 1, 257, 129, 385, 65, 321, 193, 449,
+  33, 289, 161, 417, 97, 353, 225, 481, 17, 273, 145, 401,
+  81, 337, 209, 465, 49, 305, 177, 433, 113, 369, 241, 497,
+  9, 265, 137, 393, 73, 329, 201, 457, 41, 297, 169, 425,
+  105, 361, 233, 489, 25, 281, 153, 409, 89, 345, 217, 473,
+  57, 313, 185, 441, 121, 377, 249, 505, 5, 261, 133, 389,
+  69, 325, 197, 453, 37, 293, 165, 421, 101, 357, 229, 485,
+  21, 277, 149, 405, 85, 341, 213, 469, 53, 309, 181, 437,
+  117, 373, 245, 501, 13, 269, 141, 397, 77, 333, 205, 461,
+  45, 301, 173, 429, 109, 365, 237, 493, 29, 285, 157, 413,
+  93, 349, 221, 477, 61, 317, 189, 445, 125, 381, 253, 509,
+  3, 259, 131, 387, 67, 323, 195, 451, 35, 291, 163, 419,
+  99, 355, 227, 483, 19, 275, 147, 403, 83, 339, 211, 467,
+  51, 307, 179, 435, 115, 371, 243, 499, 11, 267, 139, 395,
+  75, 331, 203, 459, 43, 299, 171, 427, 107, 363, 235, 491,
+  27, 283, 155, 411, 91, 347, 219, 475, 59, 315, 187, 443,
+  123, 379, 251, 507, 7, 263, 135, 391, 71, 327, 199, 455,
+  39, 295, 167, 423, 103, 359, 231, 487, 23, 279, 151, 407,
+  87, 343, 215, 471, 55, 311, 183, 439, 119, 375, 247, 503,
+  15, 271, 143, 399, 79, 335, 207, 463, 47, 303, 175, 431,
+  111, 367, 239, 495, 31, 287, 159, 415, 95, 351, 223, 479,
+  63, 319, 191, 447, 127, 383, 255, 511
+};
+
+typedef struct {
+  int32_t re;
+  int32_t im;
+} complex_t;
+/*---------------------------------------------------------------------------*/
+/* cos and sin of 2 * pi * t / RFFT_MAX_SIZE */
+static inline complex_t
+twiddle(uint16_t t)
+{
+  complex_t w;
+  uint16_t r;
+
+  t &= RFFT_MAX_SIZE - 1;
+  r = t % QUARTER;
+  switch(t / QUARTER) {
+  case 0:
+    w.re = sin_tab[QUARTER - r];
+    w.im = sin_tab[r];
+    break;
+  case 1:
+    w.re = -sin_tab[r];
+    w.im = sin_tab[QUARTER - r];
+    break;
+  case 2:
+    w.re = -sin_tab[QUARTER - r];
+    w.im = -sin_tab[r];
+    break;
+  default:
+    w.re = sin_tab[r];
+    w.im = -sin_tab[QUARTER - r];
+    break;
+  }
+  return w;
+}
+/*---------------------------------------------------------------------------*/
+/* x * conj(w) in Q15, i.e. x rotated by -2 * pi * t / RFFT_MAX_SIZE */
+static inline complex_t
+rotate(complex_t x, complex_t w)
+{
+  complex_t r;
+
+  r.re = (x.re * w.re + x.im * w.im + (1 << 14)) >> 15;
+  r.im = (x.im * w.re - x.re * w.im + (1 << 14)) >> 15;
+  return r;
+}
+/*---------------------------------------------------------------------------*/
+/* Stores (v / 2^shift), rounded and saturated */
+static inline int16_t
+scale(int32_t v, uint8_t shift)
+{
+  v = (v + (1 << (shift - 1))) >> shift;
+  if(v > INT16_MAX) {
+    return INT16_MAX;
+  }
+  if(v < INT16_MIN) {
+    return INT16_MIN;
+  }
+  return v;
+}
+/*---------------------------------------------------------------------------*/
+static inline complex_t
+load(const int16_t *z, uint16_t i)
+{
+  complex_t x;
+
+  x.re = z[2 * i];
+  x.im = z[2 * i + 1];
+  return x;
+}
+/*---------------------------------------------------------------------------*/
+static inline void
+store(int16_t *z, uint16_t i, int32_t re, int32_t im, uint8_t shift)
+{
+  z[2 * i] = scale(re, shift);
+  z[2 * i + 1] = scale(im, shift);
+}
+/*---------------------------------------------------------------------------*/
+/* In-place complex FFT of m points, scaled by 1 / m */
+static void
+complex_fft(int16_t *z, uint16_t m, uint8_t log2m)
+{
+  complex_t a, b, c, d, w;
+  int16_t tmp;
+  uint16_t stride;
+  uint16_t h;
+  uint16_t i, j, g;
+
+  /* bit-reversed input order, for decimation in time */
+  for(i = 0; i < m; i++) {
+    j = bitrev_tab[i] >> (MAX_LOG2 - 1 - log2m);
+    if(j > i) {
+      tmp = z[2 * i];
+      z[2 * i] = z[2 * j];
+      z[2 * j] = tmp;
+      tmp = z[2 * i + 1];
+      z[2 * i + 1] = z[2 * j + 1];
+      z[2 * j + 1] = tmp;
+    }
+  }
+
+  h = 1;
+  if(log2m & 1) {
+    /* one radix-2 stage with unit twiddles to leave an even number */
+    for(g = 0; g < m; g += 2) {
+      a = load(z, g);
+      b = load(z, g + 1);
+      store(z, g, a.re + b.re, a.im + b.im, 1);
+      store(z, g + 1, a.re - b.re, a.im - b.im, 1);
+    }
+    h = 2;
+  }
+
+  /*
+   * Radix-4 stages: each combines four transforms of size h into one of
+   * size 4h, i.e. two radix-2 stages with three complex multiplications
+   * per four points instead of four.
+   */
+  for(; h < m; h *= 4) {
+    stride = RFFT_MAX_SIZE / (4 * h);
+    for(j = 0; j < h; j++) {
+      complex_t w1 = twiddle(j * stride);
+      complex_t w2 = twiddle(2 * j * stride);
+      complex_t w3 = twiddle(3 * j * stride);
+
+      for(g = j; g < m; g += 4 * h) {
+        a = load(z, g);
+        b = rotate(load(z, g + h), w2);
+        c = rotate(load(z, g + 2 * h), w1);
+        d = rotate(load(z, g + 3 * h), w3);
+
+        /* a +- b and c +- d; the latter times -i for the odd outputs */
+        w.re = a.re + b.re;
+        w.im = a.im + b.im;
+        a.re -= b.re;
+        a.im -= b.im;
+        b.re = c.re + d.re;
+        b.im = c.im + d.im;
+        c.re -= d.re;
+        c.im -= d.im;
+
+        store(z, g, w.re + b.re, w.im + b.im, 2);
+        store(z, g + h, a.re + c.im, a.im - c.re, 2);
+        store(z, g + 2 * h, w.re - b.re, w.im - b.im, 2);
+        store(z, g + 3 * h, a.re - c.im, a.im + c.re, 2);
+      }
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+int
+rfft(int16_t *data, uint16_t n)
+{
+  complex_t a, b, s, t, w;
+  uint16_t m;
+  uint16_t k;
+  uint8_t log2m;
+  int32_t re0;
+
+  if(n < RFFT_MIN_SIZE || n > RFFT_MAX_SIZE || (n & (n - 1))) {
+    return -1;
+  }
+
+  m = n / 2;
+  for(log2m = 0; (1u << log2m) < m; log2m++);
+
+  /* the even and odd samples are the real and imaginary parts */
+  complex_fft(data, m, log2m);
+
+  /* bins 0 and n / 2 are real */
+  re0 = data[0];
+  data[0] = scale(re0 + data[1], 1);
+  data[1] = scale(re0 - data[1], 1);
+
+  /*
+   * Split step for bins k and m - k. With A = Z[k], B = conj(Z[m - k]),
+   * S = A + B and T = W^k (A - B):
+   *   X[k] = (S - iT) / 4 and X[m - k] = conj(S + iT) / 4.
+   */
+  for(k = 1; k <= m / 2; k++) {
+    a = load(data, k);
+    b = load(data, m - k);
+    b.im = -b.im;
+    s.re = a.re + b.re;
+    s.im = a.im + b.im;
+    /* rotate A and B separately, as A - B might overflow the products */
+    w = twiddle(k * (RFFT_MAX_SIZE / n));
+    a = rotate(a, w);
+    b = rotate(b, w);
+    t.re = a.re - b.re;
+    t.im = a.im - b.im;
+
+    store(data, k, s.re + t.im, s.im - t.re, 2);
+    if(k != m - k) {
+      store(data, m - k, s.re - t.im, -(s.im + t.re), 2);
+    }
+  }
+
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+void
+rfft_window(int16_t *data, uint16_t n, rfft_window_t window)
+{
+  int32_t c;
+  int32_t w;
+  uint16_t i;
+
+  for(i = 0; i < n; i++) {
+    c = twiddle(i * (RFFT_MAX_SIZE / n)).re;
+    if(window == RFFT_WINDOW_HAMMING) {
+      /* 0.54 - 0.46 cos() */
+      w = 17695 - ((15073 * c + (1 << 14)) >> 15);
+    } else {
+      /* 0.5 - 0.5 cos() */
+      w = (32768 - c) >> 1;
+    }
+    data[i] = (data[i] * w + (1 << 14)) >> 15;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static uint16_t
+isqrt(uint32_t v)
+{
+  uint32_t root;
+  uint32_t bit;
+
+  root = 0;
+  for(bit = 1UL << 30; bit > v; bit >>= 2);
+  for(; bit; bit >>= 2) {
+    if(v >= root + bit) {
+      v -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+  }
+  return root;
+}
+/*---------------------------------------------------------------------------*/
+void
+rfft_magnitude(const int16_t *spectrum, uint16_t *magnitude, uint16_t n)
+{
+  int32_t re;
+  int32_t im;
+  uint16_t nyquist;
+  uint16_t k;
+
+  nyquist = ABS(spectrum[1]);
+  magnitude[0] = ABS(spectrum[0]);
+  for(k = 1; k < n / 2; k++) {
+    re = spectrum[2 * k];
+    im = spectrum[2 * k + 1];
+    magnitude[k] = isqrt(re * re + im * im);
+  }
+  magnitude[n / 2] = nyquist;
+}
+/*---------------------------------------------------------------------------*/
+/** @} */
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+/** \addtogroup lib
+ * @{
+ *
+ * \defgroup rfft Fixed-point real FFT
+ *
+ * Forward FFT of real int16_t samples, computed in place in Q15
+ * arithmetic. N real samples are transformed as an N/2-point complex
+ * FFT with radix-4 butterflies, followed by a split step that separates
+ * the spectra of the even and odd samples. Twiddle factors and the
+ * bit-reversal permutation come from tables in ROM (1.5 kB), so no
+ * trigonometry is done at run time.
+ *
+ * Each stage scales its output down so that nothing overflows: the
+ * result is the DFT divided by N. A full-scale sine at bin k therefore
+ * shows up with magnitude 16384 at bin k. Unlike ifft(), the full 16-bit
+ * sample range may be used.
+ *
+ * The spectrum is packed into the input buffer:
+ * - data[0] is the (real) DC bin, data[1] the (real) bin N/2;
+ * - data[2k] and data[2k + 1] are the real and imaginary parts of bin k,
+ *   for 0 < k < N/2.
+ * @{
+ */
+/*---------------------------------------------------------------------------*/
+#ifndef RFFT_H_
+#define RFFT_H_
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+
+#include <stdint.h>
+/*---------------------------------------------------------------------------*/
+/** The largest supported transform size, set by the size of the tables */
+#define RFFT_MAX_SIZE 1024
+/** The smallest supported transform size */
+#define RFFT_MIN_SIZE 4
+
+/** Window functions for rfft_window() */
+typedef enum {
+  RFFT_WINDOW_HANN,
+  RFFT_WINDOW_HAMMING,
+} rfft_window_t;
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief        Multiply samples by a window function
+ * \param data   The n samples, modified in place
+ * \param n      The transform size
+ * \param window The window function
+ *
+ * Windowing reduces the leakage of a tone into neighbouring bins when
+ * the tone is not periodic in the block. It also reduces the magnitude
+ * of the tone's bin: a Hann window halves it.
+ */
+void rfft_window(int16_t *data, uint16_t n, rfft_window_t window);
+
+/**
+ * \brief      Compute the FFT of real samples in place
+ * \param data The n samples on entry, the packed spectrum on return
+ * \param n    The transform size, a power of two between RFFT_MIN_SIZE
+ *             and RFFT_MAX_SIZE
+ * \retval 0   The transform was computed
+ * \retval -1  The size is not supported; data is left unchanged
+ */
+int rfft(int16_t *data, uint16_t n);
+
+/**
+ * \brief           Compute the magnitude of each bin of a spectrum
+ * \param spectrum  The packed spectrum returned by rfft()
+ * \param magnitude The n / 2 + 1 magnitudes, for bins 0 to n / 2.
+ *                  May point to the spectrum itself.
+ * \param n         The transform size
+ */
+void rfft_magnitude(const int16_t *spectrum, uint16_t *magnitude, uint16_t n);
+/*---------------------------------------------------------------------------*/
+#endif /* RFFT_H_ */
+/*---------------------------------------------------------------------------*/
+/**
+ * @}
+ * @}
+ */
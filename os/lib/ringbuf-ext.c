@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+/**
+ * \addtogroup ringbuf-ext
+ * @{
+ *
+ * \file
+ *   Implementation of the extended ring buffer
+ */
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+#include "lib/ringbuf-ext.h"
+#include "sys/cc.h"
+#include "sys/memory-barrier.h"
+
+#include <string.h>
+/*---------------------------------------------------------------------------*/
+/* The index written by the other side is read exactly once per call,
+   and our own index is only published after the data access. */
+#define READ_INDEX(index) CC_ACCESS_NOW(ringbuf_ext_index_t, index)
+#define PUBLISH_INDEX(index, value) do {                        \
+    memory_barrier();                                           \
+    CC_ACCESS_NOW(ringbuf_ext_index_t, index) = (value);        \
+  } while(0)
+/*---------------------------------------------------------------------------*/
+int
+ringbuf_ext_init(struct ringbuf_ext *r, uint8_t *data, size_t size)
+{
+  /* The free-running indices must be able to tell a full buffer from
+     an empty one, so the size can be at most half their range. */
+  if(size == 0 || (size & (size - 1)) != 0 ||
+     size > (size_t)(ringbuf_ext_index_t)~0 / 2 + 1) {
+    return 0;
+  }
+  r->data = data;
+  r->mask = (ringbuf_ext_index_t)(size - 1);
+  r->put_ptr = 0;
+  r->get_ptr = 0;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+uint8_t *
+ringbuf_ext_peek_put(struct ringbuf_ext *r, ringbuf_ext_index_t *len)
+{
+  ringbuf_ext_index_t offset, space;
+
+  space = r->mask + 1 - (ringbuf_ext_index_t)(r->put_ptr -
+                                               READ_INDEX(r->get_ptr));
+  offset = r->put_ptr & r->mask;
+  *len = MIN(space, (ringbuf_ext_index_t)(r->mask + 1 - offset));
+  return &r->data[offset];
+}
+/*---------------------------------------------------------------------------*/
+void
+ringbuf_ext_commit_put(struct ringbuf_ext *r, ringbuf_ext_index_t len)
+{
+  PUBLISH_INDEX(r->put_ptr, r->put_ptr + len);
+}
+/*---------------------------------------------------------------------------*/
+const uint8_t *
+ringbuf_ext_peek_get(struct ringbuf_ext *r, ringbuf_ext_index_t *len)
+{
+  ringbuf_ext_index_t offset, elements;
+
+  elements = READ_INDEX(r->put_ptr) - r->get_ptr;
+  /* Do not read data older than the put index that was just read. */
+  memory_barrier();
+  offset = r->get_ptr & r->mask;
+  *len = MIN(elements, (ringbuf_ext_index_t)(r->mask + 1 - offset));
+  return &r->data[offset];
+}
+/*---------------------------------------------------------------------------*/
+void
+ringbuf_ext_commit_get(struct ringbuf_ext *r, ringbuf_ext_index_t len)
+{
+  PUBLISH_INDEX(r->get_ptr, r->get_ptr + len);
+}
+/*---------------------------------------------------------------------------*/
+int
+ringbuf_ext_put(struct ringbuf_ext *r, uint8_t c)
+{
+  if((ringbuf_ext_index_t)(r->put_ptr - READ_INDEX(r->get_ptr)) > r->mask) {
+    return 0;
+  }
+  r->data[r->put_ptr & r->mask] = c;
+  PUBLISH_INDEX(r->put_ptr, r->put_ptr + 1);
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+int
+ringbuf_ext_get(struct ringbuf_ext *r)
+{
+  uint8_t c;
+
+  if(READ_INDEX(r->put_ptr) == r->get_ptr) {
+    return -1;
+  }
+  memory_barrier();
+  c = r->data[r->get_ptr & r->mask];
+  PUBLISH_INDEX(r->get_ptr, r->get_ptr + 1);
+  return c;
+}
+/*---------------------------------------------------------------------------*/
+ringbuf_ext_index_t
+ringbuf_ext_put_bulk(struct ringbuf_ext *r, const void *src,
+                     ringbuf_ext_index_t len)
+{
+  ringbuf_ext_index_t first, copied;
+  uint8_t *region;
+  int i;
+
+  /* At most two regions: up to the end of the array, and from its start */
+  copied = 0;
+  for(i = 0; i < 2 && copied < len; i++) {
+    region = ringbuf_ext_peek_put(r, &first);
+    if(first == 0) {
+      break;
+    }
+    first = MIN(first, (ringbuf_ext_index_t)(len - copied));
+    memcpy(region, (const uint8_t *)src + copied, first);
+    ringbuf_ext_commit_put(r, first);
+    copied += first;
+  }
+  return copied;
+}
+/*---------------------------------------------------------------------------*/
+ringbuf_ext_index_t
+ringbuf_ext_get_bulk(struct ringbuf_ext *r, void *dst,
+                     ringbuf_ext_index_t len)
+{
+  ringbuf_ext_index_t first, copied;
+  const uint8_t *region;
+  int i;
+
+  copied = 0;
+  for(i = 0; i < 2 && copied < len; i++) {
+    region = ringbuf_ext_peek_get(r, &first);
+    if(first == 0) {
+      break;
+    }
+    first = MIN(first, (ringbuf_ext_index_t)(len - copied));
+    memcpy((uint8_t *)dst + copied, region, first);
+    ringbuf_ext_commit_get(r, first);
+    copied += first;
+  }
+  return copied;
+}
+/*---------------------------------------------------------------------------*/
+ringbuf_ext_index_t
+ringbuf_ext_size(const struct ringbuf_ext *r)
+{
+  return r->mask + 1;
+}
+/*---------------------------------------------------------------------------*/
+ringbuf_ext_index_t
+ringbuf_ext_elements(const struct ringbuf_ext *r)
+{
+  return r->put_ptr - r->get_ptr;
+}
+/*---------------------------------------------------------------------------*/
+ringbuf_ext_index_t
+ringbuf_ext_space(const struct ringbuf_ext *r)
+{
+  return r->mask + 1 - ringbuf_ext_elements(r);
+}
+/*---------------------------------------------------------------------------*/
+/** @} */
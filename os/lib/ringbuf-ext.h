@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+/** \addtogroup data
+ * @{
+ *
+ * \defgroup ringbuf-ext Extended ring buffer library
+ *
+ * The extended ring buffer is a byte ring buffer for data streams
+ * between a driver and a process, such as UART input at high baud
+ * rates. Compared to the \ref ringbuf "ring buffer library", it
+ * supports sizes beyond 128 bytes, it copies blocks of bytes with at
+ * most two memcpy() calls, and it lets a driver write into or read from
+ * the buffer memory directly, for example with DMA.
+ *
+ * The buffer is lock-free for a single producer and a single consumer:
+ * - The producer calls only ringbuf_ext_put(), ringbuf_ext_put_bulk(),
+ *   ringbuf_ext_peek_put() and ringbuf_ext_commit_put(), and is the
+ *   only writer of the put index.
+ * - The consumer calls only ringbuf_ext_get(), ringbuf_ext_get_bulk(),
+ *   ringbuf_ext_peek_get() and ringbuf_ext_commit_get(), and is the
+ *   only writer of the get index.
+ * - The producer and the consumer may run in different contexts, for
+ *   example an interrupt handler and a process, without locking.
+ *   Several producers or several consumers must be serialised by the
+ *   caller, for example with a critical section.
+ * - The data is written before the put index is advanced, and read
+ *   before the get index is advanced, with memory_barrier() in
+ *   between. Platforms on which the CPU may reorder memory accesses
+ *   must provide memory_barrier() in memory-barrier.h.
+ * - Reads and writes of ringbuf_ext_index_t must be atomic on the
+ *   platform. The index is 16 bits wide by default, and 32 bits wide
+ *   when RINGBUF_EXT_CONF_INDEX_TYPE is uint32_t.
+ *
+ * The indices run freely and are only masked when they are used as
+ * offsets, so the whole buffer can be filled. The size must be a power
+ * of two of at most half the range of the index type.
+ * @{
+ */
+/*---------------------------------------------------------------------------*/
+#ifndef RINGBUF_EXT_H_
+#define RINGBUF_EXT_H_
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+
+#include <stddef.h>
+#include <stdint.h>
+/*---------------------------------------------------------------------------*/
+#ifdef RINGBUF_EXT_CONF_INDEX_TYPE
+#define RINGBUF_EXT_INDEX_TYPE RINGBUF_EXT_CONF_INDEX_TYPE
+#else
+#define RINGBUF_EXT_INDEX_TYPE uint16_t
+#endif /* RINGBUF_EXT_CONF_INDEX_TYPE */
+
+/**
+ * \brief The type of the sizes and indices of an extended ring buffer
+ */
+typedef RINGBUF_EXT_INDEX_TYPE ringbuf_ext_index_t;
+
+/**
+ * \brief The state of an extended ring buffer
+ *
+ * The data is stored in an array that is defined separately. The
+ * fields must not be accessed directly.
+ */
+struct ringbuf_ext {
+  uint8_t *data;
+  ringbuf_ext_index_t mask;
+  ringbuf_ext_index_t put_ptr;
+  ringbuf_ext_index_t get_ptr;
+};
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief Initialise an extended ring buffer
+ * \param r The ring buffer
+ * \param data The array that holds the data
+ * \param size The size of the array, which must be a power of two of
+ *             at most half the range of ringbuf_ext_index_t
+ * \return Non-zero if the ring buffer was initialised, or zero if the
+ *         size was invalid, in which case the ring buffer must not be used
+ */
+int ringbuf_ext_init(struct ringbuf_ext *r, uint8_t *data, size_t size);
+
+/**
+ * \brief Insert a byte into the ring buffer
+ * \param r The ring buffer
+ * \param c The byte
+ * \return Non-zero if the byte was inserted, or zero if the buffer was full
+ */
+int ringbuf_ext_put(struct ringbuf_ext *r, uint8_t c);
+
+/**
+ * \brief Remove a byte from the ring buffer
+ * \param r The ring buffer
+ * \return The byte, or -1 if the buffer was empty
+ */
+int ringbuf_ext_get(struct ringbuf_ext *r);
+
+/**
+ * \brief Insert a block of bytes into the ring buffer
+ * \param r The ring buffer
+ * \param src The bytes to insert
+ * \param len The number of bytes to insert
+ * \return The number of bytes inserted, which is less than len if the
+ *         buffer became full
+ */
+ringbuf_ext_index_t ringbuf_ext_put_bulk(struct ringbuf_ext *r,
+                                         const void *src,
+                                         ringbuf_ext_index_t len);
+
+/**
+ * \brief Remove a block of bytes from the ring buffer
+ * \param r The ring buffer
+ * \param dst Where to store the bytes
+ * \param len The maximum number of bytes to remove
+ * \return The number of bytes removed, which is less than len if the
+ *         buffer became empty
+ */
+ringbuf_ext_index_t ringbuf_ext_get_bulk(struct ringbuf_ext *r, void *dst,
+                                         ringbuf_ext_index_t len);
+
+/**
+ * \brief Get the contiguous free region at the put index
+ * \param r The ring buffer
+ * \param len Set to the length of the region
+ * \return A pointer to the region. Its length is zero if the buffer is full.
+ *
+ * The producer writes up to len bytes to the region, and then makes
+ * them available with ringbuf_ext_commit_put(). As the region ends at
+ * the end of the array, a second call after the commit may return
+ * another region at the start of the array.
+ */
+uint8_t *ringbuf_ext_peek_put(struct ringbuf_ext *r, ringbuf_ext_index_t *len);
+
+/**
+ * \brief Make bytes written to the region from ringbuf_ext_peek_put()
+ *        available to the consumer
+ * \param r The ring buffer
+ * \param len The number of bytes written, at most the length of the region
+ */
+void ringbuf_ext_commit_put(struct ringbuf_ext *r, ringbuf_ext_index_t len);
+
+/**
+ * \brief Get the contiguous region of data at the get index
+ * \param r The ring buffer
+ * \param len Set to the length of the region
+ * \return A pointer to the region. Its length is zero if the buffer is empty.
+ *
+ * The consumer reads up to len bytes from the region, and then releases
+ * them with ringbuf_ext_commit_get().
+ */
+const uint8_t *ringbuf_ext_peek_get(struct ringbuf_ext *r,
+                                    ringbuf_ext_index_t *len);
+
+/**
+ * \brief Release bytes read from the region from ringbuf_ext_peek_get()
+ * \param r The ring buffer
+ * \param len The number of bytes read, at most the length of the region
+ */
+void ringbuf_ext_commit_get(struct ringbuf_ext *r, ringbuf_ext_index_t len);
+
+/**
+ * \brief Get the size of the ring buffer
+ * \param r The ring buffer
+ * \return The size in bytes
+ */
+ringbuf_ext_index_t ringbuf_ext_size(const struct ringbuf_ext *r);
+
+/**
+ * \brief Get the number of bytes in the ring buffer
+ * \param r The ring buffer
+ * \return The number of bytes that can be removed
+ */
+ringbuf_ext_index_t ringbuf_ext_elements(const struct ringbuf_ext *r);
+
+/**
+ * \brief Get the free space in the ring buffer
+ * \param r The ring buffer
+ * \return The number of bytes that can be inserted
+ */
+ringbuf_ext_index_t ringbuf_ext_space(const struct ringbuf_ext *r);
+/*---------------------------------------------------------------------------*/
+#endif /* RINGBUF_EXT_H_ */
+/*---------------------------------------------------------------------------*/
+/**
+ * @}
+ * @}
+ */
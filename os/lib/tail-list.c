@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+/**
+ * \addtogroup tail-list
+ * @{
+ *
+ * \file
+ *   Implementation of singly-linked lists with a tail pointer
+ */
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+#include "lib/tail-list.h"
+
+#include <stdbool.h>
+/*---------------------------------------------------------------------------*/
+struct tl {
+  struct tl *next;
+};
+/*---------------------------------------------------------------------------*/
+void
+tail_list_init(tail_list_t tl)
+{
+  tl->head = NULL;
+  tl->tail = NULL;
+  tl->length = 0;
+}
+/*---------------------------------------------------------------------------*/
+void *
+tail_list_head(tail_list_t tl)
+{
+  return tl->head;
+}
+/*---------------------------------------------------------------------------*/
+void *
+tail_list_tail(tail_list_t tl)
+{
+  return tl->tail;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Only the tail of a list has no next element, so an element with no
+ * next element that is not the tail is not in the list.
+ */
+static bool
+is_queued(tail_list_t tl, void *element)
+{
+  if(((struct tl *)element)->next == NULL && element != tl->tail) {
+    return false;
+  }
+  return tail_list_contains(tl, element);
+}
+/*---------------------------------------------------------------------------*/
+void
+tail_list_add(tail_list_t tl, void *element)
+{
+  if(is_queued(tl, element)) {
+    return;
+  }
+
+  ((struct tl *)element)->next = NULL;
+
+  if(tl->tail == NULL) {
+    tl->head = element;
+  } else {
+    ((struct tl *)tl->tail)->next = element;
+  }
+  tl->tail = element;
+  tl->length++;
+}
+/*---------------------------------------------------------------------------*/
+void
+tail_list_push(tail_list_t tl, void *element)
+{
+  if(is_queued(tl, element)) {
+    return;
+  }
+
+  ((struct tl *)element)->next = tl->head;
+  tl->head = element;
+
+  if(tl->tail == NULL) {
+    tl->tail = element;
+  }
+  tl->length++;
+}
+/*---------------------------------------------------------------------------*/
+void *
+tail_list_pop(tail_list_t tl)
+{
+  struct tl *head;
+
+  head = tl->head;
+  if(head != NULL) {
+    tl->head = head->next;
+    if(tl->head == NULL) {
+      tl->tail = NULL;
+    }
+    head->next = NULL;
+    tl->length--;
+  }
+
+  return head;
+}
+/*---------------------------------------------------------------------------*/
+void
+tail_list_remove(tail_list_t tl, void *element)
+{
+  struct tl *this, *previous;
+
+  previous = NULL;
+  for(this = tl->head; this != NULL; this = this->next) {
+    if(this == element) {
+      if(previous == NULL) {
+        tl->head = this->next;
+      } else {
+        previous->next = this->next;
+      }
+      if(tl->tail == this) {
+        tl->tail = previous;
+      }
+      this->next = NULL;
+      tl->length--;
+      return;
+    }
+    previous = this;
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+tail_list_insert(tail_list_t tl, void *previous, void *element)
+{
+  if(previous == NULL) {
+    tail_list_push(tl, element);
+    return;
+  }
+
+  ((struct tl *)element)->next = ((struct tl *)previous)->next;
+  ((struct tl *)previous)->next = element;
+
+  if(tl->tail == previous) {
+    tl->tail = element;
+  }
+  tl->length++;
+}
+/*---------------------------------------------------------------------------*/
+bool
+tail_list_contains(tail_list_t tl, void *element)
+{
+  struct tl *this;
+
+  for(this = tl->head; this != NULL; this = this->next) {
+    if(this == element) {
+      return true;
+    }
+  }
+
+  return false;
+}
+/*---------------------------------------------------------------------------*/
+/** @} */
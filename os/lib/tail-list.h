@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+/** \addtogroup data
+ * @{
+ *
+ * \defgroup tail-list Singly-linked list with a tail pointer
+ *
+ * This library provides a singly-linked list that keeps a pointer to
+ * its last element as well as to its first, so that elements can be
+ * appended in constant time. It is intended for FIFO queues, where the
+ * list library would walk the entire list on every list_add().
+ *
+ * A tail list is declared using the TAIL_LIST macro, or with
+ * TAIL_LIST_STRUCT inside a struct. Elements must be allocated by the
+ * calling code and must be of a C struct datatype. In this struct, the
+ * first field must be a pointer called \e next, just like for the list
+ * library, so the same element types can be used with both. The list
+ * is traversed with tail_list_head() and tail_list_item_next().
+ *
+ * The list also keeps its length, so tail_list_length() takes constant
+ * time.
+ *
+ * Adding an element that is already in the list with tail_list_add()
+ * or tail_list_push() leaves the list unchanged: unlike with list_add()
+ * and list_push(), the element is not moved. The list is only searched
+ * for the element if its next pointer is set or if it is the tail, so
+ * adding an element that was removed from a list, or that is zeroed,
+ * takes constant time.
+ * @{
+ */
+/*---------------------------------------------------------------------------*/
+#ifndef TAIL_LIST_H_
+#define TAIL_LIST_H_
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+#include "lib/list.h"
+
+#include <stdbool.h>
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief The storage of a tail list
+ */
+struct tail_list {
+  void *head;
+  void *tail;
+  int length;
+};
+
+/**
+ * \brief The tail list datatype
+ */
+typedef struct tail_list *tail_list_t;
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief Define a tail list.
+ * \param name The name of the tail list.
+ */
+#define TAIL_LIST(name) \
+  static struct tail_list LIST_CONCAT(name, _tail_list) = { NULL, NULL, 0 }; \
+  static tail_list_t name = &LIST_CONCAT(name, _tail_list)
+
+/**
+ * \brief Define a tail list inside a struct.
+ * \param name The name of the tail list.
+ *
+ * The list must be initialised with TAIL_LIST_STRUCT_INIT() before use.
+ */
+#define TAIL_LIST_STRUCT(name) \
+  struct tail_list LIST_CONCAT(name, _tail_list); \
+  tail_list_t name
+
+/**
+ * \brief Initialise a tail list that is defined inside a struct.
+ * \param struct_ptr A pointer to the struct
+ * \param name The name of the tail list.
+ */
+#define TAIL_LIST_STRUCT_INIT(struct_ptr, name)                         \
+  do {                                                                  \
+    (struct_ptr)->name = &((struct_ptr)->LIST_CONCAT(name, _tail_list)); \
+    tail_list_init((struct_ptr)->name);                                 \
+  } while(0)
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief Initialise a tail list.
+ * \param tl The tail list.
+ */
+void tail_list_init(tail_list_t tl);
+
+/**
+ * \brief Return the first element of a tail list.
+ * \param tl The tail list.
+ * \return A pointer to the list's head, or NULL if the list is empty
+ */
+void *tail_list_head(tail_list_t tl);
+
+/**
+ * \brief Return the last element of a tail list.
+ * \param tl The tail list.
+ * \return A pointer to the list's tail, or NULL if the list is empty
+ */
+void *tail_list_tail(tail_list_t tl);
+
+/**
+ * \brief Add an element to the end of a tail list, in constant time.
+ * \param tl The tail list.
+ * \param element A pointer to the element to be added.
+ *
+ * Nothing happens if the element is already in the list.
+ */
+void tail_list_add(tail_list_t tl, void *element);
+
+/**
+ * \brief Add an element to the start of a tail list.
+ * \param tl The tail list.
+ * \param element A pointer to the element to be added.
+ *
+ * Nothing happens if the element is already in the list.
+ */
+void tail_list_push(tail_list_t tl, void *element);
+
+/**
+ * \brief Remove the first element of a tail list.
+ * \param tl The tail list.
+ * \return A pointer to the removed element, or NULL if the list is empty
+ */
+void *tail_list_pop(tail_list_t tl);
+
+/**
+ * \brief Remove an element from a tail list.
+ * \param tl The tail list.
+ * \param element A pointer to the element to be removed.
+ *
+ * This function walks the list up to the element. Nothing happens if the
+ * element is not in the list.
+ */
+void tail_list_remove(tail_list_t tl, void *element);
+
+/**
+ * \brief Insert an element after a specified element.
+ * \param tl The tail list.
+ * \param previous The element after which the new element is inserted,
+ *        or NULL to insert it at the start of the list.
+ * \param element A pointer to the element to be inserted.
+ */
+void tail_list_insert(tail_list_t tl, void *previous, void *element);
+
+/**
+ * \brief Get the number of elements in a tail list, in constant time.
+ * \param tl The tail list.
+ * \return The number of elements in the list
+ */
+static inline int
+tail_list_length(tail_list_t tl)
+{
+  return tl->length;
+}
+
+/**
+ * \brief Check whether a tail list contains an element.
+ * \param tl The tail list.
+ * \param element The element to look for.
+ * \retval true The element is in the list
+ * \retval false The element is not in the list
+ */
+bool tail_list_contains(tail_list_t tl, void *element);
+
+/**
+ * \brief Get the element following an element of a tail list.
+ * \param element A list element
+ * \return The next element, or NULL at the end of the list
+ */
+static inline void *
+tail_list_item_next(void *element)
+{
+  return list_item_next(element);
+}
+
+/**
+ * \brief Check whether a tail list is empty.
+ * \param tl The tail list.
+ * \retval true The list is empty
+ * \retval false The list has at least one element
+ */
+static inline bool
+tail_list_is_empty(tail_list_t tl)
+{
+  return tl->head == NULL;
+}
+/*---------------------------------------------------------------------------*/
+#endif /* TAIL_LIST_H_ */
+/*---------------------------------------------------------------------------*/
+/**
+ * @}
+ * @}
+ */
@@ -45,7 +45,7 @@
 #include "coap-observe.h"
 #include "coap-timer.h"
 #include "lib/memb.h"
-#include "lib/list.h"
+#include "lib/tail-list.h"
 #include <stdlib.h>
 
 /* Log configuration */
@@ -55,7 +55,7 @@
 
 /*---------------------------------------------------------------------------*/
 MEMB(transactions_memb, coap_transaction_t, COAP_MAX_OPEN_TRANSACTIONS);
-LIST(transactions_list);
+TAIL_LIST(transactions_list);
 
 /*---------------------------------------------------------------------------*/
 static void
@@ -87,7 +87,8 @@ coap_new_transaction(uint16_t mid, const coap_endpoint_t *endpoint)
     /* save client address */
     coap_endpoint_copy(&t->endpoint, endpoint);
 
-    list_add(transactions_list, t); /* list itself makes sure same element is not added twice */
+    /* t was just allocated, so it cannot be in the list already */
+    tail_list_add(transactions_list, t);
   }
 
   return t;
@@ -149,7 +150,7 @@ coap_clear_transaction(coap_transaction_t *t)
     LOG_DBG("Freeing transaction %u: %p\n", t->mid, t);
 
     coap_timer_stop(&t->retrans_timer);
-    list_remove(transactions_list, t);
+    tail_list_remove(transactions_list, t);
     memb_free(&transactions_memb, t);
   }
 }
@@ -159,7 +160,7 @@ coap_get_transaction_by_mid(uint16_t mid)
 {
   coap_transaction_t *t = NULL;
 
-  for(t = (coap_transaction_t *)list_head(transactions_list); t; t = t->next) {
+  for(t = (coap_transaction_t *)tail_list_head(transactions_list); t; t = t->next) {
     if(t->mid == mid) {
       LOG_DBG("Found transaction for MID %u: %p\n", t->mid, t);
       return t;
@@ -1041,7 +1041,7 @@ newdata(void)
   {
     if(try_next_server(namemapptr)) {
       namemapptr->state = STATE_ASKING;
-      process_post(&resolv_process, PROCESS_EVENT_TIMER, NULL);
+      process_post_coalesce(&resolv_process, PROCESS_EVENT_TIMER, NULL);
     }
   }
 
@@ -1295,7 +1295,7 @@ resolv_query(const char *name)
 #endif /* RESOLV_CONF_SUPPORTS_MDNS */
 
   /* Force check_entires() to run on our process. */
-  process_post(&resolv_process, PROCESS_EVENT_TIMER, 0);
+  process_post_coalesce(&resolv_process, PROCESS_EVENT_TIMER, 0);
 }
 /*---------------------------------------------------------------------------*/
 /**
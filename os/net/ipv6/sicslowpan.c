@@ -1502,6 +1502,8 @@ fragment_copy_payload_and_send(uint16_t uip_offset, linkaddr_t *dest) {
   /* Restore packetbuf from queuebuf */
   queuebuf_to_packetbuf(q);
   queuebuf_free(q);
+  /* The packetbuf may have moved to another descriptor */
+  packetbuf_ptr = packetbuf_dataptr();
 
   /* Check tx result. */
   if((last_tx_status == MAC_TX_COLLISION) ||
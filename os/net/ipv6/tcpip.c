@@ -90,7 +90,8 @@ static struct internal_state {
 enum {
   TCP_POLL,
   UDP_POLL,
-  PACKET_INPUT
+  PACKET_INPUT,
+  PACKET_OUTPUT
 };
 
 /*---------------------------------------------------------------------------*/
@@ -160,6 +161,58 @@ check_for_tcp_syn(void)
 #endif /* UIP_TCP */
 }
 /*---------------------------------------------------------------------------*/
+#if UIP_BUFFERS > 1
+/* The attributes of the packets handed off to tcpip_process */
+static uint16_t handoff_attrs[UIP_BUFFERS][UIPBUF_ATTR_MAX];
+#endif /* UIP_BUFFERS > 1 */
+/*---------------------------------------------------------------------------*/
+/* Send the packet that uip_input() left in uip_buf: a forwarded packet,
+   or a reply or an error built in place of the received packet. */
+static void
+input_output(void)
+{
+#if UIP_BUFFERS > 1
+  int buf;
+  uint8_t i;
+
+  /* Hand the packet off to tcpip_process, so that the receive buffer
+     can take the next packet while this one waits to be sent. */
+  buf = uip_buf_handoff();
+  if(buf >= 0) {
+    for(i = 0; i < UIPBUF_ATTR_MAX; i++) {
+      handoff_attrs[buf][i] = uipbuf_get_attr(i);
+    }
+    if(process_post(&tcpip_process, PACKET_OUTPUT,
+                    (process_data_t)(uintptr_t)buf) == PROCESS_ERR_OK) {
+      return;
+    }
+    /* The event queue is full: send the packet right away */
+    uip_buf_select(buf);
+    tcpip_ipv6_output();
+    uip_buf_free(buf);
+    return;
+  }
+#endif /* UIP_BUFFERS > 1 */
+  tcpip_ipv6_output();
+}
+/*---------------------------------------------------------------------------*/
+#if UIP_BUFFERS > 1
+static void
+handoff_output(int buf)
+{
+  int prev;
+  uint8_t i;
+
+  prev = uip_buf_select(buf);
+  for(i = 0; i < UIPBUF_ATTR_MAX; i++) {
+    uipbuf_set_attr(i, handoff_attrs[buf][i]);
+  }
+  tcpip_ipv6_output();
+  uip_buf_select(prev);
+  uip_buf_free(buf);
+}
+#endif /* UIP_BUFFERS > 1 */
+/*---------------------------------------------------------------------------*/
 static void
 packet_input(void)
 {
@@ -182,7 +235,7 @@ packet_input(void)
 
     uip_input();
     if(uip_len > 0) {
-      tcpip_ipv6_output();
+      input_output();
     }
   }
 }
@@ -355,7 +408,7 @@ eventhandler(process_event_t ev, process_data_t data)
       for(cptr = &uip_udp_conns[0];
           cptr < &uip_udp_conns[UIP_UDP_CONNS]; ++cptr) {
         if(cptr->appstate.p == p) {
-          cptr->lport = 0;
+          uip_udp_remove(cptr);
         }
       }
     }
@@ -438,6 +491,12 @@ eventhandler(process_event_t ev, process_data_t data)
   case PACKET_INPUT:
     packet_input();
     break;
+
+#if UIP_BUFFERS > 1
+  case PACKET_OUTPUT:
+    handoff_output((int)(uintptr_t)data);
+    break;
+#endif /* UIP_BUFFERS > 1 */
   };
 }
 /*---------------------------------------------------------------------------*/
@@ -748,7 +807,7 @@ exit:
 void
 tcpip_poll_udp(struct uip_udp_conn *conn)
 {
-  process_post(&tcpip_process, UDP_POLL, conn);
+  process_post_coalesce(&tcpip_process, UDP_POLL, conn);
 }
 #endif /* UIP_UDP */
 /*---------------------------------------------------------------------------*/
@@ -756,7 +815,7 @@ tcpip_poll_udp(struct uip_udp_conn *conn)
 void
 tcpip_poll_tcp(struct uip_conn *conn)
 {
-  process_post(&tcpip_process, TCP_POLL, conn);
+  process_post_coalesce(&tcpip_process, TCP_POLL, conn);
 }
 #endif /* UIP_TCP */
 /*---------------------------------------------------------------------------*/
@@ -43,7 +43,7 @@
 #include "net/ipv6/uip-sr.h"
 #include "net/ipv6/uiplib.h"
 #include "net/routing/routing.h"
-#include "lib/list.h"
+#include "lib/tail-list.h"
 #include "lib/memb.h"
 
 /* Log configuration */
@@ -55,7 +55,7 @@
 static int num_nodes;
 
 /* Every known node in the network */
-LIST(nodelist);
+TAIL_LIST(nodelist);
 MEMB(nodememb, uip_sr_node_t, UIP_SR_LINK_NUM);
 
 /*---------------------------------------------------------------------------*/
@@ -81,7 +81,7 @@ uip_sr_node_t *
 uip_sr_get_node(void *graph, const uip_ipaddr_t *addr)
 {
   uip_sr_node_t *l;
-  for(l = list_head(nodelist); l != NULL; l = list_item_next(l)) {
+  for(l = tail_list_head(nodelist); l != NULL; l = tail_list_item_next(l)) {
     /* Compare prefix and node identifier */
     if(node_matches_address(graph, l, addr)) {
       return l;
@@ -148,7 +148,7 @@ uip_sr_update_node(void *graph, const uip_ipaddr_t *child, const uip_ipaddr_t *p
       return NULL;
     }
     child_node->parent = NULL;
-    list_add(nodelist, child_node);
+    tail_list_add(nodelist, child_node);
     num_nodes++;
   }
 
@@ -187,19 +187,19 @@ uip_sr_init(void)
 {
   num_nodes = 0;
   memb_init(&nodememb);
-  list_init(nodelist);
+  tail_list_init(nodelist);
 }
 /*---------------------------------------------------------------------------*/
 uip_sr_node_t *
 uip_sr_node_head(void)
 {
-  return list_head(nodelist);
+  return tail_list_head(nodelist);
 }
 /*---------------------------------------------------------------------------*/
 uip_sr_node_t *
 uip_sr_node_next(uip_sr_node_t *item)
 {
-  return list_item_next(item);
+  return tail_list_item_next(item);
 }
 /*---------------------------------------------------------------------------*/
 void
@@ -209,11 +209,11 @@ uip_sr_periodic(unsigned seconds)
   uip_sr_node_t *next;
 
   /* First pass, for all expired nodes, deallocate them iff no child points to them */
-  for(l = list_head(nodelist); l != NULL; l = next) {
-    next = list_item_next(l);
+  for(l = tail_list_head(nodelist); l != NULL; l = next) {
+    next = tail_list_item_next(l);
     if(l->lifetime == 0) {
       uip_sr_node_t *l2;
-      for(l2 = list_head(nodelist); l2 != NULL; l2 = list_item_next(l2)) {
+      for(l2 = tail_list_head(nodelist); l2 != NULL; l2 = tail_list_item_next(l2)) {
         if(l2->parent == l) {
           break;
         }
@@ -226,7 +226,7 @@ uip_sr_periodic(unsigned seconds)
         LOG_INFO_("\n");
       }
       /* No child found, deallocate node */
-      list_remove(nodelist, l);
+      tail_list_remove(nodelist, l);
       memb_free(&nodememb, l);
       num_nodes--;
     } else if(l->lifetime != UIP_SR_INFINITE_LIFETIME) {
@@ -240,9 +240,9 @@ uip_sr_free_all(void)
 {
   uip_sr_node_t *l;
   uip_sr_node_t *next;
-  for(l = list_head(nodelist); l != NULL; l = next) {
-    next = list_item_next(l);
-    list_remove(nodelist, l);
+  for(l = tail_list_head(nodelist); l != NULL; l = next) {
+    next = tail_list_item_next(l);
+    tail_list_remove(nodelist, l);
     memb_free(&nodememb, l);
     num_nodes--;
   }
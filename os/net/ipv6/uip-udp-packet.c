@@ -51,6 +51,17 @@ void
 uip_udp_packet_send(struct uip_udp_conn *c, const void *data, int len)
 {
 #if UIP_UDP
+#if UIP_BUFFERS > 1
+  int buf;
+  int prev;
+
+  /* Build the datagram in a spare buffer if there is one, so that a
+     packet in the current buffer, typically the one being replied to,
+     is left intact. */
+  buf = uip_buf_alloc();
+  prev = uip_buf_select(buf);
+#endif /* UIP_BUFFERS > 1 */
+
   if(data != NULL && len <= (UIP_BUFSIZE - UIP_IPUDPH_LEN)) {
     uip_udp_conn = c;
     uip_slen = len;
@@ -73,6 +84,12 @@ uip_udp_packet_send(struct uip_udp_conn *c, const void *data, int len)
 #endif
   }
   uip_slen = 0;
+#if UIP_BUFFERS > 1
+  if(buf >= 0) {
+    uip_buf_select(prev);
+    uip_buf_free(buf);
+  }
+#endif /* UIP_BUFFERS > 1 */
 #endif /* UIP_UDP */
 }
 /*---------------------------------------------------------------------------*/
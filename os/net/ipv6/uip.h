@@ -504,10 +504,84 @@ typedef union {
   uint8_t u8[UIP_BUFSIZE];
 } uip_buf_t;
 
+/**
+ * Number of uIP packet buffers.
+ *
+ * With more than one buffer, uip_buf refers to the current buffer of
+ * a pool. A packet can then be built in a spare buffer while the
+ * packet in the current buffer, along with uip_len, uip_ext_len,
+ * uip_last_proto and uip_appdata, is kept for its owner. UDP output
+ * is built in a spare buffer. A forwarded packet, or a reply that
+ * uip_input() built, is handed off from the receive buffer and sent
+ * later from tcpip_process, so that further packets can be received
+ * in the meantime.
+ */
+#ifdef UIP_CONF_BUFFERS
+#define UIP_BUFFERS UIP_CONF_BUFFERS
+#else /* UIP_CONF_BUFFERS */
+#define UIP_BUFFERS 1
+#endif /* UIP_CONF_BUFFERS */
+
+#if UIP_BUFFERS > 1
+extern uip_buf_t uip_bufs[UIP_BUFFERS];
+extern uip_buf_t *uip_current_buf;
+
+/** Macro to access the current uIP buffer as an array of bytes */
+#define uip_buf (uip_current_buf->u8)
+#else /* UIP_BUFFERS > 1 */
 extern uip_buf_t uip_aligned_buf;
 
 /** Macro to access uip_aligned_buf as an array of bytes */
 #define uip_buf (uip_aligned_buf.u8)
+#endif /* UIP_BUFFERS > 1 */
+
+/**
+ * \brief      Allocate a spare uIP buffer
+ * \return     A buffer handle, or -1 if no buffer is free
+ *
+ * The buffer is empty and does not become current until it is
+ * passed to uip_buf_select(). The receive buffer, where the network
+ * drivers place incoming packets, is always allocated. It starts out
+ * as buffer 0.
+ */
+int uip_buf_alloc(void);
+
+/**
+ * \brief      Free a uIP buffer
+ * \param h    A handle returned by uip_buf_alloc() or uip_buf_handoff()
+ *
+ * If the buffer is current, the receive buffer is selected first.
+ */
+void uip_buf_free(int h);
+
+/**
+ * \brief      Hand off the packet in the receive buffer
+ * \return     A handle for the buffer that holds the packet, or -1
+ *
+ * The packet is not copied. Its buffer, along with its packet state,
+ * is kept under the returned handle, and a free buffer becomes the
+ * current, empty receive buffer. The new owner of the packet selects
+ * the handle to work on the packet, and frees it when done.
+ *
+ * Fails if the receive buffer is not current or if no buffer is free.
+ */
+int uip_buf_handoff(void);
+
+/**
+ * \brief      Make a uIP buffer current
+ * \param h    The buffer handle
+ * \return     The handle of the previously current buffer
+ *
+ * The packet state of the previous buffer (uip_len, uip_ext_len,
+ * uip_last_proto, uip_appdata and uip_sappdata) is saved, and the
+ * state of the selected buffer is restored.
+ */
+int uip_buf_select(int h);
+
+/**
+ * \brief      Get the handle of the current uIP buffer
+ */
+int uip_buf_current(void);
 
 
 /** @} */
@@ -861,7 +935,11 @@ struct uip_udp_conn *uip_udp_new(const uip_ipaddr_t *ripaddr, uint16_t rport);
  *
  * \hideinitializer
  */
+#if UIP_CONN_HASH
+void uip_udp_remove(struct uip_udp_conn *conn);
+#else /* UIP_CONN_HASH */
 #define uip_udp_remove(conn) (conn)->lport = 0
+#endif /* UIP_CONN_HASH */
 
 /**
  * Bind a UDP connection to a local port.
@@ -873,7 +951,11 @@ struct uip_udp_conn *uip_udp_new(const uip_ipaddr_t *ripaddr, uint16_t rport);
  *
  * \hideinitializer
  */
+#if UIP_CONN_HASH
+void uip_udp_bind(struct uip_udp_conn *conn, uint16_t port);
+#else /* UIP_CONN_HASH */
 #define uip_udp_bind(conn, port) (conn)->lport = port
+#endif /* UIP_CONN_HASH */
 
 /**
  * Send a UDP datagram of length len on the current connection.
@@ -140,9 +140,15 @@ uint8_t uip_last_proto = 0;
  * @{
  */
 /** Packet buffer for incoming and outgoing packets */
-#ifndef UIP_CONF_EXTERNAL_BUFFER
-uip_buf_t uip_aligned_buf;
+#if UIP_BUFFERS > 1
+#ifdef UIP_CONF_EXTERNAL_BUFFER
+#error "UIP_CONF_BUFFERS > 1 cannot be used with UIP_CONF_EXTERNAL_BUFFER"
 #endif /* UIP_CONF_EXTERNAL_BUFFER */
+uip_buf_t uip_bufs[UIP_BUFFERS];
+uip_buf_t *uip_current_buf = &uip_bufs[0];
+#elif !defined(UIP_CONF_EXTERNAL_BUFFER)
+uip_buf_t uip_aligned_buf;
+#endif /* UIP_BUFFERS > 1 */
 
 /* The uip_appdata pointer points to application data. */
 void *uip_appdata;
@@ -159,6 +165,137 @@ uint16_t uip_urglen, uip_surglen;
 uint16_t uip_len, uip_slen;
 /** @} */
 
+/*---------------------------------------------------------------------------*/
+#if UIP_BUFFERS > 1
+/** Packet state of a uIP buffer while another buffer is current */
+struct uip_buf_state {
+  void *appdata;
+  void *sappdata;
+  uint16_t len;
+  uint8_t ext_len;
+  uint8_t last_proto;
+  uint8_t allocated;
+};
+
+static struct uip_buf_state buf_states[UIP_BUFFERS] = {
+  [0] = { .allocated = 1 }
+};
+static uint8_t buf_current;
+/* The receive buffer, where the drivers place incoming packets */
+static uint8_t buf_home;
+/*---------------------------------------------------------------------------*/
+static int
+take_free_buf(void)
+{
+  int h;
+
+  for(h = 0; h < UIP_BUFFERS; h++) {
+    if(!buf_states[h].allocated) {
+      buf_states[h].allocated = 1;
+      buf_states[h].len = 0;
+      buf_states[h].ext_len = 0;
+      buf_states[h].last_proto = 0;
+      buf_states[h].appdata = &uip_bufs[h].u8[UIP_IPTCPH_LEN];
+      buf_states[h].sappdata = buf_states[h].appdata;
+      return h;
+    }
+  }
+  return -1;
+}
+#endif /* UIP_BUFFERS > 1 */
+/*---------------------------------------------------------------------------*/
+int
+uip_buf_alloc(void)
+{
+#if UIP_BUFFERS > 1
+  return take_free_buf();
+#else /* UIP_BUFFERS > 1 */
+  return -1;
+#endif /* UIP_BUFFERS > 1 */
+}
+/*---------------------------------------------------------------------------*/
+void
+uip_buf_free(int h)
+{
+#if UIP_BUFFERS > 1
+  if(h < 0 || h >= UIP_BUFFERS || h == buf_home) {
+    return;
+  }
+  if(h == buf_current) {
+    uip_buf_select(buf_home);
+  }
+  buf_states[h].allocated = 0;
+#endif /* UIP_BUFFERS > 1 */
+}
+/*---------------------------------------------------------------------------*/
+int
+uip_buf_handoff(void)
+{
+#if UIP_BUFFERS > 1
+  int h;
+  int prev;
+
+  if(buf_current != buf_home) {
+    return -1;
+  }
+  h = take_free_buf();
+  if(h < 0) {
+    return -1;
+  }
+
+  /* The buffer keeps its packet and stays allocated under its own
+     handle; an empty one takes over receiving */
+  buf_home = h;
+  prev = uip_buf_select(h);
+  return prev;
+#else /* UIP_BUFFERS > 1 */
+  return -1;
+#endif /* UIP_BUFFERS > 1 */
+}
+/*---------------------------------------------------------------------------*/
+int
+uip_buf_select(int h)
+{
+#if UIP_BUFFERS > 1
+  struct uip_buf_state *state;
+  int prev;
+
+  prev = buf_current;
+  if(h < 0 || h >= UIP_BUFFERS || h == prev) {
+    return prev;
+  }
+
+  state = &buf_states[prev];
+  state->appdata = uip_appdata;
+  state->sappdata = uip_sappdata;
+  state->len = uip_len;
+  state->ext_len = uip_ext_len;
+  state->last_proto = uip_last_proto;
+
+  state = &buf_states[h];
+  uip_appdata = state->appdata;
+  uip_sappdata = state->sappdata;
+  uip_len = state->len;
+  uip_ext_len = state->ext_len;
+  uip_last_proto = state->last_proto;
+
+  buf_current = h;
+  uip_current_buf = &uip_bufs[h];
+  return prev;
+#else /* UIP_BUFFERS > 1 */
+  return 0;
+#endif /* UIP_BUFFERS > 1 */
+}
+/*---------------------------------------------------------------------------*/
+int
+uip_buf_current(void)
+{
+#if UIP_BUFFERS > 1
+  return buf_current;
+#else /* UIP_BUFFERS > 1 */
+  return 0;
+#endif /* UIP_BUFFERS > 1 */
+}
 /*---------------------------------------------------------------------------*/
 /**
  * \name General variables
@@ -232,6 +369,48 @@ struct uip_udp_conn uip_udp_conns[UIP_UDP_CONNS];
 #endif /* UIP_UDP */
 /** @} */
 
+/*---------------------------------------------------------------------------*/
+/**
+ * \name Connection hash
+ * @{
+ */
+/*---------------------------------------------------------------------------*/
+#if UIP_CONN_HASH
+#if (UIP_CONN_HASH_SIZE & (UIP_CONN_HASH_SIZE - 1)) != 0
+#error "UIP_CONF_CONN_HASH_SIZE must be a power of two"
+#endif
+#if UIP_CONN_HASH_SIZE > 256
+#error "UIP_CONF_CONN_HASH_SIZE must be at most 256"
+#endif
+
+#if UIP_UDP_CONNS < 255 && UIP_TCP_CONNS < 255 && UIP_CONN_HASH_SIZE < 255
+typedef uint8_t conn_index_t;
+#else
+typedef uint16_t conn_index_t;
+#endif
+
+/*
+ * Chains hold connection indexes plus one, so that zero ends a chain,
+ * and are sorted by index: the first matching connection of a chain is
+ * the one that a scan of the table would find. The chain of each
+ * connection is recorded, plus one, so that it can be unlinked.
+ *
+ * UDP connections are hashed on the local port, TCP connections on
+ * both ports. The remote port and address are checked on lookup.
+ */
+#if UIP_UDP
+static conn_index_t udp_head[UIP_CONN_HASH_SIZE];
+static conn_index_t udp_next[UIP_UDP_CONNS];
+static conn_index_t udp_chain[UIP_UDP_CONNS];
+#endif /* UIP_UDP */
+#if UIP_TCP
+static conn_index_t tcp_head[UIP_CONN_HASH_SIZE];
+static conn_index_t tcp_next[UIP_TCP_CONNS];
+static conn_index_t tcp_chain[UIP_TCP_CONNS];
+#endif /* UIP_TCP */
+#endif /* UIP_CONN_HASH */
+/** @} */
+
 /*---------------------------------------------------------------------------*/
 /**
  * \name ICMPv6 variables
@@ -383,6 +562,106 @@ uip_udpchksum(void)
 #endif /* UIP_UDP && UIP_UDP_CHECKSUMS */
 #endif /* UIP_ARCH_CHKSUM */
 /*---------------------------------------------------------------------------*/
+#if UIP_CONN_HASH
+static unsigned
+port_hash(uint16_t key)
+{
+  return (key ^ (key >> 8)) & (UIP_CONN_HASH_SIZE - 1);
+}
+/*---------------------------------------------------------------------------*/
+static void
+hash_remove(conn_index_t *head, conn_index_t *next, conn_index_t *chain,
+            int c)
+{
+  conn_index_t *p;
+
+  if(chain[c] == 0) {
+    return;
+  }
+  for(p = &head[chain[c] - 1]; *p != 0; p = &next[*p - 1]) {
+    if(*p == c + 1) {
+      *p = next[c];
+      break;
+    }
+  }
+  chain[c] = 0;
+}
+/*---------------------------------------------------------------------------*/
+static void
+hash_add(conn_index_t *head, conn_index_t *next, conn_index_t *chain,
+         int c, unsigned h)
+{
+  conn_index_t *p;
+
+  hash_remove(head, next, chain, c);
+  for(p = &head[h]; *p != 0 && *p <= c; p = &next[*p - 1]);
+  next[c] = *p;
+  *p = c + 1;
+  chain[c] = h + 1;
+}
+/*---------------------------------------------------------------------------*/
+#if UIP_UDP
+static struct uip_udp_conn *
+udp_hash_first(uint16_t lport)
+{
+  conn_index_t c = udp_head[port_hash(lport)];
+
+  return c == 0 ? NULL : &uip_udp_conns[c - 1];
+}
+/*---------------------------------------------------------------------------*/
+static struct uip_udp_conn *
+udp_hash_next(struct uip_udp_conn *conn)
+{
+  conn_index_t c = udp_next[conn - uip_udp_conns];
+
+  return c == 0 ? NULL : &uip_udp_conns[c - 1];
+}
+/*---------------------------------------------------------------------------*/
+void
+uip_udp_bind(struct uip_udp_conn *conn, uint16_t port)
+{
+  conn->lport = port;
+  if(port == 0) {
+    hash_remove(udp_head, udp_next, udp_chain, conn - uip_udp_conns);
+  } else {
+    hash_add(udp_head, udp_next, udp_chain, conn - uip_udp_conns,
+             port_hash(port));
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+uip_udp_remove(struct uip_udp_conn *conn)
+{
+  uip_udp_bind(conn, 0);
+}
+#endif /* UIP_UDP */
+/*---------------------------------------------------------------------------*/
+#if UIP_TCP
+static struct uip_conn *
+tcp_hash_first(uint16_t lport, uint16_t rport)
+{
+  conn_index_t c = tcp_head[port_hash(lport ^ rport)];
+
+  return c == 0 ? NULL : &uip_conns[c - 1];
+}
+/*---------------------------------------------------------------------------*/
+static struct uip_conn *
+tcp_hash_next(struct uip_conn *conn)
+{
+  conn_index_t c = tcp_next[conn - uip_conns];
+
+  return c == 0 ? NULL : &uip_conns[c - 1];
+}
+/*---------------------------------------------------------------------------*/
+static void
+tcp_hash_add(struct uip_conn *conn)
+{
+  hash_add(tcp_head, tcp_next, tcp_chain, conn - uip_conns,
+           port_hash(conn->lport ^ conn->rport));
+}
+#endif /* UIP_TCP */
+#endif /* UIP_CONN_HASH */
+/*---------------------------------------------------------------------------*/
 void
 uip_init(void)
 {
@@ -400,6 +679,10 @@ uip_init(void)
   for(c = 0; c < UIP_TCP_CONNS; ++c) {
     uip_conns[c].tcpstateflags = UIP_CLOSED;
   }
+#if UIP_CONN_HASH
+  memset(tcp_head, 0, sizeof(tcp_head));
+  memset(tcp_chain, 0, sizeof(tcp_chain));
+#endif /* UIP_CONN_HASH */
 #endif /* UIP_TCP */
 
 #if UIP_ACTIVE_OPEN || UIP_UDP
@@ -410,6 +693,10 @@ uip_init(void)
   for(c = 0; c < UIP_UDP_CONNS; ++c) {
     uip_udp_conns[c].lport = 0;
   }
+#if UIP_CONN_HASH
+  memset(udp_head, 0, sizeof(udp_head));
+  memset(udp_chain, 0, sizeof(udp_chain));
+#endif /* UIP_CONN_HASH */
 #endif /* UIP_UDP */
 
 #if UIP_IPV6_MULTICAST
@@ -484,6 +771,9 @@ uip_connect(const uip_ipaddr_t *ripaddr, uint16_t rport)
   conn->lport = uip_htons(lastport);
   conn->rport = rport;
   uip_ipaddr_copy(&conn->ripaddr, ripaddr);
+#if UIP_CONN_HASH
+  tcp_hash_add(conn);
+#endif /* UIP_CONN_HASH */
 
   return conn;
 }
@@ -529,11 +819,20 @@ uip_udp_new(const uip_ipaddr_t *ripaddr, uint16_t rport)
     lastport = 4096;
   }
 
+#if UIP_CONN_HASH
+  for(conn = udp_hash_first(uip_htons(lastport)); conn != NULL;
+      conn = udp_hash_next(conn)) {
+    if(conn->lport == uip_htons(lastport)) {
+      goto again;
+    }
+  }
+#else /* UIP_CONN_HASH */
   for(c = 0; c < UIP_UDP_CONNS; ++c) {
     if(uip_udp_conns[c].lport == uip_htons(lastport)) {
       goto again;
     }
   }
+#endif /* UIP_CONN_HASH */
 
   conn = 0;
   for(c = 0; c < UIP_UDP_CONNS; ++c) {
@@ -547,7 +846,11 @@ uip_udp_new(const uip_ipaddr_t *ripaddr, uint16_t rport)
     return 0;
   }
 
+#if UIP_CONN_HASH
+  uip_udp_bind(conn, UIP_HTONS(lastport));
+#else /* UIP_CONN_HASH */
   conn->lport = UIP_HTONS(lastport);
+#endif /* UIP_CONN_HASH */
   conn->rport = rport;
   if(ripaddr == NULL) {
     memset(&conn->ripaddr, 0, sizeof(uip_ipaddr_t));
@@ -1496,9 +1799,15 @@ uip_process(uint8_t flag)
   }
 
   /* Demultiplex this UDP packet between the UDP "connections". */
+#if UIP_CONN_HASH
+  for(uip_udp_conn = udp_hash_first(UIP_UDP_BUF->destport);
+      uip_udp_conn != NULL;
+      uip_udp_conn = udp_hash_next(uip_udp_conn)) {
+#else /* UIP_CONN_HASH */
   for(uip_udp_conn = &uip_udp_conns[0];
       uip_udp_conn < &uip_udp_conns[UIP_UDP_CONNS];
       ++uip_udp_conn) {
+#endif /* UIP_CONN_HASH */
     /* If the local UDP port is non-zero, the connection is considered
        to be used. If so, the local port number is checked against the
        destination port number in the received packet. If the two port
@@ -1600,8 +1909,14 @@ uip_process(uint8_t flag)
 
   /* Demultiplex this segment. */
   /* First check any active connections. */
+#if UIP_CONN_HASH
+  for(uip_connr = tcp_hash_first(UIP_TCP_BUF->destport, UIP_TCP_BUF->srcport);
+      uip_connr != NULL;
+      uip_connr = tcp_hash_next(uip_connr)) {
+#else /* UIP_CONN_HASH */
   for(uip_connr = &uip_conns[0]; uip_connr <= &uip_conns[UIP_TCP_CONNS - 1];
       ++uip_connr) {
+#endif /* UIP_CONN_HASH */
     if(uip_connr->tcpstateflags != UIP_CLOSED &&
        UIP_TCP_BUF->destport == uip_connr->lport &&
        UIP_TCP_BUF->srcport == uip_connr->rport &&
@@ -1725,6 +2040,9 @@ uip_process(uint8_t flag)
   uip_connr->rport = UIP_TCP_BUF->srcport;
   uip_ipaddr_copy(&uip_connr->ripaddr, &UIP_IP_BUF->srcipaddr);
   uip_connr->tcpstateflags = UIP_SYN_RCVD;
+#if UIP_CONN_HASH
+  tcp_hash_add(uip_connr);
+#endif /* UIP_CONN_HASH */
 
   uip_connr->snd_nxt[0] = iss[0];
   uip_connr->snd_nxt[1] = iss[1];
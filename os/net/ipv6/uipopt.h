@@ -305,6 +305,41 @@ void uip_log(char *msg);
 #define UIP_UDP_CONNS    10
 #endif /* UIP_CONF_UDP_CONNS */
 
+/**
+ * Find the receiving UDP and TCP connection of an incoming packet
+ * through a hash on the ports instead of a scan of the connection
+ * tables. Worth it with many connections, e.g. on gateways.
+ *
+ * \note With the hash, the local port of a UDP connection must only
+ * be changed through uip_udp_new(), uip_udp_bind() and
+ * uip_udp_remove().
+ *
+ * \hideinitializer
+ */
+#ifdef UIP_CONF_CONN_HASH
+#define UIP_CONN_HASH (UIP_CONF_CONN_HASH)
+#else /* UIP_CONF_CONN_HASH */
+#define UIP_CONN_HASH 0
+#endif /* UIP_CONF_CONN_HASH */
+
+/**
+ * Number of chains of the connection hash, a power of two. By
+ * default, about one chain per four UDP connections.
+ *
+ * \hideinitializer
+ */
+#ifdef UIP_CONF_CONN_HASH_SIZE
+#define UIP_CONN_HASH_SIZE (UIP_CONF_CONN_HASH_SIZE)
+#elif UIP_UDP_CONNS <= 32
+#define UIP_CONN_HASH_SIZE 8
+#elif UIP_UDP_CONNS <= 64
+#define UIP_CONN_HASH_SIZE 16
+#elif UIP_UDP_CONNS <= 128
+#define UIP_CONN_HASH_SIZE 32
+#else
+#define UIP_CONN_HASH_SIZE 64
+#endif /* UIP_CONF_CONN_HASH_SIZE */
+
 /**
  * The name of the function that should be called when UDP datagrams arrive.
  *
@@ -408,7 +408,7 @@ eb_input(struct input_packet *current_input)
       int32_t asn_diff = TSCH_ASN_DIFF(current_input->rx_asn, eb_ies.ie_asn);
       if(asn_diff != 0) {
         /* We disagree with our time source's ASN -- leave the network */
-        LOG_WARN("! ASN drifted by %ld, leaving the network\n", asn_diff);
+        LOG_WARN("! ASN drifted by %ld, leaving the network\n", (long)asn_diff);
         tsch_disassociate();
       }
 
@@ -523,7 +523,8 @@ tsch_start_coordinator(void)
   tsch_join_priority = 0;
 
   LOG_INFO("starting as coordinator, PAN ID %x, asn-%x.%lx\n",
-      frame802154_get_pan_id(), tsch_current_asn.ms1b, tsch_current_asn.ls4b);
+      frame802154_get_pan_id(), tsch_current_asn.ms1b,
+      (unsigned long)tsch_current_asn.ls4b);
 
   /* Start slot operation */
   tsch_slot_operation_sync(RTIMER_NOW(), &tsch_current_asn);
@@ -535,7 +536,7 @@ tsch_disassociate(void)
 {
   if(tsch_is_associated == 1) {
     tsch_is_associated = 0;
-    process_post(&tsch_process, PROCESS_EVENT_POLL, NULL);
+    process_post_prio(&tsch_process, PROCESS_PRIO_HIGH, PROCESS_EVENT_POLL, NULL);
   }
 }
 /*---------------------------------------------------------------------------*/
@@ -624,7 +625,8 @@ tsch_associate(const struct input_packet *input_eb, rtimer_clock_t timestamp)
   int32_t asn_diff = (int32_t)tsch_current_asn.ls4b - expected_asn;
   if(asn_diff > asn_threshold) {
     LOG_ERR("! EB ASN rejected %lx %lx %ld\n",
-           tsch_current_asn.ls4b, expected_asn, asn_diff);
+           (unsigned long)tsch_current_asn.ls4b, (unsigned long)expected_asn,
+           (long)asn_diff);
     return 0;
   }
 #endif
@@ -697,7 +699,8 @@ tsch_associate(const struct input_packet *input_eb, rtimer_clock_t timestamp)
              tsch_association_count,
              tsch_is_pan_secured,
              frame.src_pid,
-             tsch_current_asn.ms1b, tsch_current_asn.ls4b, tsch_join_priority,
+             tsch_current_asn.ms1b, (unsigned long)tsch_current_asn.ls4b,
+             tsch_join_priority,
              ies.ie_tsch_timeslot_id,
              ies.ie_channel_hopping_sequence_id,
              ies.ie_tsch_slotframe_and_link.slotframe_size,
@@ -922,9 +925,10 @@ tsch_init(void)
   radio_value_t radio_rx_mode;
   radio_value_t radio_tx_mode;
   rtimer_clock_t t;
+  const uint16_t *default_timing = TSCH_DEFAULT_TIMESLOT_TIMING;
 
   /* Check that the platform provides a TSCH timeslot timing template */
-  if(TSCH_DEFAULT_TIMESLOT_TIMING == NULL) {
+  if(default_timing == NULL) {
     LOG_ERR("! platform does not provide a timeslot timing template.\n");
     return;
   }
@@ -83,6 +83,43 @@ static unsigned num_tables;
 MEMB(neighbor_addr_mem, nbr_table_key_t, NBR_TABLE_MAX_NEIGHBORS);
 LIST(nbr_table_keys);
 
+#if NBR_TABLE_WITH_INDEX
+#if NBR_TABLE_INDEX_SIZE & (NBR_TABLE_INDEX_SIZE - 1)
+#error "NBR_TABLE_CONF_INDEX_SIZE must be a power of two"
+#endif
+#if NBR_TABLE_INDEX_SIZE <= NBR_TABLE_MAX_NEIGHBORS
+#error "NBR_TABLE_CONF_INDEX_SIZE must be larger than NBR_TABLE_CONF_MAX_NEIGHBORS"
+#endif
+
+/* A neighbor index, or NO_INDEX */
+#if NBR_TABLE_MAX_NEIGHBORS < 0xff
+typedef uint8_t nbr_index_t;
+#else
+typedef uint16_t nbr_index_t;
+#endif
+#define NO_INDEX ((nbr_index_t)~0)
+
+/* Open-addressing hash index over the keys, with linear probing */
+static nbr_index_t hash_slots[NBR_TABLE_INDEX_SIZE];
+
+/* The key list is doubly linked through key_prev, so that a key is
+ * removed from it in constant time */
+static nbr_index_t key_prev[NBR_TABLE_MAX_NEIGHBORS];
+static nbr_table_key_t *keys_tail;
+
+/* Eviction classes: unlocked keys, by the number of tables that use
+ * them. Locked keys are in no class. Each class is a list, from the
+ * least recently to the most recently changed key. */
+#define NUM_CLASSES (MAX_NUM_TABLES + 1)
+#define NO_CLASS 0xff
+static uint8_t key_class[NBR_TABLE_MAX_NEIGHBORS];
+static nbr_index_t class_next[NBR_TABLE_MAX_NEIGHBORS];
+static nbr_index_t class_prev[NBR_TABLE_MAX_NEIGHBORS];
+static nbr_index_t class_head[NUM_CLASSES];
+static nbr_index_t class_tail[NUM_CLASSES];
+static uint8_t index_initialized;
+#endif /* NBR_TABLE_WITH_INDEX */
+
 /*---------------------------------------------------------------------------*/
 /* Get a key from a neighbor index */
 static nbr_table_key_t *
@@ -125,17 +162,189 @@ key_from_item(nbr_table_t *table, const nbr_table_item_t *item)
 {
   return key_from_index(index_from_item(table, item));
 }
+#if NBR_TABLE_WITH_INDEX
+/*---------------------------------------------------------------------------*/
+static void
+index_init(void)
+{
+  unsigned i;
+
+  for(i = 0; i < NBR_TABLE_INDEX_SIZE; i++) {
+    hash_slots[i] = NO_INDEX;
+  }
+  for(i = 0; i < NBR_TABLE_MAX_NEIGHBORS; i++) {
+    key_class[i] = NO_CLASS;
+  }
+  for(i = 0; i < NUM_CLASSES; i++) {
+    class_head[i] = class_tail[i] = NO_INDEX;
+  }
+  index_initialized = 1;
+}
+/*---------------------------------------------------------------------------*/
+static unsigned
+hash_lladdr(const linkaddr_t *lladdr)
+{
+  uint32_t h = 2166136261UL;
+  int i;
+
+  /* FNV-1a */
+  for(i = 0; i < LINKADDR_SIZE; i++) {
+    h = (h ^ lladdr->u8[i]) * 16777619UL;
+  }
+  return (h ^ (h >> 16)) & (NBR_TABLE_INDEX_SIZE - 1);
+}
+/*---------------------------------------------------------------------------*/
+static void
+hash_insert(int index)
+{
+  unsigned slot = hash_lladdr(&key_from_index(index)->lladdr);
+
+  while(hash_slots[slot] != NO_INDEX) {
+    slot = (slot + 1) & (NBR_TABLE_INDEX_SIZE - 1);
+  }
+  hash_slots[slot] = index;
+}
+/*---------------------------------------------------------------------------*/
+static void
+hash_remove(int index)
+{
+  unsigned slot, next, home;
+
+  slot = hash_lladdr(&key_from_index(index)->lladdr);
+  while(hash_slots[slot] != index) {
+    if(hash_slots[slot] == NO_INDEX) {
+      return;
+    }
+    slot = (slot + 1) & (NBR_TABLE_INDEX_SIZE - 1);
+  }
+
+  /* Shift back the entries that follow in the same run, so that no
+   * lookup stops early at the hole */
+  next = slot;
+  for(;;) {
+    next = (next + 1) & (NBR_TABLE_INDEX_SIZE - 1);
+    if(hash_slots[next] == NO_INDEX) {
+      break;
+    }
+    home = hash_lladdr(&key_from_index(hash_slots[next])->lladdr);
+    /* Move the entry unless its home slot is cyclically in (slot, next] */
+    if(((next - home) & (NBR_TABLE_INDEX_SIZE - 1)) >=
+       ((next - slot) & (NBR_TABLE_INDEX_SIZE - 1))) {
+      hash_slots[slot] = hash_slots[next];
+      slot = next;
+    }
+  }
+  hash_slots[slot] = NO_INDEX;
+}
+/*---------------------------------------------------------------------------*/
+static void
+keys_add(nbr_table_key_t *key)
+{
+  key->next = NULL;
+  if(keys_tail == NULL) {
+    *nbr_table_keys = key;
+    key_prev[index_from_key(key)] = NO_INDEX;
+  } else {
+    keys_tail->next = key;
+    key_prev[index_from_key(key)] = index_from_key(keys_tail);
+  }
+  keys_tail = key;
+}
+/*---------------------------------------------------------------------------*/
+static void
+keys_remove(nbr_table_key_t *key)
+{
+  int index = index_from_key(key);
+  nbr_table_key_t *prev;
+
+  prev = key_prev[index] == NO_INDEX ? NULL : key_from_index(key_prev[index]);
+  if(prev == NULL) {
+    *nbr_table_keys = key->next;
+  } else {
+    prev->next = key->next;
+  }
+  if(key->next != NULL) {
+    key_prev[index_from_key(key->next)] = key_prev[index];
+  } else {
+    keys_tail = prev;
+  }
+  key->next = NULL;
+}
+/*---------------------------------------------------------------------------*/
+static void
+class_unlink(int index)
+{
+  uint8_t c = key_class[index];
+
+  if(c == NO_CLASS) {
+    return;
+  }
+  if(class_prev[index] == NO_INDEX) {
+    class_head[c] = class_next[index];
+  } else {
+    class_next[class_prev[index]] = class_next[index];
+  }
+  if(class_next[index] == NO_INDEX) {
+    class_tail[c] = class_prev[index];
+  } else {
+    class_prev[class_next[index]] = class_prev[index];
+  }
+  key_class[index] = NO_CLASS;
+}
+/*---------------------------------------------------------------------------*/
+/* Put a key at the end of the class matching its used and locked
+ * maps. The key becomes the most recently changed of its class. */
+static void
+class_update(int index)
+{
+  uint8_t used;
+  uint8_t c;
+
+  class_unlink(index);
+  if(locked_map[index]) {
+    return;
+  }
+  /* Count how many tables are using this item */
+  for(c = 0, used = used_map[index]; used != 0; used &= used - 1) {
+    c++;
+  }
+  key_class[index] = c;
+  class_next[index] = NO_INDEX;
+  class_prev[index] = class_tail[c];
+  if(class_tail[c] == NO_INDEX) {
+    class_head[c] = index;
+  } else {
+    class_next[class_tail[c]] = index;
+  }
+  class_tail[c] = index;
+}
+#endif /* NBR_TABLE_WITH_INDEX */
 /*---------------------------------------------------------------------------*/
 /* Get the index of a neighbor from its link-layer address */
 static int
 index_from_lladdr(const linkaddr_t *lladdr)
 {
   nbr_table_key_t *key;
+#if NBR_TABLE_WITH_INDEX
+  unsigned slot;
+#endif /* NBR_TABLE_WITH_INDEX */
   /* Allow lladdr-free insertion, useful e.g. for IPv6 ND.
    * Only one such entry is possible at a time, indexed by linkaddr_null. */
   if(lladdr == NULL) {
     lladdr = &linkaddr_null;
   }
+#if NBR_TABLE_WITH_INDEX
+  if(!index_initialized) {
+    return -1;
+  }
+  for(slot = hash_lladdr(lladdr); hash_slots[slot] != NO_INDEX;
+      slot = (slot + 1) & (NBR_TABLE_INDEX_SIZE - 1)) {
+    key = key_from_index(hash_slots[slot]);
+    if(linkaddr_cmp(lladdr, &key->lladdr)) {
+      return hash_slots[slot];
+    }
+  }
+#else /* NBR_TABLE_WITH_INDEX */
   key = list_head(nbr_table_keys);
   while(key != NULL) {
     if(lladdr && linkaddr_cmp(lladdr, &key->lladdr)) {
@@ -143,6 +352,7 @@ index_from_lladdr(const linkaddr_t *lladdr)
     }
     key = list_item_next(key);
   }
+#endif /* NBR_TABLE_WITH_INDEX */
   return -1;
 }
 /*---------------------------------------------------------------------------*/
@@ -171,6 +381,9 @@ nbr_set_bit(uint8_t *bitmap, nbr_table_t *table, nbr_table_item_t *item, int val
     } else {
       bitmap[item_index] &= ~(1 << table->index);
     }
+#if NBR_TABLE_WITH_INDEX
+    class_update(item_index);
+#endif /* NBR_TABLE_WITH_INDEX */
     return 1;
   } else {
     return 0;
@@ -194,14 +407,22 @@ remove_key(nbr_table_key_t *least_used_key)
   /* Empty used map */
   used_map[index_from_key(least_used_key)] = 0;
   /* Remove neighbor from list */
+#if NBR_TABLE_WITH_INDEX
+  class_unlink(index_from_key(least_used_key));
+  hash_remove(index_from_key(least_used_key));
+  keys_remove(least_used_key);
+#else /* NBR_TABLE_WITH_INDEX */
   list_remove(nbr_table_keys, least_used_key);
+#endif /* NBR_TABLE_WITH_INDEX */
 }
 /*---------------------------------------------------------------------------*/
 static nbr_table_key_t *
 nbr_table_allocate(nbr_table_reason_t reason, void *data)
 {
   nbr_table_key_t *key;
+#if !NBR_TABLE_WITH_INDEX
   int least_used_count = 0;
+#endif /* !NBR_TABLE_WITH_INDEX */
   nbr_table_key_t *least_used_key = NULL;
 
   key = memb_alloc(&neighbor_addr_mem);
@@ -231,6 +452,19 @@ nbr_table_allocate(nbr_table_reason_t reason, void *data)
     }
 #endif /* NBR_TABLE_FIND_REMOVABLE */
 
+#if NBR_TABLE_WITH_INDEX
+    if(least_used_key == NULL) {
+      /* The head of the lowest non-empty class: the least recently
+       * changed of the unlocked keys used by fewest tables */
+      int c;
+      for(c = 0; c < NUM_CLASSES; c++) {
+        if(class_head[c] != NO_INDEX) {
+          least_used_key = key_from_index(class_head[c]);
+          break;
+        }
+      }
+    }
+#else /* NBR_TABLE_WITH_INDEX */
     if(least_used_key == NULL) {
       /* No more space, try to free a neighbor.
        * The replacement policy is the following: remove neighbor that is:
@@ -266,6 +500,7 @@ nbr_table_allocate(nbr_table_reason_t reason, void *data)
         key = list_item_next(key);
       }
     }
+#endif /* NBR_TABLE_WITH_INDEX */
 
     if(least_used_key == NULL) {
       /* We haven't found any unlocked item, allocation fails */
@@ -360,6 +595,12 @@ nbr_table_add_lladdr(nbr_table_t *table, const linkaddr_t *lladdr, nbr_table_rea
     lladdr = &linkaddr_null;
   }
 
+#if NBR_TABLE_WITH_INDEX
+  if(!index_initialized) {
+    index_init();
+  }
+#endif /* NBR_TABLE_WITH_INDEX */
+
   if((index = index_from_lladdr(lladdr)) == -1) {
      /* Neighbor not yet in table, let's try to allocate one */
     key = nbr_table_allocate(reason, data);
@@ -369,14 +610,19 @@ nbr_table_add_lladdr(nbr_table_t *table, const linkaddr_t *lladdr, nbr_table_rea
       return NULL;
     }
 
-    /* Add neighbor to list */
-    list_add(nbr_table_keys, key);
-
     /* Get index from newly allocated neighbor */
     index = index_from_key(key);
 
     /* Set link-layer address */
     linkaddr_copy(&key->lladdr, lladdr);
+
+    /* Add neighbor to list */
+#if NBR_TABLE_WITH_INDEX
+    keys_add(key);
+    hash_insert(index);
+#else /* NBR_TABLE_WITH_INDEX */
+    list_add(nbr_table_keys, key);
+#endif /* NBR_TABLE_WITH_INDEX */
   }
 
   /* Get item in the current table */
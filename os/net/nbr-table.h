@@ -46,6 +46,37 @@
 #define NBR_TABLE_MAX_NEIGHBORS 8
 #endif /* NBR_TABLE_CONF_MAX_NEIGHBORS */
 
+/* Look neighbors up in a hash index instead of scanning the table, and
+ * keep them in eviction order so that a full table is recycled in
+ * constant time. Worth it for large tables, e.g. on border routers. */
+#ifdef NBR_TABLE_CONF_WITH_INDEX
+#define NBR_TABLE_WITH_INDEX NBR_TABLE_CONF_WITH_INDEX
+#else /* NBR_TABLE_CONF_WITH_INDEX */
+#define NBR_TABLE_WITH_INDEX 0
+#endif /* NBR_TABLE_CONF_WITH_INDEX */
+
+/* Number of slots of the hash index, a power of two. By default, at
+ * least twice the number of neighbors. */
+#ifdef NBR_TABLE_CONF_INDEX_SIZE
+#define NBR_TABLE_INDEX_SIZE NBR_TABLE_CONF_INDEX_SIZE
+#elif NBR_TABLE_MAX_NEIGHBORS <= 8
+#define NBR_TABLE_INDEX_SIZE 16
+#elif NBR_TABLE_MAX_NEIGHBORS <= 16
+#define NBR_TABLE_INDEX_SIZE 32
+#elif NBR_TABLE_MAX_NEIGHBORS <= 32
+#define NBR_TABLE_INDEX_SIZE 64
+#elif NBR_TABLE_MAX_NEIGHBORS <= 64
+#define NBR_TABLE_INDEX_SIZE 128
+#elif NBR_TABLE_MAX_NEIGHBORS <= 128
+#define NBR_TABLE_INDEX_SIZE 256
+#elif NBR_TABLE_MAX_NEIGHBORS <= 256
+#define NBR_TABLE_INDEX_SIZE 512
+#elif NBR_TABLE_MAX_NEIGHBORS <= 512
+#define NBR_TABLE_INDEX_SIZE 1024
+#else
+#define NBR_TABLE_INDEX_SIZE 2048
+#endif
+
 /* An item in a neighbor table */
 typedef void nbr_table_item_t;
 
@@ -55,12 +55,43 @@ struct packetbuf_addr packetbuf_addrs[PACKETBUF_NUM_ADDRS];
 static uint16_t buflen, bufptr;
 static uint8_t hdrlen;
 
+#if PACKETBUF_WITH_DESCRIPTORS
+#include "net/queuebuf.h"
+
+#if PACKETBUF_HDR_SPACE % 4
+#error "PACKETBUF_CONF_HDR_SPACE must be a multiple of 4"
+#endif
+
+/* Every queuebuf holds at most one descriptor and the packetbuf holds
+   one more, so the pool never runs out. */
+#define PACKETBUF_DESC_NUM (QUEUEBUF_NUM + 1)
+#define PACKETBUF_DESC_BYTES (PACKETBUF_HDR_SPACE + PACKETBUF_SIZE)
+
+struct packetbuf_desc {
+  /* Aligned on a 32-bit boundary, see below */
+  uint32_t buf[(PACKETBUF_DESC_BYTES + 3) / 4];
+  /* The part of buf that queuebufs refer to */
+  uint16_t lo, hi;
+  uint8_t refs;
+};
+
+static struct packetbuf_desc descs[PACKETBUF_DESC_NUM] = {
+  { .lo = PACKETBUF_DESC_BYTES, .refs = 1 }
+};
+/* The descriptor that the packetbuf is a view onto */
+static struct packetbuf_desc *cur = &descs[0];
+/* The start of the packetbuf content, inside cur */
+static uint8_t *packetbuf = (uint8_t *)descs[0].buf + PACKETBUF_HDR_SPACE;
+
+#define DESC_PTR(d) ((uint8_t *)(d)->buf)
+#else /* PACKETBUF_WITH_DESCRIPTORS */
 /* The declarations below ensure that the packet buffer is aligned on
    an even 32-bit boundary. On some platforms (most notably the
    msp430 or OpenRISC), having a potentially misaligned packet buffer may lead to
    problems when accessing words. */
 static uint32_t packetbuf_aligned[(PACKETBUF_SIZE + 3) / 4];
 static uint8_t *packetbuf = (uint8_t *)packetbuf_aligned;
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
 
 #define DEBUG 0
 #if DEBUG
@@ -70,12 +101,114 @@ static uint8_t *packetbuf = (uint8_t *)packetbuf_aligned;
 #define PRINTF(...)
 #endif
 
+#if PACKETBUF_WITH_DESCRIPTORS
+/*---------------------------------------------------------------------------*/
+static struct packetbuf_desc *
+desc_alloc(void)
+{
+  struct packetbuf_desc *d;
+
+  for(d = descs; d < &descs[PACKETBUF_DESC_NUM]; d++) {
+    if(d->refs == 0) {
+      d->refs = 1;
+      d->lo = PACKETBUF_DESC_BYTES;
+      d->hi = 0;
+      return d;
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+/* Make sure that the packetbuf is the only user of cur, and place the
+   packetbuf content at the given offset in it. */
+static int
+own(uint16_t offset)
+{
+  struct packetbuf_desc *d = cur;
+
+  if(cur->refs > 1) {
+    d = desc_alloc();
+    if(d == NULL) {
+      /* Only possible if descriptors are leaked */
+      PRINTF("packetbuf: no free descriptor\n");
+      return 0;
+    }
+    memcpy(DESC_PTR(d) + offset, packetbuf, packetbuf_totlen());
+    cur->refs--;
+    cur = d;
+  } else {
+    memmove(DESC_PTR(d) + offset, packetbuf, packetbuf_totlen());
+    d->lo = PACKETBUF_DESC_BYTES;
+    d->hi = 0;
+  }
+  packetbuf = DESC_PTR(d) + offset;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+struct packetbuf_desc *
+packetbuf_desc_share(uint16_t *offset, uint16_t *len)
+{
+  struct packetbuf_desc *d;
+
+  if(bufptr != 0) {
+    /* Reduced headers sit between the header and the data: store a
+       compacted copy */
+    d = desc_alloc();
+    if(d != NULL) {
+      *offset = PACKETBUF_HDR_SPACE;
+      *len = packetbuf_copyto(DESC_PTR(d) + PACKETBUF_HDR_SPACE);
+    }
+    return d;
+  }
+
+  if(cur->refs == 1) {
+    cur->lo = PACKETBUF_DESC_BYTES;
+    cur->hi = 0;
+  }
+  cur->refs++;
+  *offset = packetbuf - DESC_PTR(cur);
+  *len = packetbuf_totlen();
+  cur->lo = MIN(cur->lo, *offset);
+  cur->hi = MAX(cur->hi, *offset + *len);
+  return cur;
+}
+/*---------------------------------------------------------------------------*/
+void
+packetbuf_desc_free(struct packetbuf_desc *desc)
+{
+  if(desc != NULL && desc->refs > 0) {
+    desc->refs--;
+  }
+}
+/*---------------------------------------------------------------------------*/
+uint8_t *
+packetbuf_desc_ptr(struct packetbuf_desc *desc)
+{
+  return DESC_PTR(desc);
+}
+/*---------------------------------------------------------------------------*/
+void
+packetbuf_desc_view(struct packetbuf_desc *desc, uint16_t offset,
+                    uint16_t len)
+{
+  desc->refs++;
+  cur->refs--;
+  cur = desc;
+  packetbuf = DESC_PTR(desc) + offset;
+  bufptr = 0;
+  hdrlen = 0;
+  buflen = len;
+}
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
 /*---------------------------------------------------------------------------*/
 void
 packetbuf_clear(void)
 {
   buflen = bufptr = 0;
   hdrlen = 0;
+#if PACKETBUF_WITH_DESCRIPTORS
+  own(PACKETBUF_HDR_SPACE);
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
 
   packetbuf_attr_clear();
 }
@@ -87,7 +220,12 @@ packetbuf_copyfrom(const void *from, uint16_t len)
 
   packetbuf_clear();
   l = MIN(PACKETBUF_SIZE, len);
+#if PACKETBUF_WITH_DESCRIPTORS
+  /* from may point into a descriptor, even the one we now own */
+  memmove(packetbuf, from, l);
+#else /* PACKETBUF_WITH_DESCRIPTORS */
   memcpy(packetbuf, from, l);
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
   buflen = l;
   return l;
 }
@@ -106,6 +244,26 @@ packetbuf_copyto(void *to)
 int
 packetbuf_hdralloc(int size)
 {
+#if PACKETBUF_WITH_DESCRIPTORS
+  int head;
+
+  if(size + packetbuf_totlen() > PACKETBUF_SIZE) {
+    return 0;
+  }
+
+  head = packetbuf - DESC_PTR(cur);
+  if(head < size ||
+     (cur->refs > 1 && head - size < cur->hi && head > cur->lo)) {
+    /* No room in front of the content, or the header would overwrite
+       data that a queuebuf refers to */
+    if(!own(MAX(size, PACKETBUF_HDR_SPACE))) {
+      return 0;
+    }
+  }
+  packetbuf -= size;
+  hdrlen += size;
+  return 1;
+#else /* PACKETBUF_WITH_DESCRIPTORS */
   int16_t i;
 
   if(size + packetbuf_totlen() > PACKETBUF_SIZE) {
@@ -118,6 +276,7 @@ packetbuf_hdralloc(int size)
   }
   hdrlen += size;
   return 1;
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
 }
 /*---------------------------------------------------------------------------*/
 int
@@ -136,6 +295,12 @@ void
 packetbuf_set_datalen(uint16_t len)
 {
   PRINTF("packetbuf_set_len: len %d\n", len);
+#if PACKETBUF_WITH_DESCRIPTORS
+  if(cur->refs > 1 && len != buflen) {
+    /* The data is about to change */
+    own(packetbuf - DESC_PTR(cur));
+  }
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
   buflen = len;
 }
 /*---------------------------------------------------------------------------*/
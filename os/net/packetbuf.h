@@ -67,6 +67,33 @@
 #define PACKETBUF_SIZE 128
 #endif
 
+/**
+ * \brief      Keep the packetbuf content in reference-counted descriptors
+ *
+ *             When enabled, the packetbuf is a view onto one of a pool
+ *             of packet descriptors, and queuebufs take a reference on
+ *             the descriptor instead of copying the packet. This lets a
+ *             MAC layer queue a packet and build the frame for each
+ *             transmission attempt without copying the payload.
+ */
+#ifdef PACKETBUF_CONF_WITH_DESCRIPTORS
+#define PACKETBUF_WITH_DESCRIPTORS PACKETBUF_CONF_WITH_DESCRIPTORS
+#else
+#define PACKETBUF_WITH_DESCRIPTORS 0
+#endif
+
+/**
+ * \brief      The space reserved in front of the packet in a descriptor
+ *
+ *             Headers of up to this size are added with
+ *             packetbuf_hdralloc() without moving the packet.
+ */
+#ifdef PACKETBUF_CONF_HDR_SPACE
+#define PACKETBUF_HDR_SPACE PACKETBUF_CONF_HDR_SPACE
+#else
+#define PACKETBUF_HDR_SPACE 32
+#endif
+
 /**
  * \brief      Clear and reset the packetbuf
  *
@@ -192,6 +219,53 @@ int packetbuf_hdralloc(int size);
  */
 int packetbuf_hdrreduce(int size);
 
+#if PACKETBUF_WITH_DESCRIPTORS
+struct packetbuf_desc;
+
+/**
+ * \brief        Take a reference on the packet in the packetbuf
+ * \param offset Set to the offset of the packet in the descriptor
+ * \param len    Set to the length of the packet, header included
+ * \return       The descriptor holding the packet, or NULL
+ *
+ *               The header and the data of the packetbuf are shared
+ *               with the caller when they are contiguous, and copied
+ *               to a new descriptor otherwise. The reference is
+ *               dropped with packetbuf_desc_free().
+ */
+struct packetbuf_desc *packetbuf_desc_share(uint16_t *offset, uint16_t *len);
+
+/**
+ * \brief      Drop a reference taken with packetbuf_desc_share()
+ * \param desc The descriptor
+ */
+void packetbuf_desc_free(struct packetbuf_desc *desc);
+
+/**
+ * \brief      Get a pointer to the start of a descriptor's buffer
+ * \param desc The descriptor
+ * \return     A pointer to which the offsets of the descriptor apply
+ */
+uint8_t *packetbuf_desc_ptr(struct packetbuf_desc *desc);
+
+/**
+ * \brief        Make the packetbuf a view onto a shared packet
+ * \param desc   The descriptor holding the packet
+ * \param offset The offset of the packet in the descriptor
+ * \param len    The length of the packet
+ *
+ *               The packet becomes the data of the packetbuf. A
+ *               header may be put in front of it with
+ *               packetbuf_hdralloc(), which copies the packet first if
+ *               the header would overwrite data that is still shared.
+ *               The packet itself must not be modified in place; the
+ *               next packetbuf_clear() or packetbuf_copyfrom() gives
+ *               the packetbuf a descriptor of its own.
+ */
+void packetbuf_desc_view(struct packetbuf_desc *desc, uint16_t offset,
+                         uint16_t len);
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
+
 /* Packet attributes stuff below: */
 
 typedef uint16_t packetbuf_attr_t;
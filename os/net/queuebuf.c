@@ -50,6 +50,30 @@
 #endif
 
 #include <string.h> /* for memcpy() */
+#include <stddef.h> /* for offsetof() */
+
+#if PACKETBUF_WITH_DESCRIPTORS
+#if WITH_SWAP
+#error "PACKETBUF_CONF_WITH_DESCRIPTORS cannot be used with QUEUEBUFRAM_CONF_NUM"
+#endif
+#if MAC_CONF_WITH_TSCH
+/* TSCH updates queued frames in place */
+#error "PACKETBUF_CONF_WITH_DESCRIPTORS cannot be used with TSCH"
+#endif
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
+
+#if QUEUEBUF_WITH_SIZE_CLASSES
+#if WITH_SWAP
+#error "QUEUEBUF_CONF_WITH_SIZE_CLASSES cannot be used with QUEUEBUFRAM_CONF_NUM"
+#endif
+#if PACKETBUF_WITH_DESCRIPTORS
+#error "QUEUEBUF_CONF_WITH_SIZE_CLASSES cannot be used with PACKETBUF_CONF_WITH_DESCRIPTORS"
+#endif
+#if MAC_CONF_WITH_TSCH && LLSEC802154_ENABLED
+/* TSCH appends the MIC to queued frames in place, past the stored length */
+#error "QUEUEBUF_CONF_WITH_SIZE_CLASSES cannot be used with TSCH and LLSEC802154"
+#endif
+#endif /* QUEUEBUF_WITH_SIZE_CLASSES */
 
 /* Structure pointing to a buffer either stored
    in RAM or swapped in CFS */
@@ -73,14 +97,51 @@ struct queuebuf {
 
 /* The actual queuebuf data */
 struct queuebuf_data {
+#if PACKETBUF_WITH_DESCRIPTORS
+  struct packetbuf_desc *desc;
+  uint16_t offset;
+#elif !QUEUEBUF_WITH_SIZE_CLASSES
   uint8_t data[PACKETBUF_SIZE];
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
   uint16_t len;
   struct packetbuf_attr attrs[PACKETBUF_NUM_ATTRS];
   struct packetbuf_addr addrs[PACKETBUF_NUM_ADDRS];
 };
 
 MEMB(bufmem, struct queuebuf, QUEUEBUF_NUM);
+
+#if QUEUEBUF_WITH_SIZE_CLASSES
+/* The queuebuf data followed by a word-aligned buffer, in three sizes */
+struct small_buf {
+  struct queuebuf_data hdr;
+  uint32_t data[(QUEUEBUF_SMALL_SIZE + 3) / 4];
+};
+struct medium_buf {
+  struct queuebuf_data hdr;
+  uint32_t data[(QUEUEBUF_MEDIUM_SIZE + 3) / 4];
+};
+struct large_buf {
+  struct queuebuf_data hdr;
+  uint32_t data[(PACKETBUF_SIZE + 3) / 4];
+};
+
+MEMB(small_mem, struct small_buf, QUEUEBUF_SMALL_NUM);
+MEMB(medium_mem, struct medium_buf, QUEUEBUF_MEDIUM_NUM);
+MEMB(large_mem, struct large_buf, QUEUEBUF_LARGE_NUM);
+
+/* From the smallest class to the largest */
+static struct memb *const size_classes[] = {
+  &small_mem, &medium_mem, &large_mem
+};
+#define NUM_SIZE_CLASSES (sizeof(size_classes) / sizeof(size_classes[0]))
+
+/* The buffer is at the same offset in every class */
+#define DATA_OFFSET offsetof(struct large_buf, data)
+#define QBUF_DATA(b) ((uint8_t *)(b) + DATA_OFFSET)
+#else /* QUEUEBUF_WITH_SIZE_CLASSES */
 MEMB(buframmem, struct queuebuf_data, QUEUEBUFRAM_NUM);
+#define QBUF_DATA(b) ((b)->data)
+#endif /* QUEUEBUF_WITH_SIZE_CLASSES */
 
 #if WITH_SWAP
 
@@ -135,6 +196,50 @@ LIST(queuebuf_list);
 uint8_t queuebuf_len, queuebuf_max_len;
 #endif /* QUEUEBUF_STATS */
 
+#if QUEUEBUF_WITH_SIZE_CLASSES
+/*---------------------------------------------------------------------------*/
+/* Allocates from the smallest class that fits len bytes of data and
+   has a free buffer */
+static struct queuebuf_data *
+data_alloc(uint16_t len)
+{
+  struct queuebuf_data *d;
+  unsigned i;
+
+  for(i = 0; i < NUM_SIZE_CLASSES; i++) {
+    if(size_classes[i]->size - DATA_OFFSET >= len) {
+      d = memb_alloc(size_classes[i]);
+      if(d != NULL) {
+        return d;
+      }
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static struct memb *
+data_class(struct queuebuf_data *d)
+{
+  unsigned i;
+
+  for(i = 0; i < NUM_SIZE_CLASSES; i++) {
+    if(memb_inmemb(size_classes[i], d)) {
+      return size_classes[i];
+    }
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static void
+data_free(struct queuebuf_data *d)
+{
+  struct memb *m = data_class(d);
+
+  if(m != NULL) {
+    memb_free(m, d);
+  }
+}
+#endif /* QUEUEBUF_WITH_SIZE_CLASSES */
 #if WITH_SWAP
 /*---------------------------------------------------------------------------*/
 static void
@@ -287,7 +392,16 @@ queuebuf_init(void)
     qbuf_renew_file(i);
   }
 #endif
+#if QUEUEBUF_WITH_SIZE_CLASSES
+  {
+    unsigned i;
+    for(i = 0; i < NUM_SIZE_CLASSES; i++) {
+      memb_init(size_classes[i]);
+    }
+  }
+#else /* QUEUEBUF_WITH_SIZE_CLASSES */
   memb_init(&buframmem);
+#endif /* QUEUEBUF_WITH_SIZE_CLASSES */
   memb_init(&bufmem);
 #if QUEUEBUF_STATS
   queuebuf_max_len = 0;
@@ -319,7 +433,11 @@ queuebuf_new_from_packetbuf(void)
     buf->line = line;
     buf->time = clock_time();
 #endif /* QUEUEBUF_DEBUG */
+#if QUEUEBUF_WITH_SIZE_CLASSES
+    buf->ram_ptr = data_alloc(packetbuf_totlen());
+#else /* QUEUEBUF_WITH_SIZE_CLASSES */
     buf->ram_ptr = memb_alloc(&buframmem);
+#endif /* QUEUEBUF_WITH_SIZE_CLASSES */
 #if WITH_SWAP
     /* If the allocation failed, store the qbuf in swap files */
     if(buf->ram_ptr != NULL) {
@@ -340,7 +458,17 @@ queuebuf_new_from_packetbuf(void)
     buframptr = buf->ram_ptr;
 #endif
 
-    buframptr->len = packetbuf_copyto(buframptr->data);
+#if PACKETBUF_WITH_DESCRIPTORS
+    buframptr->desc = packetbuf_desc_share(&buframptr->offset,
+                                           &buframptr->len);
+    if(buframptr->desc == NULL) {
+      memb_free(&buframmem, buframptr);
+      memb_free(&bufmem, buf);
+      return NULL;
+    }
+#else /* PACKETBUF_WITH_DESCRIPTORS */
+    buframptr->len = packetbuf_copyto(QBUF_DATA(buframptr));
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
     packetbuf_attr_copyto(buframptr->attrs, buframptr->addrs);
 
 #if WITH_SWAP
@@ -383,8 +511,37 @@ void
 queuebuf_update_from_packetbuf(struct queuebuf *buf)
 {
   struct queuebuf_data *buframptr = queuebuf_load_to_ram(buf);
+#if QUEUEBUF_WITH_SIZE_CLASSES
+  if(data_class(buframptr)->size - DATA_OFFSET < packetbuf_totlen()) {
+    /* Move to a larger class. If there is no room, the queuebuf is
+       left unchanged. */
+    struct queuebuf_data *d = data_alloc(packetbuf_totlen());
+    if(d == NULL) {
+      PRINTF("queuebuf_update_from_packetbuf: could not allocate %u bytes\n",
+             packetbuf_totlen());
+      return;
+    }
+    data_free(buframptr);
+    buf->ram_ptr = buframptr = d;
+  }
+#endif /* QUEUEBUF_WITH_SIZE_CLASSES */
   packetbuf_attr_copyto(buframptr->attrs, buframptr->addrs);
-  buframptr->len = packetbuf_copyto(buframptr->data);
+#if PACKETBUF_WITH_DESCRIPTORS
+  {
+    struct packetbuf_desc *desc;
+    uint16_t offset, len;
+
+    desc = packetbuf_desc_share(&offset, &len);
+    if(desc != NULL) {
+      packetbuf_desc_free(buframptr->desc);
+      buframptr->desc = desc;
+      buframptr->offset = offset;
+      buframptr->len = len;
+    }
+  }
+#else /* PACKETBUF_WITH_DESCRIPTORS */
+  buframptr->len = packetbuf_copyto(QBUF_DATA(buframptr));
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
 #if WITH_SWAP
   if(buf->location == IN_CFS) {
     queuebuf_flush_tmpdata();
@@ -403,7 +560,14 @@ queuebuf_free(struct queuebuf *buf)
       queuebuf_remove_from_file(buf->swap_id);
     }
 #else
+#if PACKETBUF_WITH_DESCRIPTORS
+    packetbuf_desc_free(buf->ram_ptr->desc);
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
+#if QUEUEBUF_WITH_SIZE_CLASSES
+    data_free(buf->ram_ptr);
+#else /* QUEUEBUF_WITH_SIZE_CLASSES */
     memb_free(&buframmem, buf->ram_ptr);
+#endif /* QUEUEBUF_WITH_SIZE_CLASSES */
 #endif
     memb_free(&bufmem, buf);
 #if QUEUEBUF_STATS
@@ -421,9 +585,28 @@ queuebuf_to_packetbuf(struct queuebuf *b)
 {
   if(memb_inmemb(&bufmem, b)) {
     struct queuebuf_data *buframptr = queuebuf_load_to_ram(b);
-    packetbuf_copyfrom(buframptr->data, buframptr->len);
+#if PACKETBUF_WITH_DESCRIPTORS
+    packetbuf_copyfrom(packetbuf_desc_ptr(buframptr->desc) + buframptr->offset,
+                       buframptr->len);
+#else /* PACKETBUF_WITH_DESCRIPTORS */
+    packetbuf_copyfrom(QBUF_DATA(buframptr), buframptr->len);
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
+    packetbuf_attr_copyfrom(buframptr->attrs, buframptr->addrs);
+  }
+}
+/*---------------------------------------------------------------------------*/
+void
+queuebuf_to_packetbuf_view(struct queuebuf *b)
+{
+#if PACKETBUF_WITH_DESCRIPTORS
+  if(memb_inmemb(&bufmem, b)) {
+    struct queuebuf_data *buframptr = b->ram_ptr;
+    packetbuf_desc_view(buframptr->desc, buframptr->offset, buframptr->len);
     packetbuf_attr_copyfrom(buframptr->attrs, buframptr->addrs);
   }
+#else /* PACKETBUF_WITH_DESCRIPTORS */
+  queuebuf_to_packetbuf(b);
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
 }
 /*---------------------------------------------------------------------------*/
 void *
@@ -431,7 +614,11 @@ queuebuf_dataptr(struct queuebuf *b)
 {
   if(memb_inmemb(&bufmem, b)) {
     struct queuebuf_data *buframptr = queuebuf_load_to_ram(b);
-    return buframptr->data;
+#if PACKETBUF_WITH_DESCRIPTORS
+    return packetbuf_desc_ptr(buframptr->desc) + buframptr->offset;
+#else /* PACKETBUF_WITH_DESCRIPTORS */
+    return QBUF_DATA(buframptr);
+#endif /* PACKETBUF_WITH_DESCRIPTORS */
   }
   return NULL;
 }
@@ -85,6 +85,56 @@
   #define WITH_SWAP 0
 #endif /* QUEUEBUFRAM_CONF_NUM */
 
+/* With QUEUEBUF_CONF_WITH_SIZE_CLASSES, a queuebuf is stored in the
+   smallest of three size classes that fits its data, instead of in a
+   buffer of PACKETBUF_SIZE bytes. QUEUEBUF_NUM is then the number of
+   queuebuf handles, and the number of buffers in each class is set
+   separately. Size classes cannot be used with TSCH and link-layer
+   security, as TSCH writes the MIC into queued frames in place. */
+#ifdef QUEUEBUF_CONF_WITH_SIZE_CLASSES
+#define QUEUEBUF_WITH_SIZE_CLASSES QUEUEBUF_CONF_WITH_SIZE_CLASSES
+#else /* QUEUEBUF_CONF_WITH_SIZE_CLASSES */
+#define QUEUEBUF_WITH_SIZE_CLASSES 0
+#endif /* QUEUEBUF_CONF_WITH_SIZE_CLASSES */
+
+#if QUEUEBUF_WITH_SIZE_CLASSES
+/* Small buffers: data frames with a short payload, EBs, neighbor
+   discovery */
+#ifdef QUEUEBUF_CONF_SMALL_SIZE
+#define QUEUEBUF_SMALL_SIZE QUEUEBUF_CONF_SMALL_SIZE
+#else
+#define QUEUEBUF_SMALL_SIZE 48
+#endif
+#ifdef QUEUEBUF_CONF_SMALL_NUM
+#define QUEUEBUF_SMALL_NUM QUEUEBUF_CONF_SMALL_NUM
+#else
+#define QUEUEBUF_SMALL_NUM (QUEUEBUF_NUM / 2)
+#endif
+
+/* Medium buffers: routing messages */
+#ifdef QUEUEBUF_CONF_MEDIUM_SIZE
+#define QUEUEBUF_MEDIUM_SIZE QUEUEBUF_CONF_MEDIUM_SIZE
+#else
+#define QUEUEBUF_MEDIUM_SIZE 96
+#endif
+#ifdef QUEUEBUF_CONF_MEDIUM_NUM
+#define QUEUEBUF_MEDIUM_NUM QUEUEBUF_CONF_MEDIUM_NUM
+#else
+#define QUEUEBUF_MEDIUM_NUM (QUEUEBUF_NUM / 4)
+#endif
+
+/* Large buffers, of PACKETBUF_SIZE bytes: fragments */
+#ifdef QUEUEBUF_CONF_LARGE_NUM
+#define QUEUEBUF_LARGE_NUM QUEUEBUF_CONF_LARGE_NUM
+#else
+#define QUEUEBUF_LARGE_NUM (QUEUEBUF_NUM / 4)
+#endif
+
+#if QUEUEBUF_SMALL_NUM < 1 || QUEUEBUF_MEDIUM_NUM < 1 || QUEUEBUF_LARGE_NUM < 1
+#error "Every queuebuf size class needs at least one buffer"
+#endif
+#endif /* QUEUEBUF_WITH_SIZE_CLASSES */
+
 #ifdef QUEUEBUF_CONF_DEBUG
 #define QUEUEBUF_DEBUG QUEUEBUF_CONF_DEBUG
 #else /* QUEUEBUF_CONF_DEBUG */
@@ -105,6 +155,15 @@ void queuebuf_update_attr_from_packetbuf(struct queuebuf *b);
 void queuebuf_update_from_packetbuf(struct queuebuf *b);
 
 void queuebuf_to_packetbuf(struct queuebuf *b);
+/**
+ * \brief      Restore a queuebuf to the packetbuf without copying it
+ *
+ *             With PACKETBUF_CONF_WITH_DESCRIPTORS, the packetbuf
+ *             becomes a view onto the queued packet (see
+ *             packetbuf_desc_view()), to which only a header may be
+ *             added. Otherwise this is queuebuf_to_packetbuf().
+ */
+void queuebuf_to_packetbuf_view(struct queuebuf *b);
 void queuebuf_free(struct queuebuf *b);
 
 void *queuebuf_dataptr(struct queuebuf *b);
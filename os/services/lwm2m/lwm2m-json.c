@@ -44,6 +44,7 @@
 #include "lwm2m-object.h"
 #include "lwm2m-json.h"
 #include "lwm2m-plain-text.h"
+#include "lib/json/jsonwriter.h"
 #include <stdio.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -192,135 +193,103 @@ exit_sub(lwm2m_context_t *ctx)
   return 0;
 }
 /*---------------------------------------------------------------------------*/
+/* Starts an entry: the separator, then {"n":"<path>" */
 static size_t
-write_boolean(lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
-              int value)
+begin_entry(lwm2m_context_t *ctx, struct jsonwriter *w,
+            uint8_t *outbuf, size_t outlen)
 {
-  char *sep = (ctx->writer_flags & WRITER_OUTPUT_VALUE) ? "," : "";
-  int len;
+  char path[12];
+  size_t sep = 0;
+
+  if((ctx->writer_flags & WRITER_OUTPUT_VALUE) && outlen > 0) {
+    outbuf[0] = ',';
+    sep = 1;
+  }
+  jsonwriter_init(w, (char *)outbuf + sep, MIN(outlen - sep, UINT16_MAX));
+  jsonwriter_object_begin(w);
+  jsonwriter_name(w, "n");
   if(ctx->writer_flags & WRITER_RESOURCE_INSTANCE) {
-    len = snprintf((char *)outbuf, outlen, "%s{\"n\":\"%u/%u\",\"bv\":%s}", sep, ctx->resource_id, ctx->resource_instance_id, value ? "true" : "false");
+    snprintf(path, sizeof(path), "%u/%u", ctx->resource_id,
+             ctx->resource_instance_id);
   } else {
-    len = snprintf((char *)outbuf, outlen, "%s{\"n\":\"%u\",\"bv\":%s}", sep, ctx->resource_id, value ? "true" : "false");
+    snprintf(path, sizeof(path), "%u", ctx->resource_id);
   }
-  if((len < 0) || (len >= outlen)) {
+  jsonwriter_string(w, path);
+  return sep;
+}
+/*---------------------------------------------------------------------------*/
+/* Closes the entry and returns its length, or 0 if it did not fit */
+static size_t
+end_entry(lwm2m_context_t *ctx, struct jsonwriter *w, size_t sep)
+{
+  jsonwriter_object_end(w);
+  if(jsonwriter_overflow(w)) {
     return 0;
   }
-  LOG_DBG("JSON: Write bool:%s\n", outbuf);
-
   ctx->writer_flags |= WRITER_OUTPUT_VALUE;
-  return len;
+  return sep + jsonwriter_len(w);
+}
+/*---------------------------------------------------------------------------*/
+static size_t
+write_boolean(lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
+              int value)
+{
+  struct jsonwriter w;
+  size_t sep;
+
+  sep = begin_entry(ctx, &w, outbuf, outlen);
+  jsonwriter_name(&w, "bv");
+  jsonwriter_bool(&w, value);
+  LOG_DBG("JSON: Write bool:%s\n", outbuf);
+  return end_entry(ctx, &w, sep);
 }
 /*---------------------------------------------------------------------------*/
 static size_t
 write_int(lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
           int32_t value)
 {
-  char *sep = (ctx->writer_flags & WRITER_OUTPUT_VALUE) ? "," : "";
-  int len;
-  if(ctx->writer_flags & WRITER_RESOURCE_INSTANCE) {
-    len = snprintf((char *)outbuf, outlen, "%s{\"n\":\"%u/%u\",\"v\":%"PRId32"}", sep, ctx->resource_id, ctx->resource_instance_id, value);
-  } else {
-    len = snprintf((char *)outbuf, outlen, "%s{\"n\":\"%u\",\"v\":%"PRId32"}", sep, ctx->resource_id, value);
-  }
-  if((len < 0) || (len >= outlen)) {
-    return 0;
-  }
-  LOG_DBG("Write int:%s\n", outbuf);
+  struct jsonwriter w;
+  size_t sep;
 
-  ctx->writer_flags |= WRITER_OUTPUT_VALUE;
-  return len;
+  sep = begin_entry(ctx, &w, outbuf, outlen);
+  jsonwriter_name(&w, "v");
+  jsonwriter_int(&w, value);
+  LOG_DBG("Write int:%s\n", outbuf);
+  return end_entry(ctx, &w, sep);
 }
 /*---------------------------------------------------------------------------*/
 static size_t
 write_float32fix(lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
                  int32_t value, int bits)
 {
-  char *sep = (ctx->writer_flags & WRITER_OUTPUT_VALUE) ? "," : "";
-  size_t len = 0;
-  int res;
-  if(ctx->writer_flags & WRITER_RESOURCE_INSTANCE) {
-    res = snprintf((char *)outbuf, outlen, "%s{\"n\":\"%u/%u\",\"v\":", sep, ctx->resource_id, ctx->resource_instance_id);
-  } else {
-    res = snprintf((char *)outbuf, outlen, "%s{\"n\":\"%u\",\"v\":", sep, ctx->resource_id);
-  }
-  if(res <= 0 || res >= outlen) {
-    return 0;
-  }
-  len += res;
-  outlen -= res;
-  res = lwm2m_plain_text_write_float32fix(&outbuf[len], outlen, value, bits);
-  if((res <= 0) || (res >= outlen)) {
-    return 0;
-  }
-  len += res;
-  outlen -= res;
-  res = snprintf((char *)&outbuf[len], outlen, "}");
-  if((res <= 0) || (res >= outlen)) {
+  struct jsonwriter w;
+  uint8_t number[24];
+  size_t sep;
+  size_t len;
+
+  len = lwm2m_plain_text_write_float32fix(number, sizeof(number), value, bits);
+  if(len == 0) {
     return 0;
   }
-  len += res;
-  ctx->writer_flags |= WRITER_OUTPUT_VALUE;
-  return len;
+  sep = begin_entry(ctx, &w, outbuf, outlen);
+  jsonwriter_name(&w, "v");
+  jsonwriter_raw(&w, (const char *)number, len);
+  return end_entry(ctx, &w, sep);
 }
 /*---------------------------------------------------------------------------*/
 static size_t
 write_string(lwm2m_context_t *ctx, uint8_t *outbuf, size_t outlen,
              const char *value, size_t stringlen)
 {
-  char *sep = (ctx->writer_flags & WRITER_OUTPUT_VALUE) ? "," : "";
-  size_t i;
-  size_t len = 0;
-  int res;
-  LOG_DBG("{\"n\":\"%u\",\"sv\":\"", ctx->resource_id);
-  if(ctx->writer_flags & WRITER_RESOURCE_INSTANCE) {
-    res = snprintf((char *)outbuf, outlen, "%s{\"n\":\"%u/%u\",\"sv\":\"", sep,
-                   ctx->resource_id, ctx->resource_instance_id);
-  } else {
-    res = snprintf((char *)outbuf, outlen, "%s{\"n\":\"%u\",\"sv\":\"", sep,
-                   ctx->resource_id);
-  }
-  if(res < 0 || res >= outlen) {
-    return 0;
-  }
-  len += res;
-  for (i = 0; i < stringlen && len < outlen; ++i) {
-    /* Escape special characters */
-    /* TODO: Handle UTF-8 strings */
-    if(value[i] < '\x20') {
-      LOG_DBG_("\\x%x", value[i]);
-      res = snprintf((char *)&outbuf[len], outlen - len, "\\x%x", value[i]);
-      if((res < 0) || (res >= (outlen - len))) {
-        return 0;
-      }
-      len += res;
-      continue;
-    } else if(value[i] == '"' || value[i] == '\\') {
-      LOG_DBG_("\\");
-      outbuf[len] = '\\';
-      ++len;
-      if(len >= outlen) {
-        return 0;
-      }
-    }
-    LOG_DBG_("%c", value[i]);
-    outbuf[len] = value[i];
-    ++len;
-    if(len >= outlen) {
-      return 0;
-    }
-  }
-  LOG_DBG_("\"}\n");
-  res = snprintf((char *)&outbuf[len], outlen - len, "\"}");
-  if((res < 0) || (res >= (outlen - len))) {
-    return 0;
-  }
+  struct jsonwriter w;
+  size_t sep;
 
+  sep = begin_entry(ctx, &w, outbuf, outlen);
+  jsonwriter_name(&w, "sv");
+  /* TODO: Handle UTF-8 strings */
+  jsonwriter_string_len(&w, value, MIN(stringlen, UINT16_MAX));
   LOG_DBG("JSON: Write string:%s\n", outbuf);
-
-  len += res;
-  ctx->writer_flags |= WRITER_OUTPUT_VALUE;
-  return len;
+  return end_entry(ctx, &w, sep);
 }
 /*---------------------------------------------------------------------------*/
 const lwm2m_writer_t lwm2m_json_writer = {
@@ -46,6 +46,7 @@
 #include "shell.h"
 #include "shell-commands.h"
 #include "lib/list.h"
+#include "lib/memb.h"
 #include "sys/log.h"
 #include "dev/watchdog.h"
 #if NETSTACK_CONF_WITH_IPV6
@@ -389,6 +390,117 @@ PT_THREAD(cmd_ps(struct pt *pt, shell_output_func output, char *args))
 
     PT_END(pt);
 }
+#if PROCESS_CONF_PROFILE
+/*---------------------------------------------------------------------------*/
+static void
+shell_output_histogram(shell_output_func output, const char *label,
+                       const struct process_histogram *h)
+{
+  char line[16 + 7 * PROCESS_PROFILE_BUCKETS];
+  int len;
+  int i;
+
+  len = snprintf(line, sizeof(line), "   %-8s", label);
+  for(i = 0; i < PROCESS_PROFILE_BUCKETS && len < sizeof(line); i++) {
+    len += snprintf(line + len, sizeof(line) - len, " %6u", h->count[i]);
+  }
+  SHELL_OUTPUT(output, "%s\n", line);
+}
+/*---------------------------------------------------------------------------*/
+static void
+shell_output_buckets(shell_output_func output)
+{
+  char line[16 + 7 * PROCESS_PROFILE_BUCKETS];
+  char bound[16];
+  int len;
+  int i;
+
+  len = snprintf(line, sizeof(line), "   %-8s", "ticks");
+  for(i = 0; i < PROCESS_PROFILE_BUCKETS && len < sizeof(line); i++) {
+    if(i == PROCESS_PROFILE_BUCKETS - 1) {
+      snprintf(bound, sizeof(bound), ">=%lu", 1UL << (i - 1));
+    } else {
+      snprintf(bound, sizeof(bound), "<%lu", 1UL << i);
+    }
+    len += snprintf(line + len, sizeof(line) - len, " %6s", bound);
+  }
+  SHELL_OUTPUT(output, "%s\n", line);
+}
+/*---------------------------------------------------------------------------*/
+static
+PT_THREAD(cmd_proc_prof(struct pt *pt, shell_output_func output, char *args))
+{
+  struct process *p;
+  char *next_args;
+
+  PT_BEGIN(pt);
+
+  SHELL_ARGS_INIT(args, next_args);
+
+  /* Get and parse argument: reset */
+  SHELL_ARGS_NEXT(args, next_args);
+  if(args != NULL) {
+    if(strcmp(args, "reset")) {
+      SHELL_OUTPUT(output, "Invalid argument: %s\n", args);
+    } else {
+      process_profile_reset();
+      SHELL_OUTPUT(output, "Process profile cleared\n");
+    }
+    PT_EXIT(pt);
+  }
+
+  SHELL_OUTPUT(output, "Process profile (%lu rtimer ticks per second):\n",
+               (unsigned long)RTIMER_SECOND);
+  shell_output_buckets(output);
+  for(p = PROCESS_LIST(); p != NULL; p = p->next) {
+    SHELL_OUTPUT(output, "-- %s: %lu calls, run %lu total %lu max, latency %lu max\n",
+                 PROCESS_NAME_STRING(p),
+                 (unsigned long)p->profile.calls,
+                 (unsigned long)p->profile.total,
+                 (unsigned long)p->profile.run.max,
+                 (unsigned long)p->profile.latency.max);
+    shell_output_histogram(output, "run", &p->profile.run);
+    shell_output_histogram(output, "latency", &p->profile.latency);
+  }
+
+  PT_END(pt);
+}
+#endif /* PROCESS_CONF_PROFILE */
+#if MEMB_STATS
+/*---------------------------------------------------------------------------*/
+static
+PT_THREAD(cmd_memb_stats(struct pt *pt, shell_output_func output, char *args))
+{
+  struct memb *m;
+  char *next_args;
+
+  PT_BEGIN(pt);
+
+  SHELL_ARGS_INIT(args, next_args);
+
+  /* Get and parse argument: reset */
+  SHELL_ARGS_NEXT(args, next_args);
+  if(args != NULL) {
+    if(strcmp(args, "reset")) {
+      SHELL_OUTPUT(output, "Invalid argument: %s\n", args);
+    } else {
+      memb_stats_reset();
+      SHELL_OUTPUT(output, "Memory pool statistics cleared\n");
+    }
+    PT_EXIT(pt);
+  }
+
+  SHELL_OUTPUT(output, "Memory pools:\n");
+  SHELL_OUTPUT(output, "%-24s %5s %5s %5s %5s %8s\n",
+               "name", "size", "num", "used", "peak", "failures");
+  for(m = memb_stats_head(); m != NULL; m = m->next) {
+    SHELL_OUTPUT(output, "%-24s %5u %5u %5u %5u %8u\n", m->name,
+                 m->size, m->num, m->used, m->high_watermark, m->failures);
+  }
+
+  PT_END(pt);
+}
+#endif /* MEMB_STATS */
 #if UIP_CONF_IPV6_RPL
 /*---------------------------------------------------------------------------*/
 static
@@ -885,6 +997,12 @@ const struct shell_command_t builtin_shell_commands[] = {
   { "reboot",               cmd_reboot,               "'> reboot': Reboot the board by watchdog_reboot()" },
   { "log",                  cmd_log,                  "'> log module level': Sets log level (0--4) for a given module (or \"all\"). For module \"mac\", level 4 also enables per-slot logging." },
   { "ps",                   cmd_ps,                   "'> ps': list all running processes" },
+#if PROCESS_CONF_PROFILE
+  { "proc-prof",            cmd_proc_prof,            "'> proc-prof [reset]': Shows the run time and event latency histograms of each process, or clears them" },
+#endif /* PROCESS_CONF_PROFILE */
+#if MEMB_STATS
+  { "memb-stats",           cmd_memb_stats,           "'> memb-stats [reset]': Shows the usage, high watermark and allocation failures of each memory pool, or clears them" },
+#endif /* MEMB_STATS */
 #if NETSTACK_CONF_WITH_IPV6
   { "ip-addr",              cmd_ipaddr,               "'> ip-addr': Shows all IPv6 addresses" },
   { "ip-nbr",               cmd_ip_neighbors,         "'> ip-nbr': Shows all IPv6 neighbors" },
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \addtogroup cfs
+ * @{
+ */
+
+/**
+ * \file
+ *         Asynchronous CFS I/O on Coffee. A system process serves the
+ *         queued operations in chunks and does the incremental file
+ *         system maintenance when there is nothing else to do.
+ */
+
+#include "contiki.h"
+#include "lib/list.h"
+#include "cfs/cfs-async.h"
+#include "cfs/cfs-coffee.h"
+
+process_event_t cfs_async_event;
+
+LIST(queue);
+static uint8_t maintain;
+
+PROCESS(cfs_async_process, "CFS async");
+/*---------------------------------------------------------------------------*/
+static void
+start(void)
+{
+  if(!process_is_running(&cfs_async_process)) {
+    cfs_async_event = process_alloc_event();
+    process_start(&cfs_async_process, NULL);
+  }
+  process_poll(&cfs_async_process);
+}
+/*---------------------------------------------------------------------------*/
+static int
+enqueue(struct cfs_async_op *op, uint8_t type, int fd, void *buf,
+        unsigned len)
+{
+  if(PROCESS_CURRENT() == NULL || list_contains(queue, op)) {
+    return -1;
+  }
+
+  op->process = PROCESS_CURRENT();
+  op->type = type;
+  op->fd = fd;
+  op->buf = buf;
+  op->len = len;
+  op->done = 0;
+  op->result = 0;
+
+  start();
+  list_add(queue, op);
+  if(type == CFS_ASYNC_WRITE) {
+    maintain = 1;
+  }
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+int
+cfs_async_read(struct cfs_async_op *op, int fd, void *buf, unsigned len)
+{
+  return enqueue(op, CFS_ASYNC_READ, fd, buf, len);
+}
+/*---------------------------------------------------------------------------*/
+int
+cfs_async_write(struct cfs_async_op *op, int fd, const void *buf,
+                unsigned len)
+{
+  return enqueue(op, CFS_ASYNC_WRITE, fd, (void *)buf, len);
+}
+/*---------------------------------------------------------------------------*/
+void
+cfs_async_maintain(void)
+{
+  maintain = 1;
+  start();
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Transfer one chunk. A failed or short transfer ends the operation
+ * by cutting its length down to what has been done.
+ */
+static void
+transfer(struct cfs_async_op *op)
+{
+  unsigned n;
+  int r;
+
+  n = op->len - op->done;
+  if(n > CFS_ASYNC_CHUNK_SIZE) {
+    n = CFS_ASYNC_CHUNK_SIZE;
+  }
+
+  if(op->type == CFS_ASYNC_READ) {
+    r = cfs_read(op->fd, (char *)op->buf + op->done, n);
+  } else {
+    r = cfs_write(op->fd, (char *)op->buf + op->done, n);
+  }
+
+  if(r < 0) {
+    op->len = op->done;
+    if(op->done == 0) {
+      op->result = -1;
+    }
+    return;
+  }
+
+  op->done += r;
+  op->result = op->done;
+  if((unsigned)r < n) {
+    op->len = op->done;
+  }
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(cfs_async_process, ev, data)
+{
+  struct cfs_async_op *op;
+
+  PROCESS_BEGIN();
+
+  while(1) {
+    PROCESS_WAIT_EVENT_UNTIL(ev == PROCESS_EVENT_POLL);
+
+    op = list_head(queue);
+    if(op != NULL) {
+      if(op->done < op->len) {
+        transfer(op);
+      }
+      /* If the event queue is full, try again on the next round. */
+      if(op->done == op->len &&
+         process_post(op->process, cfs_async_event, op) == PROCESS_ERR_OK) {
+        list_remove(queue, op);
+      }
+      process_poll(&cfs_async_process);
+    } else if(maintain) {
+      maintain = cfs_coffee_maintain();
+      if(maintain) {
+        process_poll(&cfs_async_process);
+      }
+    }
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
+/** @} */
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \addtogroup cfs
+ * @{
+ */
+
+/**
+ * \file
+ *         Asynchronous CFS I/O.
+ *
+ *         A process queues a read or a write on an open file descriptor
+ *         and keeps running. When the operation is done, the calling
+ *         process gets cfs_async_event with the operation as data. The
+ *         operation object belongs to the caller and must stay valid
+ *         until then, and so must the buffer.
+ *
+ *         On Coffee, the operations run in a system process in chunks of
+ *         CFS_ASYNC_CHUNK_SIZE bytes, and the process does the merge and
+ *         garbage collection work of cfs_coffee_maintain() while idle.
+ *         On the native platform, a worker thread does the blocking
+ *         read() and write() calls.
+ */
+
+#ifndef CFS_ASYNC_H_
+#define CFS_ASYNC_H_
+
+#include "contiki.h"
+#include "cfs/cfs.h"
+
+#ifdef CFS_ASYNC_CONF_CHUNK_SIZE
+#define CFS_ASYNC_CHUNK_SIZE CFS_ASYNC_CONF_CHUNK_SIZE
+#else
+#define CFS_ASYNC_CHUNK_SIZE 128
+#endif /* CFS_ASYNC_CONF_CHUNK_SIZE */
+
+/* Operation types */
+#define CFS_ASYNC_READ  1
+#define CFS_ASYNC_WRITE 2
+
+/**
+ * An asynchronous operation. The caller fills nothing in itself; the
+ * fields are set by cfs_async_read() and cfs_async_write(). When
+ * cfs_async_event arrives, result is the number of bytes transferred,
+ * or -1 if the operation failed before transferring anything.
+ */
+struct cfs_async_op {
+  struct cfs_async_op *next;
+  struct process *process;
+  void *buf;
+  unsigned len;
+  unsigned done;
+  int fd;
+  int result;
+  uint8_t type;
+};
+
+/** Posted to the calling process when an operation completes. */
+extern process_event_t cfs_async_event;
+
+/**
+ * \brief Queue a read.
+ * \param op The operation object.
+ * \param fd An open file descriptor.
+ * \param buf The destination buffer.
+ * \param len The number of bytes to read.
+ * \return 0 if the read was queued, -1 otherwise.
+ *
+ * Operations on the same file descriptor complete in the order they
+ * were queued. This must be called from a process, which gets the
+ * completion event.
+ */
+int cfs_async_read(struct cfs_async_op *op, int fd, void *buf, unsigned len);
+
+/**
+ * \brief Queue a write.
+ * \param op The operation object.
+ * \param fd An open file descriptor.
+ * \param buf The data to write.
+ * \param len The number of bytes to write.
+ * \return 0 if the write was queued, -1 otherwise.
+ */
+int cfs_async_write(struct cfs_async_op *op, int fd, const void *buf,
+                    unsigned len);
+
+/**
+ * \brief Request background maintenance of the file system.
+ *
+ * Makes the asynchronous I/O process run the file system's
+ * incremental maintenance while no operations are queued. Writes
+ * request it implicitly. Does nothing where the file system has no
+ * such maintenance.
+ */
+void cfs_async_maintain(void);
+
+#endif /* CFS_ASYNC_H_ */
+
+/** @} */
@@ -158,6 +158,7 @@ struct sector_status {
   coffee_page_t active;
   coffee_page_t obsolete;
   coffee_page_t free;
+  coffee_page_t carried; /* Pages of an extent from a previous sector. */
 };
 
 /* The structure of cached file objects. */
@@ -197,6 +198,15 @@ struct log_param {
   uint16_t size;
 };
 
+/* The state of a log merge, which can be carried out in steps. */
+struct merge {
+  struct file *new_file;
+  cfs_offset_t offset;
+  coffee_page_t file_page;
+  uint16_t chunk_size;
+  int fd;
+};
+
 /*
  * Variables that keep track of opened files and internal
  * optimization information for Coffee.
@@ -206,6 +216,12 @@ static struct file_desc coffee_fd_set[COFFEE_FD_SET_SIZE];
 static coffee_page_t next_free;
 static char gc_wait;
 
+/* A log merge done in steps by cfs_coffee_maintain(). */
+static struct merge background_merge = { .fd = -1 };
+
+#define MERGING_PAGE \
+  (background_merge.fd >= 0 ? background_merge.new_file->page : INVALID_PAGE)
+
 /*---------------------------------------------------------------------------*/
 static void
 write_header(struct file_header *hdr, coffee_page_t page)
@@ -254,6 +270,7 @@ get_sector_status(coffee_page_t sector, struct sector_status *stats)
 
   sector_start = sector * COFFEE_PAGES_PER_SECTOR;
   sector_end = sector_start + COFFEE_PAGES_PER_SECTOR;
+  stats->carried = skip_pages;
 
   /*
    * Account for pages belonging to a file starting in a previous
@@ -354,22 +371,27 @@ collect_garbage(int mode)
   coffee_page_t sector;
   struct sector_status stats;
   coffee_page_t first_page, isolation_count;
+  int erased;
 
   PRINTF("Coffee: Running the garbage collector in %s mode\n",
          mode == GC_RELUCTANT ? "reluctant" : "greedy");
   /*
    * The garbage collector erases as many sectors as possible. A sector is
-   * erasable if there are only free or obsolete pages in it.
+   * erasable if there are only free or obsolete pages in it, and if the
+   * header of an extent that reaches into it is erased as well.
    */
+  erased = 0;
   for(sector = 0; sector < COFFEE_SECTOR_COUNT; sector++) {
     isolation_count = get_sector_status(sector, &stats);
     PRINTF("Coffee: Sector %u has %u active, %u obsolete, and %u free pages.\n",
            (unsigned)sector, (unsigned)stats.active,
            (unsigned)stats.obsolete, (unsigned)stats.free);
 
-    if(stats.active > 0) {
+    if(stats.active > 0 || (stats.carried > 0 && !erased)) {
+      erased = 0;
       continue;
     }
+    erased = 0;
 
     if((mode == GC_RELUCTANT && stats.free == 0) ||
        (mode == GC_GREEDY && stats.obsolete > 0)) {
@@ -384,6 +406,7 @@ collect_garbage(int mode)
 
       COFFEE_ERASE(sector);
       PRINTF("Coffee: Erased sector %d!\n", sector);
+      erased = 1;
 
       if(mode == GC_RELUCTANT && isolation_count > 0) {
         break;
@@ -461,7 +484,7 @@ find_file(const char *name)
 
   /* First check if the file metadata is cached. */
   for(i = 0; i < COFFEE_MAX_OPEN_FILES; i++) {
-    if(FILE_FREE(&coffee_files[i])) {
+    if(FILE_FREE(&coffee_files[i]) || coffee_files[i].page == MERGING_PAGE) {
       continue;
     }
 
@@ -474,7 +497,8 @@ find_file(const char *name)
   /* Scan the flash memory sequentially otherwise. */
   for(page = 0; page < COFFEE_PAGE_COUNT; page = next_file(page, &hdr)) {
     read_header(&hdr, page);
-    if(HDR_ACTIVE(hdr) && !HDR_LOG(hdr) && strcmp(name, hdr.name) == 0) {
+    if(HDR_ACTIVE(hdr) && !HDR_LOG(hdr) && page != MERGING_PAGE &&
+       strcmp(name, hdr.name) == 0) {
       return load_file(page, &hdr);
     }
   }
@@ -608,7 +632,7 @@ page_count(cfs_offset_t size)
 /*---------------------------------------------------------------------------*/
 static struct file *
 reserve(const char *name, coffee_page_t pages,
-        int allow_duplicates, unsigned flags)
+        int allow_duplicates, unsigned flags, int gc_allowed)
 {
   struct file_header hdr;
   coffee_page_t page;
@@ -620,7 +644,7 @@ reserve(const char *name, coffee_page_t pages,
 
   page = find_contiguous_pages(pages);
   if(page == INVALID_PAGE) {
-    if(gc_wait) {
+    if(gc_wait || !gc_allowed) {
       return NULL;
     }
     collect_garbage(GC_GREEDY);
@@ -763,7 +787,8 @@ create_log(struct file *file, struct file_header *hdr)
   /* Log index size + log data size. */
   size = log_records * (sizeof(uint16_t) + log_record_size);
 
-  log_file = reserve(hdr->name, page_count(size), 1, HDR_FLAG_LOG);
+  log_file = reserve(hdr->name, page_count(size), 1, HDR_FLAG_LOG,
+                     ALLOW_GC);
   if(log_file == NULL) {
     return INVALID_PAGE;
   }
@@ -778,19 +803,15 @@ create_log(struct file *file, struct file_header *hdr)
 #endif /* COFFEE_MICRO_LOGS */
 /*---------------------------------------------------------------------------*/
 static int
-merge_log(coffee_page_t file_page, int extend)
+merge_begin(struct merge *merge, coffee_page_t file_page, int extend,
+            int gc_allowed)
 {
-  struct file_header hdr, hdr2;
-  int fd, n;
-  cfs_offset_t offset;
-  coffee_page_t max_pages;
-  struct file *new_file;
-  int i;
+  struct file_header hdr;
 
   read_header(&hdr, file_page);
 
-  fd = cfs_open(hdr.name, CFS_READ);
-  if(fd < 0) {
+  merge->fd = cfs_open(hdr.name, CFS_READ);
+  if(merge->fd < 0) {
     return -1;
   }
 
@@ -798,38 +819,68 @@ merge_log(coffee_page_t file_page, int extend)
    * The reservation function adds extra space for the header, which has
    * already been accounted for in the previous reservation.
    */
-  max_pages = hdr.max_pages << extend;
-  new_file = reserve(hdr.name, max_pages, 1, 0);
-  if(new_file == NULL) {
-    cfs_close(fd);
+  merge->new_file = reserve(hdr.name, hdr.max_pages << extend, 1, 0,
+                            gc_allowed);
+  if(merge->new_file == NULL) {
+    cfs_close(merge->fd);
+    merge->fd = -1;
     return -1;
   }
 
-  offset = 0;
-  do {
-    char buf[hdr.log_record_size == 0 ? COFFEE_PAGE_SIZE : hdr.log_record_size];
-    n = cfs_read(fd, buf, sizeof(buf));
-    if(n < 0) {
-      remove_by_page(new_file->page, !REMOVE_LOG, !CLOSE_FDS, ALLOW_GC);
-      cfs_close(fd);
-      return -1;
-    } else if(n > 0) {
-      COFFEE_WRITE(buf, n, absolute_offset(new_file->page, offset));
-      offset += n;
-    }
-  } while(n != 0);
+  /* Keep the new file object cached while the merge is in progress. */
+  merge->new_file->references++;
+  merge->file_page = file_page;
+  merge->offset = 0;
+  merge->chunk_size = hdr.log_record_size == 0 ?
+    COFFEE_PAGE_SIZE : hdr.log_record_size;
+
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+static int
+merge_step(struct merge *merge)
+{
+  char buf[merge->chunk_size];
+  int n;
+
+  n = cfs_read(merge->fd, buf, sizeof(buf));
+  if(n > 0) {
+    COFFEE_WRITE(buf, n, absolute_offset(merge->new_file->page,
+                                         merge->offset));
+    merge->offset += n;
+  }
+
+  return n;
+}
+/*---------------------------------------------------------------------------*/
+static void
+merge_abort(struct merge *merge)
+{
+  merge->new_file->references--;
+  remove_by_page(merge->new_file->page, !REMOVE_LOG, !CLOSE_FDS, !ALLOW_GC);
+  cfs_close(merge->fd);
+  merge->fd = -1;
+}
+/*---------------------------------------------------------------------------*/
+static int
+merge_finish(struct merge *merge)
+{
+  struct file_header hdr, hdr2;
+  struct file *new_file;
+  int i;
 
+  new_file = merge->new_file;
   for(i = 0; i < COFFEE_FD_SET_SIZE; i++) {
     if(coffee_fd_set[i].flags != COFFEE_FD_FREE &&
-       coffee_fd_set[i].file->page == file_page) {
+       coffee_fd_set[i].file->page == merge->file_page) {
       coffee_fd_set[i].file = new_file;
       new_file->references++;
     }
   }
 
-  if(remove_by_page(file_page, REMOVE_LOG, !CLOSE_FDS, !ALLOW_GC) < 0) {
-    remove_by_page(new_file->page, !REMOVE_LOG, !CLOSE_FDS, !ALLOW_GC);
-    cfs_close(fd);
+  read_header(&hdr, merge->file_page);
+  if(remove_by_page(merge->file_page, REMOVE_LOG, !CLOSE_FDS, !ALLOW_GC) < 0) {
+    merge_abort(merge);
     return -1;
   }
 
@@ -840,13 +891,46 @@ merge_log(coffee_page_t file_page, int extend)
   write_header(&hdr2, new_file->page);
 
   new_file->flags &= ~COFFEE_FILE_MODIFIED;
-  new_file->end = offset;
+  new_file->end = merge->offset;
+  new_file->references--;
 
-  cfs_close(fd);
+  cfs_close(merge->fd);
+  merge->fd = -1;
 
   return 0;
 }
 /*---------------------------------------------------------------------------*/
+static int
+merge_log(coffee_page_t file_page, int extend)
+{
+  struct merge merge;
+  int n;
+
+  if(merge_begin(&merge, file_page, extend, ALLOW_GC) < 0) {
+    return -1;
+  }
+
+  while((n = merge_step(&merge)) > 0);
+  if(n < 0) {
+    merge_abort(&merge);
+    return -1;
+  }
+
+  return merge_finish(&merge);
+}
+/*---------------------------------------------------------------------------*/
+static void
+abort_background_merge(coffee_page_t file_page)
+{
+  struct merge merge;
+
+  if(background_merge.fd >= 0 && background_merge.file_page == file_page) {
+    merge = background_merge;
+    background_merge.fd = -1;
+    merge_abort(&merge);
+  }
+}
+/*---------------------------------------------------------------------------*/
 #if COFFEE_MICRO_LOGS
 static int
 find_next_record(struct file *file, coffee_page_t log_page,
@@ -994,7 +1078,7 @@ cfs_open(const char *name, int flags)
     if((flags & (CFS_READ | CFS_WRITE)) == CFS_READ) {
       return -1;
     }
-    fdp->file = reserve(name, page_count(COFFEE_DYN_SIZE), 1, 0);
+    fdp->file = reserve(name, page_count(COFFEE_DYN_SIZE), 1, 0, ALLOW_GC);
     if(fdp->file == NULL) {
       return -1;
     }
@@ -1073,6 +1157,7 @@ cfs_remove(const char *name)
     return -1;
   }
 
+  abort_background_merge(file->page);
   return remove_by_page(file->page, REMOVE_LOG, CLOSE_FDS, ALLOW_GC);
 }
 /*---------------------------------------------------------------------------*/
@@ -1157,6 +1242,9 @@ cfs_write(int fd, const void *buf, unsigned size)
   fdp = &coffee_fd_set[fd];
   file = fdp->file;
 
+  /* A pending background merge would miss this write. */
+  abort_background_merge(file->page);
+
   /* Attempt to extend the file if we try to write past the end. */
   if(!(fdp->io_flags & CFS_COFFEE_IO_FIRM_SIZE)) {
     while(size + fdp->offset + sizeof(struct file_header) >
@@ -1247,14 +1335,17 @@ cfs_readdir(struct cfs_dir *dir, struct cfs_dirent *record)
   struct file_header hdr;
   coffee_page_t page;
   coffee_page_t next_page;
+  size_t name_length;
 
   memcpy(&page, dir->state, sizeof(coffee_page_t));
 
   while(page < COFFEE_PAGE_COUNT) {
     read_header(&hdr, page);
-    if(HDR_ACTIVE(hdr) && !HDR_LOG(hdr)) {
-      memcpy(record->name, hdr.name, sizeof(record->name));
-      record->name[sizeof(record->name) - 1] = '\0';
+    if(HDR_ACTIVE(hdr) && !HDR_LOG(hdr) && page != MERGING_PAGE) {
+      /* The stored name is not terminated if it fills the header field. */
+      name_length = MIN(sizeof(record->name) - 1, sizeof(hdr.name));
+      memcpy(record->name, hdr.name, name_length);
+      record->name[name_length] = '\0';
       record->size = file_end(page);
 
       next_page = next_file(page, &hdr);
@@ -1276,7 +1367,7 @@ cfs_closedir(struct cfs_dir *dir)
 int
 cfs_coffee_reserve(const char *name, cfs_offset_t size)
 {
-  return reserve(name, page_count(size), 0, 0) == NULL ? -1 : 0;
+  return reserve(name, page_count(size), 0, 0, ALLOW_GC) == NULL ? -1 : 0;
 }
 /*---------------------------------------------------------------------------*/
 int
@@ -1338,9 +1429,126 @@ cfs_coffee_format(void)
   memset(&coffee_fd_set, 0, sizeof(coffee_fd_set));
   next_free = 0;
   gc_wait = 1;
+  background_merge.fd = -1;
 
   PRINTF(" done!\n");
 
   return 0;
 }
 /*---------------------------------------------------------------------------*/
+#if COFFEE_MICRO_LOGS
+static int
+start_background_merge(void)
+{
+  struct file *file;
+  struct file_header hdr;
+  uint16_t log_record_size, log_records;
+  int i;
+
+  /*
+   * Merge a file whose log is at least three quarters full, so that the
+   * write that fills it up does not have to do it. Garbage collection is
+   * left to the separate incremental steps.
+   */
+  for(i = 0; i < COFFEE_MAX_OPEN_FILES; i++) {
+    file = &coffee_files[i];
+    if(FILE_FREE(file) || !FILE_MODIFIED(file) || file->record_count < 0) {
+      continue;
+    }
+
+    read_header(&hdr, file->page);
+    adjust_log_config(&hdr, &log_record_size, &log_records);
+    if(file->record_count < log_records - log_records / 4) {
+      continue;
+    }
+
+    if(merge_begin(&background_merge, file->page, 0, !ALLOW_GC) == 0) {
+      PRINTF("Coffee: Merging the file %s with its log in the background\n",
+             hdr.name);
+      return 1;
+    }
+  }
+
+  return 0;
+}
+#endif /* COFFEE_MICRO_LOGS */
+/*---------------------------------------------------------------------------*/
+static int
+collect_garbage_step(void)
+{
+  coffee_page_t sector;
+  struct sector_status stats;
+  coffee_page_t first_page, isolation_count;
+  int erased;
+
+  /*
+   * Erase the first sector that contains only obsolete pages, like the
+   * reluctant mode of collect_garbage() does. An obsolete extent that
+   * starts in it may cover the following sectors too, which are erased
+   * in the same step. A sector that is covered by an extent whose
+   * header stays in a previous sector is left alone.
+   */
+  erased = 0;
+  for(sector = 0; sector < COFFEE_SECTOR_COUNT; sector++) {
+    isolation_count = get_sector_status(sector, &stats);
+    if(erased && stats.carried == 0) {
+      break;
+    }
+    if(stats.active > 0 || stats.free > 0 ||
+       (stats.carried > 0 && !erased)) {
+      continue;
+    }
+
+    first_page = sector * COFFEE_PAGES_PER_SECTOR;
+    if(first_page < next_free) {
+      next_free = first_page;
+    }
+
+    if(isolation_count > 0) {
+      isolate_pages(first_page + COFFEE_PAGES_PER_SECTOR, isolation_count);
+    }
+
+    COFFEE_ERASE(sector);
+    PRINTF("Coffee: Erased sector %d in the background\n", (int)sector);
+    gc_wait = 0;
+    erased = 1;
+
+    if(isolation_count > 0) {
+      break;
+    }
+  }
+
+  return erased;
+}
+/*---------------------------------------------------------------------------*/
+int
+cfs_coffee_maintain(void)
+{
+  struct merge merge;
+  int n;
+
+  if(background_merge.fd >= 0) {
+    n = merge_step(&background_merge);
+    if(n > 0) {
+      return 1;
+    }
+
+    merge = background_merge;
+    background_merge.fd = -1;
+    if(n < 0) {
+      merge_abort(&merge);
+    } else {
+      merge_finish(&merge);
+    }
+    return 1;
+  }
+
+#if COFFEE_MICRO_LOGS
+  if(start_background_merge()) {
+    return 1;
+  }
+#endif /* COFFEE_MICRO_LOGS */
+
+  return collect_garbage_step();
+}
+/*---------------------------------------------------------------------------*/
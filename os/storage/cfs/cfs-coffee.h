@@ -140,6 +140,19 @@ int cfs_coffee_set_io_semantics(int fd, unsigned flags);
  */
 int cfs_coffee_format(void);
 
+/**
+ * \brief Perform one step of background maintenance.
+ * \return 1 if more maintenance work is pending, 0 otherwise.
+ *
+ * Each call does a bounded amount of work: it either copies one
+ * chunk of a file that is being merged with its micro log, starts
+ * such a merge for a file whose log is nearly full, or erases one
+ * sector that contains only obsolete pages. Calling this function
+ * while the system is idle keeps the long merge and garbage
+ * collection operations out of the cfs_write() path.
+ */
+int cfs_coffee_maintain(void);
+
 /** @} */
 /** @} */
 
@@ -44,16 +44,427 @@
  * Adam Dunkels <adam@sics.se>
  */
 
+
 #include "contiki.h"
 
 #include "sys/etimer.h"
 #include "sys/process.h"
 
-static struct etimer *timerlist;
+#include <string.h>
+
 static clock_time_t next_expiration;
 
 PROCESS(etimer_process, "Event timer");
 /*---------------------------------------------------------------------------*/
+#if ETIMER_TIMING_WHEEL
+/*
+ * Hierarchical timing wheel.
+ *
+ * Level 0 has one slot per clock tick, and each slot of level n spans
+ * a full revolution of level n - 1. A timer is put in the level that
+ * covers the distance to its expiration time, at the slot indexed by
+ * the corresponding bits of the expiration time. Whenever the wheel
+ * crosses a slot boundary of level n, the timers of that slot are
+ * cascaded down to the lower levels. Timers that expire further away
+ * than the wheel can represent are parked in the furthest slot of the
+ * top level and are re-inserted when that slot is cascaded.
+ *
+ * Inserting a timer is O(1). Removing a timer walks only the slot it
+ * is in. A bitmap of non-empty slots per level lets the wheel skip
+ * over idle ticks, so the cost of advancing does not depend on the
+ * length of the period the node was sleeping.
+ */
+#define WHEEL_BITS     5
+#define WHEEL_SLOTS    (1 << WHEEL_BITS)
+#define WHEEL_MASK     (WHEEL_SLOTS - 1)
+
+#if ETIMER_WHEEL_LEVELS < 2 || ETIMER_WHEEL_LEVELS > 6
+#error "ETIMER_CONF_WHEEL_LEVELS must be between 2 and 6"
+#endif
+
+/* Values of etimer.slot that do not refer to a wheel slot */
+#define SLOT_EXPIRED   0xfe
+#define SLOT_NONE      0xff
+
+/* True if clock time a is before clock time b */
+#define CLOCK_BEFORE(a, b) \
+  ((clock_time_t)((a) - (b)) > ((clock_time_t)~(clock_time_t)0) / 2)
+
+static struct etimer *wheel[ETIMER_WHEEL_LEVELS * WHEEL_SLOTS];
+static uint32_t wheel_map[ETIMER_WHEEL_LEVELS];
+/* Timers that have expired but whose event has not been posted yet */
+static struct etimer *expired_list;
+/* The next clock tick that the wheel has not processed yet */
+static clock_time_t wheel_now;
+static uint8_t next_expiration_valid;
+static unsigned int pending_timers;
+/*---------------------------------------------------------------------------*/
+static void
+wheel_insert(struct etimer *t)
+{
+  clock_time_t expires;
+  clock_time_t delta;
+  uint8_t level;
+  uint8_t slot;
+
+  expires = t->timer.start + t->timer.interval;
+
+  if(CLOCK_BEFORE(expires, wheel_now)) {
+    t->slot = SLOT_EXPIRED;
+    t->next = expired_list;
+    expired_list = t;
+    return;
+  }
+
+  delta = expires - wheel_now;
+  for(level = 0; level < ETIMER_WHEEL_LEVELS - 1; level++) {
+    if((delta >> (WHEEL_BITS * (level + 1))) == 0) {
+      break;
+    }
+  }
+  if((delta >> (WHEEL_BITS * (level + 1))) != 0) {
+    /* Beyond the range of the wheel: park in the furthest slot */
+    expires = wheel_now +
+      (((clock_time_t)1 << (WHEEL_BITS * ETIMER_WHEEL_LEVELS)) - 1);
+  }
+
+  slot = (expires >> (WHEEL_BITS * level)) & WHEEL_MASK;
+  wheel_map[level] |= (uint32_t)1 << slot;
+  slot += level * WHEEL_SLOTS;
+  t->slot = slot;
+  t->next = wheel[slot];
+  wheel[slot] = t;
+}
+/*---------------------------------------------------------------------------*/
+static int
+wheel_remove(struct etimer *t)
+{
+  struct etimer **tp;
+
+  if(t->slot == SLOT_EXPIRED) {
+    tp = &expired_list;
+  } else if(t->slot < ETIMER_WHEEL_LEVELS * WHEEL_SLOTS) {
+    tp = &wheel[t->slot];
+  } else {
+    return 0;
+  }
+
+  /* The bit in wheel_map is left set if the slot becomes empty. It is
+     cleared when the slot is visited. */
+  for(; *tp != NULL; tp = &(*tp)->next) {
+    if(*tp == t) {
+      *tp = t->next;
+      t->next = NULL;
+      t->slot = SLOT_NONE;
+      return 1;
+    }
+  }
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+static void
+wheel_reinsert_slot(uint8_t level, uint8_t index)
+{
+  struct etimer *t, *next;
+
+  t = wheel[level * WHEEL_SLOTS + index];
+  wheel[level * WHEEL_SLOTS + index] = NULL;
+  wheel_map[level] &= ~((uint32_t)1 << index);
+
+  for(; t != NULL; t = next) {
+    next = t->next;
+    wheel_insert(t);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+wheel_process_tick(clock_time_t tick)
+{
+  uint8_t level;
+
+  /* Cascade all levels whose slot boundary is at this tick, starting
+     with the highest one so that timers can trickle all the way down
+     to level 0. */
+  wheel_now = tick;
+  for(level = ETIMER_WHEEL_LEVELS - 1; level > 0; level--) {
+    if((tick & (((clock_time_t)1 << (WHEEL_BITS * level)) - 1)) == 0) {
+      wheel_reinsert_slot(level, (tick >> (WHEEL_BITS * level)) & WHEEL_MASK);
+    }
+  }
+
+  /* Timers in the level 0 slot of this tick move to the expired list */
+  wheel_now = tick + 1;
+  wheel_reinsert_slot(0, tick & WHEEL_MASK);
+}
+/*---------------------------------------------------------------------------*/
+static int
+cascade_pending(clock_time_t tick)
+{
+  uint8_t level;
+
+  for(level = 1; level < ETIMER_WHEEL_LEVELS; level++) {
+    if((tick & (((clock_time_t)1 << (WHEEL_BITS * level)) - 1)) != 0) {
+      break;
+    }
+    if(wheel_map[level] & ((uint32_t)1 << ((tick >> (WHEEL_BITS * level)) & WHEEL_MASK))) {
+      return 1;
+    }
+  }
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+static void
+wheel_advance(clock_time_t now)
+{
+  clock_time_t next;
+  clock_time_t span;
+  uint32_t pending;
+  uint8_t level;
+  uint8_t shift;
+
+  while(!CLOCK_BEFORE(now, wheel_now)) {
+    wheel_process_tick(wheel_now);
+
+    /* Find the next tick at which there is work to do */
+    next = wheel_now;
+    for(level = 0; level < ETIMER_WHEEL_LEVELS; level++) {
+      if(cascade_pending(next)) {
+        break;
+      }
+      shift = WHEEL_BITS * level;
+      pending = wheel_map[level] >> ((next >> shift) & WHEEL_MASK);
+      if(pending != 0) {
+        /* A slot later in the current revolution of this level */
+        while((pending & 1) == 0) {
+          pending >>= 1;
+          next += (clock_time_t)1 << shift;
+        }
+        break;
+      }
+      if(level == ETIMER_WHEEL_LEVELS - 1) {
+        if(wheel_map[level] != 0) {
+          /* Step to the next top-level slot */
+          span = (clock_time_t)1 << shift;
+          next = (next + span) & ~(span - 1);
+        } else {
+          /* The wheel is empty */
+          next = now + 1;
+        }
+        break;
+      }
+      /* Nothing left in the current revolution of this level: go to
+         the start of the next one. Higher levels can only be skipped
+         over when this level is completely empty. */
+      span = (clock_time_t)1 << (shift + WHEEL_BITS);
+      next = (next + span - 1) & ~(span - 1);
+      if(wheel_map[level] != 0) {
+        break;
+      }
+    }
+
+    if(CLOCK_BEFORE(now, next)) {
+      wheel_now = now + 1;
+      break;
+    }
+    wheel_now = next;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+update_time(void)
+{
+  struct etimer *t;
+  struct etimer *first;
+  clock_time_t expires;
+  uint8_t level;
+  uint8_t start;
+  uint8_t i;
+  uint8_t index;
+
+  next_expiration_valid = 1;
+  if(pending_timers == 0) {
+    next_expiration = 0;
+    return;
+  }
+
+  first = NULL;
+  for(t = expired_list; t != NULL; t = t->next) {
+    if(first == NULL || CLOCK_BEFORE(etimer_expiration_time(t), next_expiration)) {
+      first = t;
+      next_expiration = etimer_expiration_time(t);
+    }
+  }
+
+  /* The first non-empty slot of each level holds the earliest timer of
+     that level. Unless the wheel is exactly at a slot boundary that has
+     not been cascaded yet, the current slot of the levels above 0 holds
+     timers that belong to the next revolution. The top level may hold
+     parked timers, so all of its slots are scanned. */
+  for(level = 0; level < ETIMER_WHEEL_LEVELS; level++) {
+    start = (wheel_now >> (WHEEL_BITS * level)) & WHEEL_MASK;
+    if((wheel_now & (((clock_time_t)1 << (WHEEL_BITS * level)) - 1)) != 0) {
+      start++;
+    }
+    for(i = 0; i < WHEEL_SLOTS; i++) {
+      index = (start + i) & WHEEL_MASK;
+      if((wheel_map[level] & ((uint32_t)1 << index)) == 0) {
+        continue;
+      }
+      t = wheel[level * WHEEL_SLOTS + index];
+      if(t == NULL) {
+        wheel_map[level] &= ~((uint32_t)1 << index);
+        continue;
+      }
+      for(; t != NULL; t = t->next) {
+        expires = etimer_expiration_time(t);
+        if(first == NULL || CLOCK_BEFORE(expires, next_expiration)) {
+          first = t;
+          next_expiration = expires;
+        }
+      }
+      if(level < ETIMER_WHEEL_LEVELS - 1) {
+        break;
+      }
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+init_timers(void)
+{
+  memset(wheel, 0, sizeof(wheel));
+  memset(wheel_map, 0, sizeof(wheel_map));
+  expired_list = NULL;
+  pending_timers = 0;
+  next_expiration_valid = 0;
+}
+/*---------------------------------------------------------------------------*/
+static void
+remove_process_timers(struct process *p)
+{
+  struct etimer **tp;
+  uint16_t slot;
+
+  for(tp = &expired_list; *tp != NULL;) {
+    if((*tp)->p == p) {
+      (*tp)->slot = SLOT_NONE;
+      *tp = (*tp)->next;
+      pending_timers--;
+    } else {
+      tp = &(*tp)->next;
+    }
+  }
+  for(slot = 0; slot < ETIMER_WHEEL_LEVELS * WHEEL_SLOTS; slot++) {
+    for(tp = &wheel[slot]; *tp != NULL;) {
+      if((*tp)->p == p) {
+        (*tp)->slot = SLOT_NONE;
+        *tp = (*tp)->next;
+        pending_timers--;
+      } else {
+        tp = &(*tp)->next;
+      }
+    }
+  }
+  next_expiration_valid = 0;
+}
+/*---------------------------------------------------------------------------*/
+static void
+expire_timers(void)
+{
+  struct etimer **tp;
+  struct etimer *t;
+
+  if(pending_timers == 0) {
+    return;
+  }
+
+  wheel_advance(clock_time());
+
+  for(tp = &expired_list; *tp != NULL;) {
+    t = *tp;
+    if(process_post(t->p, PROCESS_EVENT_TIMER, t) == PROCESS_ERR_OK) {
+      /* Reset the process ID of the event timer, to signal that the
+         etimer has expired. This is later checked in the
+         etimer_expired() function. */
+      t->p = PROCESS_NONE;
+      *tp = t->next;
+      t->next = NULL;
+      t->slot = SLOT_NONE;
+      pending_timers--;
+    } else {
+      /* The event queue is full; try again on the next poll */
+      etimer_request_poll();
+      tp = &t->next;
+    }
+  }
+  update_time();
+}
+/*---------------------------------------------------------------------------*/
+static void
+add_timer(struct etimer *timer)
+{
+  etimer_request_poll();
+
+  if(pending_timers == 0) {
+    /* The wheel is idle; bring it up to date with the clock */
+    wheel_now = clock_time();
+  }
+
+  if(timer->p != PROCESS_NONE && wheel_remove(timer)) {
+    /* Timer already pending, it is moved to its new slot. The old
+       expiration time may have been the next one. */
+    next_expiration_valid = 0;
+  } else {
+    pending_timers++;
+  }
+
+  timer->p = PROCESS_CURRENT();
+  wheel_insert(timer);
+
+  if(next_expiration_valid &&
+     (pending_timers == 1 ||
+      CLOCK_BEFORE(etimer_expiration_time(timer), next_expiration))) {
+    next_expiration = etimer_expiration_time(timer);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+remove_timer(struct etimer *et)
+{
+  if(wheel_remove(et)) {
+    pending_timers--;
+    next_expiration_valid = 0;
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+adjust_timer(struct etimer *et)
+{
+  if(et->p != PROCESS_NONE && wheel_remove(et)) {
+    wheel_insert(et);
+  }
+  next_expiration_valid = 0;
+}
+/*---------------------------------------------------------------------------*/
+int
+etimer_pending(void)
+{
+  return pending_timers != 0;
+}
+/*---------------------------------------------------------------------------*/
+clock_time_t
+etimer_next_expiration_time(void)
+{
+  if(!next_expiration_valid) {
+    update_time();
+  }
+  return etimer_pending() ? next_expiration : 0;
+}
+/*---------------------------------------------------------------------------*/
+#else /* ETIMER_TIMING_WHEEL */
+
+static struct etimer *timerlist;
+/*---------------------------------------------------------------------------*/
 static void
 update_time(void)
 {
@@ -77,74 +488,63 @@ update_time(void)
   }
 }
 /*---------------------------------------------------------------------------*/
-PROCESS_THREAD(etimer_process, ev, data)
+static void
+init_timers(void)
 {
-  struct etimer *t, *u;
-	
-  PROCESS_BEGIN();
-
   timerlist = NULL;
-  
-  while(1) {
-    PROCESS_YIELD();
-
-    if(ev == PROCESS_EVENT_EXITED) {
-      struct process *p = data;
+}
+/*---------------------------------------------------------------------------*/
+static void
+remove_process_timers(struct process *p)
+{
+  struct etimer *t;
 
-      while(timerlist != NULL && timerlist->p == p) {
-	timerlist = timerlist->next;
-      }
+  while(timerlist != NULL && timerlist->p == p) {
+    timerlist = timerlist->next;
+  }
 
-      if(timerlist != NULL) {
-	t = timerlist;
-	while(t->next != NULL) {
-	  if(t->next->p == p) {
-	    t->next = t->next->next;
-	  } else
-	    t = t->next;
-	}
-      }
-      continue;
-    } else if(ev != PROCESS_EVENT_POLL) {
-      continue;
+  if(timerlist != NULL) {
+    t = timerlist;
+    while(t->next != NULL) {
+      if(t->next->p == p) {
+	t->next = t->next->next;
+      } else
+	t = t->next;
     }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+expire_timers(void)
+{
+  struct etimer *t, *u;
 
-  again:
-    
-    u = NULL;
-    
-    for(t = timerlist; t != NULL; t = t->next) {
-      if(timer_expired(&t->timer)) {
-	if(process_post(t->p, PROCESS_EVENT_TIMER, t) == PROCESS_ERR_OK) {
-	  
-	  /* Reset the process ID of the event timer, to signal that the
-	     etimer has expired. This is later checked in the
-	     etimer_expired() function. */
-	  t->p = PROCESS_NONE;
-	  if(u != NULL) {
-	    u->next = t->next;
-	  } else {
-	    timerlist = t->next;
-	  }
-	  t->next = NULL;
-	  update_time();
-	  goto again;
+ again:
+
+  u = NULL;
+
+  for(t = timerlist; t != NULL; t = t->next) {
+    if(timer_expired(&t->timer)) {
+      if(process_post(t->p, PROCESS_EVENT_TIMER, t) == PROCESS_ERR_OK) {
+
+	/* Reset the process ID of the event timer, to signal that the
+	   etimer has expired. This is later checked in the
+	   etimer_expired() function. */
+	t->p = PROCESS_NONE;
+	if(u != NULL) {
+	  u->next = t->next;
 	} else {
-	  etimer_request_poll();
+	  timerlist = t->next;
 	}
+	t->next = NULL;
+	update_time();
+	goto again;
+      } else {
+	etimer_request_poll();
       }
-      u = t;
     }
-    
+    u = t;
   }
-  
-  PROCESS_END();
-}
-/*---------------------------------------------------------------------------*/
-void
-etimer_request_poll(void)
-{
-  process_poll(&etimer_process);
 }
 /*---------------------------------------------------------------------------*/
 static void
@@ -173,6 +573,76 @@ add_timer(struct etimer *timer)
   update_time();
 }
 /*---------------------------------------------------------------------------*/
+static void
+remove_timer(struct etimer *et)
+{
+  struct etimer *t;
+
+  /* First check if et is the first event timer on the list. */
+  if(et == timerlist) {
+    timerlist = timerlist->next;
+    update_time();
+  } else {
+    /* Else walk through the list and try to find the item before the
+       et timer. */
+    for(t = timerlist; t != NULL && t->next != et; t = t->next);
+
+    if(t != NULL) {
+      /* We've found the item before the event timer that we are about
+	 to remove. We point the items next pointer to the event after
+	 the removed item. */
+      t->next = et->next;
+
+      update_time();
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+adjust_timer(struct etimer *et)
+{
+  update_time();
+}
+/*---------------------------------------------------------------------------*/
+int
+etimer_pending(void)
+{
+  return timerlist != NULL;
+}
+/*---------------------------------------------------------------------------*/
+clock_time_t
+etimer_next_expiration_time(void)
+{
+  return etimer_pending() ? next_expiration : 0;
+}
+/*---------------------------------------------------------------------------*/
+#endif /* ETIMER_TIMING_WHEEL */
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(etimer_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  init_timers();
+
+  while(1) {
+    PROCESS_YIELD();
+
+    if(ev == PROCESS_EVENT_EXITED) {
+      remove_process_timers(data);
+    } else if(ev == PROCESS_EVENT_POLL) {
+      expire_timers();
+    }
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
+void
+etimer_request_poll(void)
+{
+  process_poll(&etimer_process);
+}
+/*---------------------------------------------------------------------------*/
 void
 etimer_set(struct etimer *et, clock_time_t interval)
 {
@@ -206,7 +676,7 @@ void
 etimer_adjust(struct etimer *et, int timediff)
 {
   et->timer.start += timediff;
-  update_time();
+  adjust_timer(et);
 }
 /*---------------------------------------------------------------------------*/
 int
@@ -227,41 +697,10 @@ etimer_start_time(struct etimer *et)
   return et->timer.start;
 }
 /*---------------------------------------------------------------------------*/
-int
-etimer_pending(void)
-{
-  return timerlist != NULL;
-}
-/*---------------------------------------------------------------------------*/
-clock_time_t
-etimer_next_expiration_time(void)
-{
-  return etimer_pending() ? next_expiration : 0;
-}
-/*---------------------------------------------------------------------------*/
 void
 etimer_stop(struct etimer *et)
 {
-  struct etimer *t;
-
-  /* First check if et is the first event timer on the list. */
-  if(et == timerlist) {
-    timerlist = timerlist->next;
-    update_time();
-  } else {
-    /* Else walk through the list and try to find the item before the
-       et timer. */
-    for(t = timerlist; t != NULL && t->next != et; t = t->next);
-
-    if(t != NULL) {
-      /* We've found the item before the event timer that we are about
-	 to remove. We point the items next pointer to the event after
-	 the removed item. */
-      t->next = et->next;
-
-      update_time();
-    }
-  }
+  remove_timer(et);
 
   /* Remove the next pointer from the item to be removed. */
   et->next = NULL;
@@ -64,6 +64,30 @@
 
 #include "contiki.h"
 
+/**
+ * \brief      Select the timing wheel backend
+ *
+ *             By default, pending event timers are kept in a single
+ *             unsorted list, which is small but costs O(n) per timer
+ *             operation and per expiry. Setting
+ *             ETIMER_CONF_TIMING_WHEEL to 1 keeps them in a
+ *             hierarchical timing wheel instead, with O(1) insertion
+ *             and expiry cost independent of the number of timers.
+ *             The wheel uses ETIMER_CONF_WHEEL_LEVELS levels of 32
+ *             slots, one pointer per slot.
+ */
+#ifdef ETIMER_CONF_TIMING_WHEEL
+#define ETIMER_TIMING_WHEEL ETIMER_CONF_TIMING_WHEEL
+#else
+#define ETIMER_TIMING_WHEEL 0
+#endif
+
+#ifdef ETIMER_CONF_WHEEL_LEVELS
+#define ETIMER_WHEEL_LEVELS ETIMER_CONF_WHEEL_LEVELS
+#else
+#define ETIMER_WHEEL_LEVELS 4
+#endif
+
 /**
  * A timer.
  *
@@ -76,6 +100,9 @@ struct etimer {
   struct timer timer;
   struct etimer *next;
   struct process *p;
+#if ETIMER_TIMING_WHEEL
+  uint8_t slot;
+#endif
 };
 
 /**
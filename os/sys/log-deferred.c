@@ -0,0 +1,450 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \addtogroup log-deferred
+ * @{
+ *
+ * \file
+ *         Deferred logging: a ring buffer of raw log records, emptied
+ *         by a low-priority process.
+ */
+
+#include "contiki.h"
+#include "sys/log.h"
+
+#if LOG_DEFERRED
+
+#include "sys/log-deferred.h"
+#include "sys/critical.h"
+#include "sys/memory-barrier.h"
+
+#include <string.h>
+/*---------------------------------------------------------------------------*/
+/*
+ * A record is a header of two words followed by its arguments:
+ *  - the address of the descriptor, written last to publish the record
+ *  - nargs | (len << 8), where nargs is the number of words after the
+ *    header and len the length in bytes of an address record
+ *
+ * The strings of the %s conversions are copied after the arguments,
+ * each one starting on a word boundary. len is then the number of
+ * arguments, and the argument of a %s holds the index of the word
+ * where its string starts, or 0 for a NULL pointer.
+ *
+ * Producers reserve space by advancing head in a short critical
+ * section and then fill it in without masking interrupts. The log
+ * process is the only consumer. It stops at the first record that has
+ * been reserved but not yet published, and zeroes every record it has
+ * consumed so that a stale word is never taken for a header.
+ */
+#define HEADER_WORDS 2
+#define RING_MASK    (LOG_DEFERRED_RING_WORDS - 1)
+
+/* The number of records output per run of the log process */
+#define BATCH_SIZE   8
+
+static volatile log_arg_t ring[LOG_DEFERRED_RING_WORDS];
+static volatile uint16_t head;
+static volatile uint16_t tail;
+static volatile uint16_t dropped;
+static uint16_t dropped_reported;
+static uint8_t drain_pending;
+
+#if LOG_DEFERRED_RAW
+/* Records refer to their descriptor by its index in the log_desc section */
+extern const struct log_deferred_desc __start_log_desc[] __attribute__((weak));
+#endif /* LOG_DEFERRED_RAW */
+
+#define RECORDS_PENDING() (head != tail || dropped != dropped_reported)
+
+PROCESS(log_deferred_process, "Deferred log");
+/*---------------------------------------------------------------------------*/
+static void
+write_record(const struct log_deferred_desc *desc,
+             const log_arg_t *args, uint8_t nargs, uint8_t len)
+{
+  int_master_status_t status;
+  uint16_t start;
+  uint8_t i;
+
+  if(nargs > LOG_DEFERRED_MAX_WORDS) {
+    nargs = LOG_DEFERRED_MAX_WORDS;
+  }
+
+  status = critical_enter();
+  if((uint16_t)(head - tail) + HEADER_WORDS + nargs > LOG_DEFERRED_RING_WORDS) {
+    dropped++;
+    critical_exit(status);
+    return;
+  }
+  start = head;
+  head += HEADER_WORDS + nargs;
+  critical_exit(status);
+
+  ring[(start + 1) & RING_MASK] = nargs | ((log_arg_t)len << 8);
+  for(i = 0; i < nargs; i++) {
+    ring[(start + HEADER_WORDS + i) & RING_MASK] = args[i];
+  }
+
+  /* Publish the record once its contents are in place */
+  memory_barrier();
+  ring[start & RING_MASK] = (log_arg_t)desc;
+
+  process_poll(&log_deferred_process);
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Find the arguments that the format converts with %s. Returns a bit
+ * mask of their indices.
+ */
+static uint16_t
+string_args(const char *fmt)
+{
+  uint16_t mask;
+  uint8_t arg;
+
+  mask = 0;
+  arg = 0;
+  while(*fmt != '\0' && arg < LOG_DEFERRED_MAX_ARGS) {
+    if(*fmt++ != '%') {
+      continue;
+    }
+    while(*fmt == '-' || *fmt == '+' || *fmt == ' ' || *fmt == '#' ||
+          *fmt == '0') {
+      fmt++;
+    }
+    if(*fmt == '*') {
+      arg++;
+      fmt++;
+    }
+    while(*fmt >= '0' && *fmt <= '9') {
+      fmt++;
+    }
+    if(*fmt == '.') {
+      fmt++;
+      if(*fmt == '*') {
+        arg++;
+        fmt++;
+      }
+      while(*fmt >= '0' && *fmt <= '9') {
+        fmt++;
+      }
+    }
+    while(*fmt == 'h' || *fmt == 'l' || *fmt == 'z' || *fmt == 'j' ||
+          *fmt == 't' || *fmt == 'L') {
+      fmt++;
+    }
+    if(*fmt == '\0') {
+      break;
+    }
+    if(*fmt == 's' && arg < LOG_DEFERRED_MAX_ARGS) {
+      mask |= 1 << arg;
+    }
+    if(*fmt++ != '%') {
+      arg++;
+    }
+  }
+
+  return mask;
+}
+/*---------------------------------------------------------------------------*/
+void
+log_deferred_write(const struct log_deferred_desc *desc,
+                   const log_arg_t *args, uint8_t nargs)
+{
+  log_arg_t words[LOG_DEFERRED_MAX_WORDS];
+  uint16_t strings;
+  const char *src;
+  char *dst;
+  size_t used;
+  size_t len;
+  uint8_t i;
+
+  strings = nargs > 0 ? string_args(desc->fmt) : 0;
+  if(strings == 0) {
+    write_record(desc, args, nargs, 0);
+    return;
+  }
+
+  /* The caller's strings may be gone by the time the record is output */
+  if(nargs > LOG_DEFERRED_MAX_ARGS) {
+    nargs = LOG_DEFERRED_MAX_ARGS;
+  }
+  memset(words, 0, sizeof(words));
+  memcpy(words, args, nargs * sizeof(log_arg_t));
+  used = 0;
+  for(i = 0; i < nargs; i++) {
+    if(!(strings & (1 << i))) {
+      continue;
+    }
+    src = (const char *)args[i];
+    if(src == NULL || used >= LOG_DEFERRED_MAX_STRING) {
+      words[i] = 0;
+      continue;
+    }
+    words[i] = nargs + used / sizeof(log_arg_t);
+    dst = (char *)&words[nargs] + used;
+    for(len = 0; src[len] != '\0' && used + len < LOG_DEFERRED_MAX_STRING - 1;
+        len++) {
+      dst[len] = src[len];
+    }
+    dst[len] = '\0';
+    used += len + 1;
+    /* The next string starts on a word boundary */
+    used = (used + sizeof(log_arg_t) - 1) / sizeof(log_arg_t) *
+      sizeof(log_arg_t);
+  }
+
+  write_record(desc, words, nargs + used / sizeof(log_arg_t), nargs);
+}
+/*---------------------------------------------------------------------------*/
+void
+log_deferred_write_addr(const struct log_deferred_desc *desc,
+                        const void *addr, uint8_t len)
+{
+  log_arg_t words[LOG_DEFERRED_MAX_ARGS];
+  uint8_t nargs;
+
+  if(addr == NULL) {
+    write_record(desc, NULL, 0, 0);
+    return;
+  }
+
+  if(len > sizeof(words)) {
+    len = sizeof(words);
+  }
+  nargs = (len + sizeof(log_arg_t) - 1) / sizeof(log_arg_t);
+  words[nargs - 1] = 0;
+  memcpy(words, addr, len);
+  write_record(desc, words, nargs, len);
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Take the oldest published record out of the ring. Returns 0 if
+ * there is none.
+ */
+static int
+read_record(const struct log_deferred_desc **desc, log_arg_t *args,
+            uint8_t *nargs, uint8_t *len)
+{
+  log_arg_t word;
+  uint8_t n;
+  uint8_t i;
+
+  if(head == tail) {
+    return 0;
+  }
+  word = ring[tail & RING_MASK];
+  if(word == 0) {
+    /* Reserved by an interrupted producer, not yet published */
+    return 0;
+  }
+  memory_barrier();
+
+  *desc = (const struct log_deferred_desc *)word;
+  word = ring[(tail + 1) & RING_MASK];
+  n = word & 0xff;
+  *len = word >> 8;
+  if(n > LOG_DEFERRED_MAX_WORDS) {
+    n = LOG_DEFERRED_MAX_WORDS;
+  }
+  for(i = 0; i < n; i++) {
+    args[i] = ring[(tail + HEADER_WORDS + i) & RING_MASK];
+  }
+  *nargs = n;
+
+  for(i = 0; i < HEADER_WORDS + n; i++) {
+    ring[(tail + i) & RING_MASK] = 0;
+  }
+  memory_barrier();
+  tail += HEADER_WORDS + n;
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+#if LOG_DEFERRED_RAW
+static void
+output_record(const struct log_deferred_desc *desc, const log_arg_t *args,
+              uint8_t nargs, uint8_t len)
+{
+  uint8_t i;
+
+  LOG_OUTPUT("#LOGD %u %x", (unsigned)(desc - __start_log_desc),
+             (unsigned)(nargs | (len << 8)));
+  for(i = 0; i < nargs; i++) {
+    LOG_OUTPUT(" %lx", (unsigned long)args[i]);
+  }
+  LOG_OUTPUT("\n");
+}
+#else /* LOG_DEFERRED_RAW */
+static void
+output_record(const struct log_deferred_desc *desc, log_arg_t *args,
+              uint8_t nargs, uint8_t len)
+{
+  uint16_t strings;
+  uint8_t i;
+
+  if(desc->flags & LOG_DEFERRED_NEWLINE) {
+    if(LOG_WITH_MODULE_PREFIX) {
+      LOG_OUTPUT_PREFIX(desc->level, desc->levelstr, desc->module);
+    }
+    if(LOG_WITH_LOC) {
+      LOG_OUTPUT("[%s: %d] ", desc->file, desc->line);
+    }
+  }
+
+  if(desc->flags & LOG_DEFERRED_LLADDR) {
+    linkaddr_t addr;
+
+    memcpy(&addr, args, MIN(len, sizeof(addr)));
+    if(desc->flags & LOG_DEFERRED_COMPACT) {
+      log_lladdr_compact(nargs ? &addr : NULL);
+    } else {
+      log_lladdr(nargs ? &addr : NULL);
+    }
+#if NETSTACK_CONF_WITH_IPV6
+  } else if(desc->flags & LOG_DEFERRED_6ADDR) {
+    uip_ipaddr_t addr;
+
+    memcpy(&addr, args, MIN(len, sizeof(addr)));
+    if(desc->flags & LOG_DEFERRED_COMPACT) {
+      log_6addr_compact(nargs ? &addr : NULL);
+    } else {
+      log_6addr(nargs ? &addr : NULL);
+    }
+#endif /* NETSTACK_CONF_WITH_IPV6 */
+  } else {
+    if(len > 0) {
+      /* Point the %s arguments to the strings copied into the record */
+      strings = string_args(desc->fmt);
+      for(i = 0; i < len; i++) {
+        if(!(strings & (1 << i)) || args[i] == 0) {
+          continue;
+        }
+        if(args[i] < len || args[i] >= nargs) {
+          args[i] = (log_arg_t)"";
+        } else {
+          args[i] = (log_arg_t)&args[args[i]];
+        }
+      }
+    }
+
+    /* Unused arguments are ignored by the format */
+    LOG_OUTPUT(desc->fmt, args[0], args[1], args[2], args[3], args[4],
+               args[5], args[6], args[7], args[8], args[9]);
+  }
+}
+#endif /* LOG_DEFERRED_RAW */
+/*---------------------------------------------------------------------------*/
+/*
+ * Output up to max records. Returns non-zero if records are left.
+ */
+static int
+output_records(int max)
+{
+  const struct log_deferred_desc *desc;
+  log_arg_t args[LOG_DEFERRED_MAX_WORDS];
+  uint16_t lost;
+  uint8_t nargs;
+  uint8_t len;
+
+#if LOG_DEFERRED_RAW
+  /* Lets the decoder relocate string arguments */
+  if(head != tail) {
+    LOG_OUTPUT("#LOGD-BASE %lx\n", (unsigned long)(uintptr_t)__start_log_desc);
+  }
+#endif /* LOG_DEFERRED_RAW */
+
+  for(; max > 0; max--) {
+    memset(args, 0, sizeof(args));
+    if(!read_record(&desc, args, &nargs, &len)) {
+      break;
+    }
+    output_record(desc, args, nargs, len);
+  }
+
+  lost = dropped - dropped_reported;
+  if(lost != 0 && head == tail) {
+    dropped_reported += lost;
+#if LOG_DEFERRED_RAW
+    LOG_OUTPUT("#LOGD-DROP %u\n", lost);
+#else /* LOG_DEFERRED_RAW */
+    LOG_OUTPUT("[%u log records dropped]\n", lost);
+#endif /* LOG_DEFERRED_RAW */
+  }
+
+  return RECORDS_PENDING();
+}
+/*---------------------------------------------------------------------------*/
+void
+log_deferred_flush(void)
+{
+  while(output_records(BATCH_SIZE)) {
+    if(head != tail && ring[tail & RING_MASK] == 0) {
+      /* The producer of the next record was interrupted */
+      break;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+uint16_t
+log_deferred_dropped(void)
+{
+  return dropped;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(log_deferred_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  while(1) {
+    if(ev == PROCESS_EVENT_CONTINUE) {
+      drain_pending = 0;
+      output_records(BATCH_SIZE);
+    }
+
+    /* Records are written with a poll, but output from the low
+       priority queue so that logging never delays other work */
+    if(!drain_pending && RECORDS_PENDING()) {
+      if(process_post_prio(PROCESS_CURRENT(), PROCESS_PRIO_LOW,
+                           PROCESS_EVENT_CONTINUE, NULL) == PROCESS_ERR_OK) {
+        drain_pending = 1;
+      } else {
+        process_poll(PROCESS_CURRENT());
+      }
+    }
+
+    PROCESS_WAIT_EVENT();
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
+#endif /* LOG_DEFERRED */
+/** @} */
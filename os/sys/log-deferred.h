@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \addtogroup log
+ * @{
+ *
+ * \defgroup log-deferred Deferred logging
+ * @{
+ *
+ * With LOG_CONF_DEFERRED enabled, the LOG_* macros do not format
+ * anything at the call site. Every call site gets a constant
+ * descriptor, placed in the log_desc linker section, that holds the
+ * format string, module, level and location. A log call only copies a
+ * pointer to the descriptor and its arguments, as raw words, into a
+ * ring buffer. A low-priority process later empties the ring. It
+ * either formats the records with LOG_OUTPUT, or, with
+ * LOG_CONF_DEFERRED_RAW, prints them as hexadecimal words for
+ * tools/log-decoder, which finds the strings in the ELF file.
+ *
+ * Log calls may be made from interrupt context. The restrictions are:
+ * - at most LOG_DEFERRED_MAX_ARGS arguments per call;
+ * - every argument must be an integer or a pointer no wider than a
+ *   pointer (no floating point, no 64-bit integers on 32-bit targets);
+ * - strings passed with %s are copied into the record, at most
+ *   LOG_DEFERRED_MAX_STRING bytes per call; longer ones are truncated.
+ */
+
+#ifndef LOG_DEFERRED_H_
+#define LOG_DEFERRED_H_
+
+#include "sys/process.h"
+
+#include <stdint.h>
+#include <stddef.h>
+/*---------------------------------------------------------------------------*/
+/** The size of the ring buffer, in words. Must be a power of two. */
+#ifdef LOG_CONF_DEFERRED_RING_WORDS
+#define LOG_DEFERRED_RING_WORDS LOG_CONF_DEFERRED_RING_WORDS
+#else /* LOG_CONF_DEFERRED_RING_WORDS */
+#define LOG_DEFERRED_RING_WORDS 256
+#endif /* LOG_CONF_DEFERRED_RING_WORDS */
+
+#if LOG_DEFERRED_RING_WORDS & (LOG_DEFERRED_RING_WORDS - 1)
+#error "LOG_CONF_DEFERRED_RING_WORDS must be a power of two"
+#endif
+
+/** Print raw records for tools/log-decoder instead of formatting them */
+#ifdef LOG_CONF_DEFERRED_RAW
+#define LOG_DEFERRED_RAW LOG_CONF_DEFERRED_RAW
+#else /* LOG_CONF_DEFERRED_RAW */
+#define LOG_DEFERRED_RAW 0
+#endif /* LOG_CONF_DEFERRED_RAW */
+
+/** The maximum number of argument words of a record */
+#define LOG_DEFERRED_MAX_ARGS 10
+
+/**
+ * The space for the %s strings of a record, in bytes, including their
+ * terminating zeros
+ */
+#ifdef LOG_CONF_DEFERRED_MAX_STRING
+#define LOG_DEFERRED_MAX_STRING LOG_CONF_DEFERRED_MAX_STRING
+#else /* LOG_CONF_DEFERRED_MAX_STRING */
+#define LOG_DEFERRED_MAX_STRING 128
+#endif /* LOG_CONF_DEFERRED_MAX_STRING */
+
+/** The maximum number of words of a record, not counting its header */
+#define LOG_DEFERRED_MAX_WORDS                                       \
+  (LOG_DEFERRED_MAX_ARGS +                                           \
+   (LOG_DEFERRED_MAX_STRING + sizeof(uintptr_t) - 1) / sizeof(uintptr_t))
+/*---------------------------------------------------------------------------*/
+typedef uintptr_t log_arg_t;
+
+/* Descriptor flags */
+#define LOG_DEFERRED_NEWLINE 0x01 /**< Starts a new line, print the prefix */
+#define LOG_DEFERRED_LLADDR  0x02 /**< A link-layer address */
+#define LOG_DEFERRED_6ADDR   0x04 /**< An IPv6 address */
+#define LOG_DEFERRED_COMPACT 0x08 /**< Print the address in compact form */
+
+/**
+ * The constant part of a log call. The layout is read by
+ * tools/log-decoder and must be kept in sync with it.
+ */
+struct log_deferred_desc {
+  const char *fmt;
+  const char *module;
+  const char *levelstr;
+  const char *file;
+  uint16_t line;
+  uint8_t level;
+  uint8_t flags;
+};
+
+/* Places a descriptor in the log_desc section */
+#define LOG_DEFERRED_DESC \
+  __attribute__((section("log_desc"), aligned(sizeof(void *))))
+/*---------------------------------------------------------------------------*/
+/* Turn the arguments after the format string into an array of words */
+#define LOG_DEFERRED_FMT(...) LOG_DEFERRED_FMT_(__VA_ARGS__, ~)
+#define LOG_DEFERRED_FMT_(fmt, ...) fmt
+
+#define LOG_DEFERRED_NARGS(...) \
+  LOG_DEFERRED_NARGS_(__VA_ARGS__, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, ~)
+#define LOG_DEFERRED_NARGS_(fmt, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, n, ...) n
+
+#define LOG_DEFERRED_CAT(a, b) LOG_DEFERRED_CAT_(a, b)
+#define LOG_DEFERRED_CAT_(a, b) a##b
+
+#define LOG_DEFERRED_ARGS(...) \
+  LOG_DEFERRED_CAT(LOG_DEFERRED_ARGS_, LOG_DEFERRED_NARGS(__VA_ARGS__))(__VA_ARGS__)
+#define LOG_DEFERRED_W(a) (log_arg_t)(a)
+#define LOG_DEFERRED_ARGS_0(f) NULL, 0
+#define LOG_DEFERRED_ARGS_1(f, a) \
+  (const log_arg_t[]){ LOG_DEFERRED_W(a) }, 1
+#define LOG_DEFERRED_ARGS_2(f, a, b) \
+  (const log_arg_t[]){ LOG_DEFERRED_W(a), LOG_DEFERRED_W(b) }, 2
+#define LOG_DEFERRED_ARGS_3(f, a, b, c) \
+  (const log_arg_t[]){ LOG_DEFERRED_W(a), LOG_DEFERRED_W(b), \
+                       LOG_DEFERRED_W(c) }, 3
+#define LOG_DEFERRED_ARGS_4(f, a, b, c, d) \
+  (const log_arg_t[]){ LOG_DEFERRED_W(a), LOG_DEFERRED_W(b), \
+                       LOG_DEFERRED_W(c), LOG_DEFERRED_W(d) }, 4
+#define LOG_DEFERRED_ARGS_5(f, a, b, c, d, e) \
+  (const log_arg_t[]){ LOG_DEFERRED_W(a), LOG_DEFERRED_W(b), \
+                       LOG_DEFERRED_W(c), LOG_DEFERRED_W(d), \
+                       LOG_DEFERRED_W(e) }, 5
+#define LOG_DEFERRED_ARGS_6(f, a, b, c, d, e, g) \
+  (const log_arg_t[]){ LOG_DEFERRED_W(a), LOG_DEFERRED_W(b), \
+                       LOG_DEFERRED_W(c), LOG_DEFERRED_W(d), \
+                       LOG_DEFERRED_W(e), LOG_DEFERRED_W(g) }, 6
+#define LOG_DEFERRED_ARGS_7(f, a, b, c, d, e, g, h) \
+  (const log_arg_t[]){ LOG_DEFERRED_W(a), LOG_DEFERRED_W(b), \
+                       LOG_DEFERRED_W(c), LOG_DEFERRED_W(d), \
+                       LOG_DEFERRED_W(e), LOG_DEFERRED_W(g), \
+                       LOG_DEFERRED_W(h) }, 7
+#define LOG_DEFERRED_ARGS_8(f, a, b, c, d, e, g, h, i) \
+  (const log_arg_t[]){ LOG_DEFERRED_W(a), LOG_DEFERRED_W(b), \
+                       LOG_DEFERRED_W(c), LOG_DEFERRED_W(d), \
+                       LOG_DEFERRED_W(e), LOG_DEFERRED_W(g), \
+                       LOG_DEFERRED_W(h), LOG_DEFERRED_W(i) }, 8
+#define LOG_DEFERRED_ARGS_9(f, a, b, c, d, e, g, h, i, j) \
+  (const log_arg_t[]){ LOG_DEFERRED_W(a), LOG_DEFERRED_W(b), \
+                       LOG_DEFERRED_W(c), LOG_DEFERRED_W(d), \
+                       LOG_DEFERRED_W(e), LOG_DEFERRED_W(g), \
+                       LOG_DEFERRED_W(h), LOG_DEFERRED_W(i), \
+                       LOG_DEFERRED_W(j) }, 9
+#define LOG_DEFERRED_ARGS_10(f, a, b, c, d, e, g, h, i, j, k) \
+  (const log_arg_t[]){ LOG_DEFERRED_W(a), LOG_DEFERRED_W(b), \
+                       LOG_DEFERRED_W(c), LOG_DEFERRED_W(d), \
+                       LOG_DEFERRED_W(e), LOG_DEFERRED_W(g), \
+                       LOG_DEFERRED_W(h), LOG_DEFERRED_W(i), \
+                       LOG_DEFERRED_W(j), LOG_DEFERRED_W(k) }, 10
+/*---------------------------------------------------------------------------*/
+/**
+ * \brief      Store a log record
+ * \param desc The descriptor of the call site
+ * \param args The arguments of the call
+ * \param nargs The number of arguments
+ *
+ *             Records that do not fit in the ring are dropped and
+ *             counted. Safe to call from interrupt context.
+ */
+void log_deferred_write(const struct log_deferred_desc *desc,
+                        const log_arg_t *args, uint8_t nargs);
+
+/**
+ * \brief      Store an address log record
+ * \param desc The descriptor of the call site
+ * \param addr The address, or NULL
+ * \param len  The length of the address in bytes
+ */
+void log_deferred_write_addr(const struct log_deferred_desc *desc,
+                             const void *addr, uint8_t len);
+
+/**
+ * \brief      Output all pending records right away
+ *
+ *             Useful before a reboot or when the system is about to
+ *             stop. Must not be called from interrupt context.
+ */
+void log_deferred_flush(void);
+
+/**
+ * \brief      Get the number of records dropped because the ring was full
+ */
+uint16_t log_deferred_dropped(void);
+
+PROCESS_NAME(log_deferred_process);
+
+#endif /* LOG_DEFERRED_H_ */
+/** @} */
+/** @} */
@@ -57,6 +57,9 @@
 #if NETSTACK_CONF_WITH_IPV6
 #include "net/ipv6/uip.h"
 #endif /* NETSTACK_CONF_WITH_IPV6 */
+#if LOG_DEFERRED
+#include "sys/log-deferred.h"
+#endif /* LOG_DEFERRED */
 
 /* The different log levels available */
 #define LOG_LEVEL_NONE         0 /* No log */
@@ -103,6 +106,20 @@ extern struct log_module all_modules[];
 
 /* Main log function */
 
+#if LOG_DEFERRED
+#define LOG(newline, level, levelstr, ...) do {  \
+                            if(level <= (LOG_LEVEL)) { \
+                              static const struct log_deferred_desc log_desc \
+                                LOG_DEFERRED_DESC = { \
+                                LOG_DEFERRED_FMT(__VA_ARGS__), LOG_MODULE, \
+                                levelstr, LOG_WITH_LOC ? __FILE__ : NULL, \
+                                __LINE__, level, \
+                                (newline) ? LOG_DEFERRED_NEWLINE : 0 }; \
+                              log_deferred_write(&log_desc, \
+                                                 LOG_DEFERRED_ARGS(__VA_ARGS__)); \
+                            } \
+                          } while (0)
+#else /* LOG_DEFERRED */
 #define LOG(newline, level, levelstr, ...) do {  \
                             if(level <= (LOG_LEVEL)) { \
                               if(newline) { \
@@ -116,6 +133,7 @@ extern struct log_module all_modules[];
                               LOG_OUTPUT(__VA_ARGS__); \
                             } \
                           } while (0)
+#endif /* LOG_DEFERRED */
 
 /* For Cooja annotations */
 #define LOG_ANNOTATE(...) do {  \
@@ -124,6 +142,27 @@ extern struct log_module all_modules[];
                             } \
                         } while (0)
 
+#if LOG_DEFERRED
+/* Addresses are copied into the record and printed when it is output */
+#define LOG_DEFERRED_ADDR(level, addr, len, type) do {  \
+                            if(level <= (LOG_LEVEL)) { \
+                              static const struct log_deferred_desc log_desc \
+                                LOG_DEFERRED_DESC = { \
+                                NULL, LOG_MODULE, NULL, NULL, __LINE__, level, \
+                                (type) | (LOG_WITH_COMPACT_ADDR ? \
+                                          LOG_DEFERRED_COMPACT : 0) }; \
+                              log_deferred_write_addr(&log_desc, addr, len); \
+                            } \
+                        } while (0)
+
+/* Link-layer address */
+#define LOG_LLADDR(level, lladdr) \
+  LOG_DEFERRED_ADDR(level, lladdr, LINKADDR_SIZE, LOG_DEFERRED_LLADDR)
+
+/* IPv6 address */
+#define LOG_6ADDR(level, ipaddr) \
+  LOG_DEFERRED_ADDR(level, ipaddr, sizeof(uip_ipaddr_t), LOG_DEFERRED_6ADDR)
+#else /* LOG_DEFERRED */
 /* Link-layer address */
 #define LOG_LLADDR(level, lladdr) do {  \
                             if(level <= (LOG_LEVEL)) { \
@@ -145,6 +184,7 @@ extern struct log_module all_modules[];
                              } \
                            } \
                          } while (0)
+#endif /* LOG_DEFERRED */
 
 /* More compact versions of LOG macros */
 #define LOG_PRINT(...)         LOG(1, 0, "PRI", __VA_ARGS__)
@@ -44,9 +44,12 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "contiki.h"
 #include "sys/process.h"
+#include "sys/critical.h"
+#include "sys/memory-barrier.h"
 
 /*
  * Pointer to the currently running process structure.
@@ -63,10 +66,87 @@ struct event_data {
   process_event_t ev;
   process_data_t data;
   struct process *p;
+#if PROCESS_CONF_PROFILE
+  uint32_t posted;
+#endif /* PROCESS_CONF_PROFILE */
+};
+
+/*
+ * A ring of pending events. There is one ring per event priority
+ * class when priority queues are enabled, and a single ring
+ * otherwise.
+ */
+struct event_queue {
+  struct event_data *events;
+  process_num_events_t size;
+  process_num_events_t nevents, fevent;
+#if PROCESS_CONF_STATS
+  struct process_queue_stats stats;
+#endif /* PROCESS_CONF_STATS */
 };
 
-static process_num_events_t nevents, fevent;
 static struct event_data events[PROCESS_CONF_NUMEVENTS];
+#if PROCESS_CONF_PRIORITY_QUEUES
+static struct event_data events_high[PROCESS_CONF_NUMEVENTS_HIGH];
+static struct event_data events_low[PROCESS_CONF_NUMEVENTS_LOW];
+
+static struct event_queue queues[PROCESS_NUM_PRIOS] = {
+  { events_high, PROCESS_CONF_NUMEVENTS_HIGH },
+  { events, PROCESS_CONF_NUMEVENTS },
+  { events_low, PROCESS_CONF_NUMEVENTS_LOW },
+};
+#define QUEUE_FOR_PRIO(prio) (&queues[(prio) < PROCESS_NUM_PRIOS ? \
+                                      (prio) : PROCESS_PRIO_NORMAL])
+#define QUEUE_SIZE(q) ((q)->size)
+#else /* PROCESS_CONF_PRIORITY_QUEUES */
+static struct event_queue queues[PROCESS_NUM_PRIOS] = {
+  { events, PROCESS_CONF_NUMEVENTS },
+};
+#define QUEUE_FOR_PRIO(prio) (&queues[0])
+/* A compile-time constant, as with the single ring of old */
+#define QUEUE_SIZE(q) PROCESS_CONF_NUMEVENTS
+#endif /* PROCESS_CONF_PRIORITY_QUEUES */
+
+/*
+ * Wraps an index below twice the ring size into the ring. A compare
+ * and a subtraction, so that no division is needed on MCUs without
+ * hardware divide.
+ */
+static inline process_num_events_t
+ring_index(const struct event_queue *q, unsigned i)
+{
+  return i >= QUEUE_SIZE(q) ? i - QUEUE_SIZE(q) : i;
+}
+
+/* Total number of events pending in all queues */
+static process_num_events_t nevents;
+
+#if PROCESS_NUMEVENTS_ISR
+/*
+ * The ring of events posted from interrupt context. Producers reserve
+ * a slot by advancing isr_head in a short critical section, fill it
+ * in and then mark it ready. The main thread is the only consumer: it
+ * moves ready slots to the event queue and advances isr_tail without
+ * disabling interrupts. Both indices run freely and wrap around.
+ */
+struct isr_event {
+  volatile uint8_t ready;
+  process_event_t ev;
+  process_data_t data;
+  struct process *p;
+#if PROCESS_CONF_PROFILE
+  uint32_t posted;
+#endif /* PROCESS_CONF_PROFILE */
+};
+
+static struct isr_event isr_events[PROCESS_NUMEVENTS_ISR];
+static volatile process_num_events_t isr_head;
+static volatile process_num_events_t isr_tail;
+
+#define ISR_EVENTS_PENDING() (isr_head != isr_tail)
+#else /* PROCESS_NUMEVENTS_ISR */
+#define ISR_EVENTS_PENDING() 0
+#endif /* PROCESS_NUMEVENTS_ISR */
 
 #if PROCESS_CONF_STATS
 process_num_events_t process_maxevents;
@@ -80,6 +160,42 @@ static volatile unsigned char poll_requested;
 
 static void call_process(struct process *p, process_event_t ev, process_data_t data);
 
+#if PROCESS_CONF_PROFILE
+/* Truncates a difference of rtimer timestamps to the width of the
+   rtimer clock, so that wrap-around is handled for any width */
+#define PROFILE_MASK ((uint32_t)(rtimer_clock_t)~(rtimer_clock_t)0)
+
+/* Time spent in processes called from within the current one */
+static uint32_t profile_nested;
+
+static uint32_t
+profile_elapsed(uint32_t since)
+{
+  return ((uint32_t)RTIMER_NOW() - since) & PROFILE_MASK;
+}
+
+static void
+profile_add(struct process_histogram *h, uint32_t sample)
+{
+  uint32_t v;
+  uint8_t b;
+
+  for(b = 0, v = sample; v != 0 && b < PROCESS_PROFILE_BUCKETS - 1; b++) {
+    v >>= 1;
+  }
+  if(h->count[b] != UINT16_MAX) {
+    h->count[b]++;
+  }
+  if(sample > h->max) {
+    h->max = sample;
+  }
+}
+#define PROFILE_DISPATCH(p, since) \
+  profile_add(&(p)->profile.latency, profile_elapsed(since))
+#else /* PROCESS_CONF_PROFILE */
+#define PROFILE_DISPATCH(p, since)
+#endif /* PROCESS_CONF_PROFILE */
+
 #define DEBUG 0
 #if DEBUG
 #include <stdio.h>
@@ -175,6 +291,12 @@ static void
 call_process(struct process *p, process_event_t ev, process_data_t data)
 {
   int ret;
+#if PROCESS_CONF_PROFILE
+  uint32_t start;
+  uint32_t elapsed;
+  uint32_t nested;
+  uint32_t self;
+#endif /* PROCESS_CONF_PROFILE */
 
 #if DEBUG
   if(p->state == PROCESS_STATE_CALLED) {
@@ -187,7 +309,21 @@ call_process(struct process *p, process_event_t ev, process_data_t data)
     PRINTF("process: calling process '%s' with event %d\n", PROCESS_NAME_STRING(p), ev);
     process_current = p;
     p->state = PROCESS_STATE_CALLED;
+#if PROCESS_CONF_PROFILE
+    nested = profile_nested;
+    profile_nested = 0;
+    start = RTIMER_NOW();
+#endif /* PROCESS_CONF_PROFILE */
     ret = p->thread(&p->pt, ev, data);
+#if PROCESS_CONF_PROFILE
+    elapsed = profile_elapsed(start);
+    /* Charge the time of nested calls to the called processes only */
+    self = elapsed > profile_nested ? elapsed - profile_nested : 0;
+    profile_add(&p->profile.run, self);
+    p->profile.calls++;
+    p->profile.total += self;
+    profile_nested = nested + elapsed;
+#endif /* PROCESS_CONF_PROFILE */
     if(ret == PT_EXITED ||
        ret == PT_ENDED ||
        ev == PROCESS_EVENT_EXIT) {
@@ -207,12 +343,24 @@ process_exit(struct process *p)
 void
 process_init(void)
 {
+  uint8_t i;
+
   lastevent = PROCESS_EVENT_MAX;
 
-  nevents = fevent = 0;
+  nevents = 0;
+  for(i = 0; i < PROCESS_NUM_PRIOS; i++) {
+    queues[i].nevents = queues[i].fevent = 0;
+#if PROCESS_CONF_STATS
+    memset(&queues[i].stats, 0, sizeof(queues[i].stats));
+#endif /* PROCESS_CONF_STATS */
+  }
 #if PROCESS_CONF_STATS
   process_maxevents = 0;
 #endif /* PROCESS_CONF_STATS */
+#if PROCESS_NUMEVENTS_ISR
+  memset(isr_events, 0, sizeof(isr_events));
+  isr_head = isr_tail = 0;
+#endif /* PROCESS_NUMEVENTS_ISR */
 
   process_current = process_list = NULL;
 }
@@ -232,6 +380,7 @@ do_poll(void)
     if(p->needspoll) {
       p->state = PROCESS_STATE_RUNNING;
       p->needspoll = 0;
+      PROFILE_DISPATCH(p, p->profile.poll_time);
       call_process(p, PROCESS_EVENT_POLL, NULL);
     }
   }
@@ -249,6 +398,10 @@ do_event(void)
   process_data_t data;
   struct process *receiver;
   struct process *p;
+  struct event_queue *q;
+#if PROCESS_CONF_PROFILE
+  uint32_t posted;
+#endif /* PROCESS_CONF_PROFILE */
 
   /*
    * If there are any events in the queue, take the first one and walk
@@ -260,15 +413,24 @@ do_event(void)
 
   if(nevents > 0) {
 
+    /* Pick the highest-priority queue that holds an event. Lower
+       priority classes are only served when all higher ones are
+       empty. */
+    for(q = queues; q->nevents == 0; q++);
+
     /* There are events that we should deliver. */
-    ev = events[fevent].ev;
+    ev = q->events[q->fevent].ev;
 
-    data = events[fevent].data;
-    receiver = events[fevent].p;
+    data = q->events[q->fevent].data;
+    receiver = q->events[q->fevent].p;
+#if PROCESS_CONF_PROFILE
+    posted = q->events[q->fevent].posted;
+#endif /* PROCESS_CONF_PROFILE */
 
     /* Since we have seen the new event, we move pointer upwards
        and decrease the number of events. */
-    fevent = (fevent + 1) % PROCESS_CONF_NUMEVENTS;
+    q->fevent = ring_index(q, q->fevent + 1);
+    --q->nevents;
     --nevents;
 
     /* If this is a broadcast event, we deliver it to all events, in
@@ -281,6 +443,7 @@ do_event(void)
 	if(poll_requested) {
 	  do_poll();
 	}
+	PROFILE_DISPATCH(p, posted);
 	call_process(p, ev, data);
       }
     } else {
@@ -293,11 +456,49 @@ do_event(void)
       }
 
       /* Make sure that the process actually is running. */
+      PROFILE_DISPATCH(receiver, posted);
       call_process(receiver, ev, data);
     }
   }
 }
 /*---------------------------------------------------------------------------*/
+#if PROCESS_NUMEVENTS_ISR
+/*
+ * Move the events posted from interrupt context to the event queue.
+ */
+static void
+do_isr_events(void)
+{
+  struct isr_event *e;
+#if PROCESS_CONF_PROFILE
+  struct event_queue *q = QUEUE_FOR_PRIO(PROCESS_PRIO_NORMAL);
+#endif /* PROCESS_CONF_PROFILE */
+
+  while(ISR_EVENTS_PENDING()) {
+    e = &isr_events[isr_tail & (PROCESS_NUMEVENTS_ISR - 1)];
+    if(!e->ready) {
+      /* An interrupt handler has reserved the slot but not yet filled
+         it in. The event is picked up on a later run. */
+      break;
+    }
+    memory_barrier();
+
+    if(process_post(e->p, e->ev, e->data) != PROCESS_ERR_OK) {
+      /* Leave the event in the ring until there is room */
+      break;
+    }
+#if PROCESS_CONF_PROFILE
+    /* Measure the latency from the interrupt rather than from here */
+    q->events[ring_index(q, q->fevent + q->nevents - 1)].posted = e->posted;
+#endif /* PROCESS_CONF_PROFILE */
+
+    e->ready = 0;
+    memory_barrier();
+    isr_tail++;
+  }
+}
+#endif /* PROCESS_NUMEVENTS_ISR */
+/*---------------------------------------------------------------------------*/
 int
 process_run(void)
 {
@@ -306,22 +507,35 @@ process_run(void)
     do_poll();
   }
 
+#if PROCESS_NUMEVENTS_ISR
+  /* Queue the events posted from interrupt context */
+  do_isr_events();
+#endif /* PROCESS_NUMEVENTS_ISR */
+
   /* Process one event from the queue */
   do_event();
 
-  return nevents + poll_requested;
+  return nevents + poll_requested + ISR_EVENTS_PENDING();
 }
 /*---------------------------------------------------------------------------*/
 int
 process_nevents(void)
 {
-  return nevents + poll_requested;
+  return nevents + poll_requested + ISR_EVENTS_PENDING();
 }
 /*---------------------------------------------------------------------------*/
 int
 process_post(struct process *p, process_event_t ev, process_data_t data)
+{
+  return process_post_prio(p, PROCESS_PRIO_NORMAL, ev, data);
+}
+/*---------------------------------------------------------------------------*/
+int
+process_post_prio(struct process *p, uint8_t prio,
+                  process_event_t ev, process_data_t data)
 {
   process_num_events_t snum;
+  struct event_queue *q = QUEUE_FOR_PRIO(prio);
 
   if(PROCESS_CURRENT() == NULL) {
     PRINTF("process_post: NULL process posts event %d to process '%s', nevents %d\n",
@@ -332,7 +546,10 @@ process_post(struct process *p, process_event_t ev, process_data_t data)
 	   p == PROCESS_BROADCAST? "<broadcast>": PROCESS_NAME_STRING(p), nevents);
   }
 
-  if(nevents == PROCESS_CONF_NUMEVENTS) {
+  if(q->nevents == QUEUE_SIZE(q)) {
+#if PROCESS_CONF_STATS
+    q->stats.drops++;
+#endif /* PROCESS_CONF_STATS */
 #if DEBUG
     if(p == PROCESS_BROADCAST) {
       printf("soft panic: event queue is full when broadcast event %d was posted from %s\n", ev, PROCESS_NAME_STRING(process_current));
@@ -343,13 +560,20 @@ process_post(struct process *p, process_event_t ev, process_data_t data)
     return PROCESS_ERR_FULL;
   }
 
-  snum = (process_num_events_t)(fevent + nevents) % PROCESS_CONF_NUMEVENTS;
-  events[snum].ev = ev;
-  events[snum].data = data;
-  events[snum].p = p;
+  snum = ring_index(q, q->fevent + q->nevents);
+  q->events[snum].ev = ev;
+  q->events[snum].data = data;
+  q->events[snum].p = p;
+#if PROCESS_CONF_PROFILE
+  q->events[snum].posted = RTIMER_NOW();
+#endif /* PROCESS_CONF_PROFILE */
+  ++q->nevents;
   ++nevents;
 
 #if PROCESS_CONF_STATS
+  if(q->nevents > q->stats.maxevents) {
+    q->stats.maxevents = q->nevents;
+  }
   if(nevents > process_maxevents) {
     process_maxevents = nevents;
   }
@@ -358,6 +582,87 @@ process_post(struct process *p, process_event_t ev, process_data_t data)
   return PROCESS_ERR_OK;
 }
 /*---------------------------------------------------------------------------*/
+int
+process_post_coalesce(struct process *p, process_event_t ev,
+                      process_data_t data)
+{
+  struct event_queue *q = QUEUE_FOR_PRIO(PROCESS_PRIO_NORMAL);
+  struct event_data *e;
+  process_num_events_t i;
+
+  for(i = 0; i < q->nevents; i++) {
+    e = &q->events[ring_index(q, q->fevent + i)];
+    if(e->p == p && e->ev == ev && e->data == data) {
+#if PROCESS_CONF_STATS
+      q->stats.coalesced++;
+#endif /* PROCESS_CONF_STATS */
+      return PROCESS_ERR_OK;
+    }
+  }
+
+  return process_post_prio(p, PROCESS_PRIO_NORMAL, ev, data);
+}
+/*---------------------------------------------------------------------------*/
+#if PROCESS_NUMEVENTS_ISR
+int
+process_post_isr(struct process *p, process_event_t ev, process_data_t data)
+{
+  int_master_status_t status;
+  struct isr_event *e;
+
+  /* Reserve a slot. This is the only part that has to be atomic with
+     respect to other interrupt handlers. */
+  status = critical_enter();
+  if((process_num_events_t)(isr_head - isr_tail) == PROCESS_NUMEVENTS_ISR) {
+    critical_exit(status);
+    return PROCESS_ERR_FULL;
+  }
+  e = &isr_events[isr_head & (PROCESS_NUMEVENTS_ISR - 1)];
+  isr_head++;
+  critical_exit(status);
+
+  e->ev = ev;
+  e->data = data;
+  e->p = p;
+#if PROCESS_CONF_PROFILE
+  e->posted = RTIMER_NOW();
+#endif /* PROCESS_CONF_PROFILE */
+
+  /* Publish the slot once its contents are in place */
+  memory_barrier();
+  e->ready = 1;
+
+  return PROCESS_ERR_OK;
+}
+#endif /* PROCESS_NUMEVENTS_ISR */
+/*---------------------------------------------------------------------------*/
+#if PROCESS_CONF_STATS
+int
+process_get_queue_stats(uint8_t prio, struct process_queue_stats *stats)
+{
+  if(prio > PROCESS_PRIO_LOW || stats == NULL) {
+    return 0;
+  }
+  *stats = QUEUE_FOR_PRIO(prio)->stats;
+  return 1;
+}
+#endif /* PROCESS_CONF_STATS */
+/*---------------------------------------------------------------------------*/
+#if PROCESS_CONF_PROFILE
+void
+process_profile_reset(void)
+{
+  struct process *p;
+  uint32_t poll_time;
+
+  for(p = process_list; p != NULL; p = p->next) {
+    poll_time = p->profile.poll_time;
+    memset(&p->profile, 0, sizeof(p->profile));
+    p->profile.poll_time = poll_time;
+  }
+}
+#endif /* PROCESS_CONF_PROFILE */
+/*---------------------------------------------------------------------------*/
 void
 process_post_synch(struct process *p, process_event_t ev, process_data_t data)
 {
@@ -373,6 +678,11 @@ process_poll(struct process *p)
   if(p != NULL) {
     if(p->state == PROCESS_STATE_RUNNING ||
        p->state == PROCESS_STATE_CALLED) {
+#if PROCESS_CONF_PROFILE
+      if(!p->needspoll) {
+        p->profile.poll_time = RTIMER_NOW();
+      }
+#endif /* PROCESS_CONF_PROFILE */
       p->needspoll = 1;
       poll_requested = 1;
     }
@@ -56,6 +56,8 @@
 #include "sys/pt.h"
 #include "sys/cc.h"
 
+#include <stdint.h>
+
 typedef unsigned char process_event_t;
 typedef void *        process_data_t;
 typedef unsigned char process_num_events_t;
@@ -88,6 +90,121 @@ typedef unsigned char process_num_events_t;
 #define PROCESS_CONF_NUMEVENTS 32
 #endif /* PROCESS_CONF_NUMEVENTS */
 
+/**
+ * \name Event priority classes
+ *
+ * When PROCESS_CONF_PRIORITY_QUEUES is enabled, each priority class
+ * has its own event ring and the scheduler always delivers events
+ * from a higher class before any event of a lower class. The normal
+ * class uses PROCESS_CONF_NUMEVENTS slots; the high and low classes
+ * are sized with PROCESS_CONF_NUMEVENTS_HIGH and
+ * PROCESS_CONF_NUMEVENTS_LOW. With priority queues disabled, all
+ * classes share a single ring and are delivered in FIFO order.
+ *
+ * The sum of all ring sizes must fit in a process_num_events_t.
+ * @{
+ */
+#define PROCESS_PRIO_HIGH     0
+#define PROCESS_PRIO_NORMAL   1
+#define PROCESS_PRIO_LOW      2
+
+#ifndef PROCESS_CONF_PRIORITY_QUEUES
+#define PROCESS_CONF_PRIORITY_QUEUES 0
+#endif /* PROCESS_CONF_PRIORITY_QUEUES */
+
+#if PROCESS_CONF_PRIORITY_QUEUES
+#define PROCESS_NUM_PRIOS     3
+#else /* PROCESS_CONF_PRIORITY_QUEUES */
+#define PROCESS_NUM_PRIOS     1
+#endif /* PROCESS_CONF_PRIORITY_QUEUES */
+
+#ifndef PROCESS_CONF_NUMEVENTS_HIGH
+#define PROCESS_CONF_NUMEVENTS_HIGH 8
+#endif /* PROCESS_CONF_NUMEVENTS_HIGH */
+
+#ifndef PROCESS_CONF_NUMEVENTS_LOW
+#define PROCESS_CONF_NUMEVENTS_LOW 16
+#endif /* PROCESS_CONF_NUMEVENTS_LOW */
+/** @} */
+
+/**
+ * \name Events posted from interrupt context
+ *
+ * process_post() must not be called from interrupt context. When
+ * PROCESS_CONF_NUMEVENTS_ISR is non-zero, interrupt handlers can
+ * instead post events with process_post_isr(). These events are
+ * placed in a separate ring of PROCESS_CONF_NUMEVENTS_ISR slots, and
+ * process_run() moves them to the event queue in posting order.
+ *
+ * The ring size must be a power of two no larger than 128.
+ * @{
+ */
+#ifdef PROCESS_CONF_NUMEVENTS_ISR
+#define PROCESS_NUMEVENTS_ISR PROCESS_CONF_NUMEVENTS_ISR
+#else /* PROCESS_CONF_NUMEVENTS_ISR */
+#define PROCESS_NUMEVENTS_ISR 0
+#endif /* PROCESS_CONF_NUMEVENTS_ISR */
+
+#if PROCESS_NUMEVENTS_ISR & (PROCESS_NUMEVENTS_ISR - 1)
+#error "PROCESS_CONF_NUMEVENTS_ISR must be a power of two"
+#endif
+#if PROCESS_NUMEVENTS_ISR > 128
+#error "PROCESS_CONF_NUMEVENTS_ISR must be at most 128"
+#endif
+/** @} */
+
+/**
+ * \name Scheduling profiler
+ *
+ * When PROCESS_CONF_PROFILE is enabled, the scheduler measures for
+ * each process the time spent in its thread function and the delay
+ * from process_post() or process_poll() until the event is delivered
+ * to the process. Time spent in nested synchronous calls to other
+ * processes is charged to the called process only.
+ *
+ * Both are kept in histograms of PROCESS_PROFILE_BUCKETS buckets of
+ * rtimer ticks: bucket 0 counts samples of zero ticks, bucket i
+ * counts samples in [2^(i-1), 2^i) and the last bucket also counts
+ * all longer samples.
+ * @{
+ */
+#ifndef PROCESS_CONF_PROFILE
+#define PROCESS_CONF_PROFILE 0
+#endif /* PROCESS_CONF_PROFILE */
+
+#ifdef PROCESS_CONF_PROFILE_BUCKETS
+#define PROCESS_PROFILE_BUCKETS PROCESS_CONF_PROFILE_BUCKETS
+#else /* PROCESS_CONF_PROFILE_BUCKETS */
+#define PROCESS_PROFILE_BUCKETS 12
+#endif /* PROCESS_CONF_PROFILE_BUCKETS */
+
+#if PROCESS_PROFILE_BUCKETS < 2
+#error "PROCESS_CONF_PROFILE_BUCKETS must be at least 2"
+#endif
+
+#if PROCESS_CONF_PROFILE
+struct process_histogram {
+  /** The number of samples in each bucket, saturating at UINT16_MAX */
+  uint16_t count[PROCESS_PROFILE_BUCKETS];
+  /** The largest sample, in rtimer ticks */
+  uint32_t max;
+};
+
+struct process_profile {
+  /** Time spent in the thread function per call */
+  struct process_histogram run;
+  /** Delay from posting an event or requesting a poll to delivery */
+  struct process_histogram latency;
+  /** The number of calls to the thread function */
+  uint32_t calls;
+  /** The total time spent in the thread function, in rtimer ticks */
+  uint32_t total;
+  /** The time of the pending poll request */
+  uint32_t poll_time;
+};
+#endif /* PROCESS_CONF_PROFILE */
+/** @} */
+
 #define PROCESS_EVENT_NONE            0x80
 #define PROCESS_EVENT_INIT            0x81
 #define PROCESS_EVENT_POLL            0x82
@@ -323,6 +440,9 @@ struct process {
   PT_THREAD((* thread)(struct pt *, process_event_t, process_data_t));
   struct pt pt;
   unsigned char state, needspoll;
+#if PROCESS_CONF_PROFILE
+  struct process_profile profile;
+#endif /* PROCESS_CONF_PROFILE */
 };
 
 /**
@@ -377,6 +497,124 @@ int process_post(struct process *p, process_event_t ev, process_data_t data);
 void process_post_synch(struct process *p,
                         process_event_t ev, process_data_t data);
 
+/**
+ * Post an asynchronous event with a priority class.
+ *
+ * This function works like process_post(), but places the event in
+ * the queue of the given priority class. Events in a higher class are
+ * delivered before any pending event in a lower class, so that
+ * latency-critical processes do not wait behind bulk work. Events
+ * within one class are delivered in FIFO order. process_post() is
+ * equivalent to posting with PROCESS_PRIO_NORMAL.
+ *
+ * \param p The process to which the event should be posted, or
+ * PROCESS_BROADCAST if the event should be posted to all processes.
+ *
+ * \param prio The priority class: PROCESS_PRIO_HIGH,
+ * PROCESS_PRIO_NORMAL or PROCESS_PRIO_LOW.
+ *
+ * \param ev The event to be posted.
+ *
+ * \param data The auxiliary data to be sent with the event
+ *
+ * \retval PROCESS_ERR_OK The event could be posted.
+ *
+ * \retval PROCESS_ERR_FULL The queue of the priority class was full
+ * and the event could not be posted.
+ */
+int process_post_prio(struct process *p, uint8_t prio,
+                      process_event_t ev, process_data_t data);
+
+/**
+ * Post an asynchronous event, merging it with an identical pending one.
+ *
+ * This function works like process_post(), but if an event with the
+ * same receiver, event number and data is already pending in the
+ * normal priority queue, the new post is merged into it and uses no
+ * queue slot. The merged event keeps its place in the queue and is
+ * delivered once.
+ *
+ * Use this for events that only tell the receiver that something
+ * needs attention, where several pending copies carry no more
+ * information than one.
+ *
+ * \param p The process to which the event should be posted, or
+ * PROCESS_BROADCAST if the event should be posted to all processes.
+ *
+ * \param ev The event to be posted.
+ *
+ * \param data The auxiliary data to be sent with the event
+ *
+ * \retval PROCESS_ERR_OK The event was posted or merged.
+ *
+ * \retval PROCESS_ERR_FULL The event queue was full and the event
+ * could not be posted.
+ */
+int process_post_coalesce(struct process *p, process_event_t ev,
+                          process_data_t data);
+
+#if PROCESS_NUMEVENTS_ISR
+/**
+ * Post an asynchronous event from interrupt context.
+ *
+ * This function can be called from interrupt handlers, including
+ * nested ones, and from the main thread. The event is delivered to
+ * the receiving process(es) with normal priority once process_run()
+ * has moved it to the event queue.
+ *
+ * \param p The process to which the event should be posted, or
+ * PROCESS_BROADCAST if the event should be posted to all processes.
+ *
+ * \param ev The event to be posted.
+ *
+ * \param data The auxiliary data to be sent with the event
+ *
+ * \retval PROCESS_ERR_OK The event could be posted.
+ *
+ * \retval PROCESS_ERR_FULL The interrupt event ring was full and the
+ * event could not be posted.
+ *
+ * \sa PROCESS_CONF_NUMEVENTS_ISR
+ */
+int process_post_isr(struct process *p, process_event_t ev,
+                     process_data_t data);
+#endif /* PROCESS_NUMEVENTS_ISR */
+
+#if PROCESS_CONF_STATS
+/**
+ * Per-class event queue statistics, kept when PROCESS_CONF_STATS is
+ * enabled.
+ */
+struct process_queue_stats {
+  /** The highest number of events that were pending at once */
+  process_num_events_t maxevents;
+  /** The number of events dropped because the queue was full */
+  uint16_t drops;
+  /** The number of posts merged into a pending event */
+  uint16_t coalesced;
+};
+
+/**
+ * Get the event queue statistics of a priority class.
+ *
+ * \param prio The priority class. With priority queues disabled,
+ * all classes refer to the single shared queue.
+ *
+ * \param stats Pointer to a structure that is filled in.
+ *
+ * \retval 1 The statistics were copied.
+ * \retval 0 The priority class does not exist.
+ */
+int process_get_queue_stats(uint8_t prio, struct process_queue_stats *stats);
+#endif /* PROCESS_CONF_STATS */
+
+#if PROCESS_CONF_PROFILE
+/**
+ * Clear the scheduling profile of all running processes.
+ */
+void process_profile_reset(void);
+#endif /* PROCESS_CONF_PROFILE */
+
 /**
  * \brief      Cause a process to exit
  * \param p    The process that is to be exited
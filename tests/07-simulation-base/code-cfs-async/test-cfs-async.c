@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+#include "cfs/cfs.h"
+#include "cfs/cfs-async.h"
+#include "services/unit-test/unit-test.h"
+
+#include <stdio.h>
+#include <string.h>
+/*---------------------------------------------------------------------------*/
+PROCESS(cfs_async_test_process, "cfs-async test process");
+AUTOSTART_PROCESSES(&cfs_async_test_process);
+/*---------------------------------------------------------------------------*/
+#define FILENAME  "cfs-async.tmp"
+#define PART_SIZE 20000
+#define PARTS     3
+
+static uint8_t out[PARTS * PART_SIZE];
+static uint8_t in[PARTS * PART_SIZE + 100];
+static struct cfs_async_op ops[PARTS];
+static struct cfs_async_op *completed[PARTS];
+static int queued[PARTS];
+static int requeued;
+/*---------------------------------------------------------------------------*/
+void
+print_test_report(const unit_test_t *utp)
+{
+  printf("=check-me= ");
+  if(utp->result == unit_test_failure) {
+    printf("FAILED   - %s: exit at L%u\n", utp->descr, utp->exit_line);
+  } else {
+    printf("SUCCEEDED - %s\n", utp->descr);
+  }
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_write, "Queued writes complete in order");
+UNIT_TEST(test_write)
+{
+  int i;
+
+  UNIT_TEST_BEGIN();
+
+  for(i = 0; i < PARTS; i++) {
+    UNIT_TEST_ASSERT(queued[i] == 0);
+    UNIT_TEST_ASSERT(completed[i] == &ops[i]);
+    UNIT_TEST_ASSERT(ops[i].result == PART_SIZE);
+  }
+  UNIT_TEST_ASSERT(requeued == -1);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_read, "Reads return the data and stop at the end");
+UNIT_TEST(test_read)
+{
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(queued[0] == 0);
+  UNIT_TEST_ASSERT(completed[0] == &ops[0]);
+  UNIT_TEST_ASSERT(ops[0].result == sizeof(out));
+  UNIT_TEST_ASSERT(memcmp(in, out, sizeof(out)) == 0);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_error, "A failed operation reports -1");
+UNIT_TEST(test_error)
+{
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(queued[0] == 0);
+  UNIT_TEST_ASSERT(completed[0] == &ops[0]);
+  UNIT_TEST_ASSERT(ops[0].result == -1);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(cfs_async_test_process, ev, data)
+{
+  static int fd;
+  static int i;
+
+  PROCESS_BEGIN();
+
+  printf("Run unit-test\n");
+  printf("---\n");
+
+  for(i = 0; i < sizeof(out); i++) {
+    out[i] = i * 7 + (i >> 8);
+  }
+
+  fd = cfs_open(FILENAME, CFS_WRITE);
+  for(i = 0; i < PARTS; i++) {
+    queued[i] = cfs_async_write(&ops[i], fd, &out[i * PART_SIZE], PART_SIZE);
+  }
+  requeued = cfs_async_write(&ops[0], fd, out, PART_SIZE);
+  for(i = 0; i < PARTS; i++) {
+    PROCESS_WAIT_EVENT_UNTIL(ev == cfs_async_event);
+    completed[i] = data;
+  }
+  cfs_close(fd);
+  UNIT_TEST_RUN(test_write);
+
+  /* Ask for more than there is to get a short read */
+  fd = cfs_open(FILENAME, CFS_READ);
+  queued[0] = cfs_async_read(&ops[0], fd, in, sizeof(in));
+  PROCESS_WAIT_EVENT_UNTIL(ev == cfs_async_event);
+  completed[0] = data;
+  cfs_close(fd);
+  UNIT_TEST_RUN(test_read);
+
+  /* The file descriptor is closed now */
+  queued[0] = cfs_async_read(&ops[0], fd, in, sizeof(in));
+  PROCESS_WAIT_EVENT_UNTIL(ev == cfs_async_event);
+  completed[0] = data;
+  UNIT_TEST_RUN(test_error);
+
+  cfs_remove(FILENAME);
+
+  printf("=check-me= DONE\n");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+#include "cfs/cfs.h"
+#include "cfs/cfs-coffee.h"
+#include "services/unit-test/unit-test.h"
+
+#include <stdio.h>
+#include <string.h>
+/*---------------------------------------------------------------------------*/
+PROCESS(coffee_test_process, "Coffee test process");
+AUTOSTART_PROCESSES(&coffee_test_process);
+/*---------------------------------------------------------------------------*/
+/* The flash is 16 sectors of 16 pages; see project-conf.h */
+#define PAGE_SIZE       256
+#define HEADER_SIZE     26
+#define PAGES(n)        ((n) * PAGE_SIZE - HEADER_SIZE)
+#define FILE_SIZE       768
+#define RECORD_SIZE     64
+#define LOG_SIZE        (8 * RECORD_SIZE)
+#define MAX_STEPS       100
+
+static uint8_t expected[PAGES(32)];
+static uint8_t in[PAGES(32) + 1];
+/*---------------------------------------------------------------------------*/
+void
+print_test_report(const unit_test_t *utp)
+{
+  printf("=check-me= ");
+  if(utp->result == unit_test_failure) {
+    printf("FAILED   - %s: exit at L%u\n", utp->descr, utp->exit_line);
+  } else {
+    printf("SUCCEEDED - %s\n", utp->descr);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+fill(uint8_t *buf, int len, int seed)
+{
+  int i;
+
+  for(i = 0; i < len; i++) {
+    buf[i] = seed + i * 7 + (i >> 8);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static int
+create(const char *name, cfs_offset_t size, int seed)
+{
+  int fd;
+  int r;
+
+  if(cfs_coffee_reserve(name, size) < 0) {
+    return -1;
+  }
+  fd = cfs_open(name, CFS_WRITE);
+  if(fd < 0) {
+    return -1;
+  }
+  fill(in, size, seed);
+  r = cfs_write(fd, in, size);
+  cfs_close(fd);
+  return r == size ? 0 : -1;
+}
+/*---------------------------------------------------------------------------*/
+/* Creates a file with a micro log and fills its log with n records. */
+static int
+create_logged(const char *name, int n)
+{
+  int fd;
+  int i;
+
+  if(cfs_coffee_reserve(name, FILE_SIZE) < 0 ||
+     cfs_coffee_configure_log(name, LOG_SIZE, RECORD_SIZE) < 0) {
+    return -1;
+  }
+  fd = cfs_open(name, CFS_WRITE);
+  if(fd < 0) {
+    return -1;
+  }
+  fill(expected, FILE_SIZE, name[0]);
+  if(cfs_write(fd, expected, FILE_SIZE) != FILE_SIZE) {
+    cfs_close(fd);
+    return -1;
+  }
+  for(i = 0; i < n; i++) {
+    fill(&expected[i * RECORD_SIZE], RECORD_SIZE, name[0] + i + 1);
+    if(cfs_seek(fd, i * RECORD_SIZE, CFS_SEEK_SET) != i * RECORD_SIZE ||
+       cfs_write(fd, &expected[i * RECORD_SIZE], RECORD_SIZE) != RECORD_SIZE) {
+      cfs_close(fd);
+      return -1;
+    }
+  }
+  cfs_close(fd);
+  return 0;
+}
+/*---------------------------------------------------------------------------*/
+static int
+read_fd(int fd, const uint8_t *ref, int len)
+{
+  if(cfs_seek(fd, 0, CFS_SEEK_SET) != 0) {
+    return 0;
+  }
+  return cfs_read(fd, in, len + 1) == len && memcmp(in, ref, len) == 0;
+}
+/*---------------------------------------------------------------------------*/
+static int
+check_file(const char *name, const uint8_t *ref, int len)
+{
+  int fd;
+  int r;
+
+  fd = cfs_open(name, CFS_READ);
+  if(fd < 0) {
+    return 0;
+  }
+  r = read_fd(fd, expected, len);
+  cfs_close(fd);
+  return r;
+}
+/*---------------------------------------------------------------------------*/
+static int
+count_dir(const char *name)
+{
+  struct cfs_dir dir;
+  struct cfs_dirent dirent;
+  int count;
+
+  count = 0;
+  if(cfs_opendir(&dir, "/") < 0) {
+    return -1;
+  }
+  while(cfs_readdir(&dir, &dirent) == 0) {
+    if(strcmp(dirent.name, name) == 0) {
+      count++;
+    }
+  }
+  cfs_closedir(&dir);
+  return count;
+}
+/*---------------------------------------------------------------------------*/
+/* Runs the background work to completion and returns the number of steps. */
+static int
+maintain_all(void)
+{
+  int steps;
+
+  for(steps = 0; steps < MAX_STEPS && cfs_coffee_maintain(); steps++);
+  return steps;
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_merge, "A background merge hides its new extent");
+UNIT_TEST(test_merge)
+{
+  int fd;
+  int steps;
+
+  UNIT_TEST_BEGIN();
+
+  cfs_coffee_format();
+  UNIT_TEST_ASSERT(create_logged("a", 6) == 0);
+
+  /* Six of the eight records are used, so a merge starts */
+  UNIT_TEST_ASSERT(cfs_coffee_maintain() == 1);
+  UNIT_TEST_ASSERT(count_dir("a") == 1);
+  UNIT_TEST_ASSERT(check_file("a", expected, FILE_SIZE));
+
+  fd = cfs_open("a", CFS_READ);
+  UNIT_TEST_ASSERT(fd >= 0);
+  UNIT_TEST_ASSERT(read_fd(fd, expected, FILE_SIZE));
+
+  /* The merge copies one record per step */
+  UNIT_TEST_ASSERT(cfs_coffee_maintain() == 1);
+  UNIT_TEST_ASSERT(count_dir("a") == 1);
+  UNIT_TEST_ASSERT(check_file("a", expected, FILE_SIZE));
+
+  steps = maintain_all();
+  UNIT_TEST_ASSERT(steps >= FILE_SIZE / RECORD_SIZE - 1 && steps < MAX_STEPS);
+  UNIT_TEST_ASSERT(count_dir("a") == 1);
+  UNIT_TEST_ASSERT(check_file("a", expected, FILE_SIZE));
+
+  /* A descriptor opened before the merge follows the merged file */
+  UNIT_TEST_ASSERT(read_fd(fd, expected, FILE_SIZE));
+  cfs_close(fd);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_abort, "A write or remove aborts a background merge");
+UNIT_TEST(test_abort)
+{
+  int fd;
+
+  UNIT_TEST_BEGIN();
+
+  cfs_coffee_format();
+
+  /* A write in the middle of a merge */
+  UNIT_TEST_ASSERT(create_logged("b", 6) == 0);
+  UNIT_TEST_ASSERT(cfs_coffee_maintain() == 1);
+  UNIT_TEST_ASSERT(cfs_coffee_maintain() == 1);
+  UNIT_TEST_ASSERT(cfs_coffee_maintain() == 1);
+
+  fd = cfs_open("b", CFS_READ | CFS_WRITE);
+  UNIT_TEST_ASSERT(fd >= 0);
+  fill(&expected[FILE_SIZE - RECORD_SIZE], RECORD_SIZE, 'B');
+  UNIT_TEST_ASSERT(cfs_seek(fd, FILE_SIZE - RECORD_SIZE, CFS_SEEK_SET) ==
+                   FILE_SIZE - RECORD_SIZE);
+  UNIT_TEST_ASSERT(cfs_write(fd, &expected[FILE_SIZE - RECORD_SIZE],
+                             RECORD_SIZE) == RECORD_SIZE);
+  cfs_close(fd);
+
+  UNIT_TEST_ASSERT(count_dir("b") == 1);
+  UNIT_TEST_ASSERT(check_file("b", expected, FILE_SIZE));
+  UNIT_TEST_ASSERT(maintain_all() < MAX_STEPS);
+  UNIT_TEST_ASSERT(count_dir("b") == 1);
+  UNIT_TEST_ASSERT(check_file("b", expected, FILE_SIZE));
+
+  /* A removal in the middle of a merge */
+  UNIT_TEST_ASSERT(create_logged("c", 6) == 0);
+  UNIT_TEST_ASSERT(cfs_coffee_maintain() == 1);
+  UNIT_TEST_ASSERT(cfs_coffee_maintain() == 1);
+  UNIT_TEST_ASSERT(cfs_remove("c") == 0);
+
+  UNIT_TEST_ASSERT(count_dir("c") == 0);
+  UNIT_TEST_ASSERT(cfs_open("c", CFS_READ) < 0);
+  UNIT_TEST_ASSERT(maintain_all() < MAX_STEPS);
+  UNIT_TEST_ASSERT(count_dir("c") == 0);
+
+  UNIT_TEST_ASSERT(create_logged("c", 0) == 0);
+  UNIT_TEST_ASSERT(count_dir("c") == 1);
+  UNIT_TEST_ASSERT(check_file("c", expected, FILE_SIZE));
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_gc, "Garbage collection keeps a merge in progress");
+UNIT_TEST(test_gc)
+{
+  char name[] = "j0";
+  int junk;
+
+  UNIT_TEST_BEGIN();
+
+  cfs_coffee_format();
+  UNIT_TEST_ASSERT(create_logged("d", 6) == 0);
+  UNIT_TEST_ASSERT(cfs_coffee_maintain() == 1);
+  UNIT_TEST_ASSERT(create("f", PAGES(5), 'f') == 0);
+
+  /* Fill the rest of the flash with files that become garbage */
+  for(junk = 0; junk < 16; junk++) {
+    name[1] = '0' + junk;
+    if(create(name, PAGES(16), junk) < 0) {
+      break;
+    }
+  }
+  UNIT_TEST_ASSERT(junk > 0 && junk < 16);
+  while(junk-- > 0) {
+    name[1] = '0' + junk;
+    UNIT_TEST_ASSERT(cfs_remove(name) == 0);
+  }
+
+  /* This reservation has to collect garbage while "d" is being merged */
+  UNIT_TEST_ASSERT(create("e", PAGES(16), 'e') == 0);
+  UNIT_TEST_ASSERT(count_dir("d") == 1);
+  UNIT_TEST_ASSERT(count_dir("e") == 1);
+  UNIT_TEST_ASSERT(count_dir("f") == 1);
+  UNIT_TEST_ASSERT(check_file("d", expected, FILE_SIZE));
+
+  UNIT_TEST_ASSERT(maintain_all() < MAX_STEPS);
+  UNIT_TEST_ASSERT(count_dir("d") == 1);
+  UNIT_TEST_ASSERT(check_file("d", expected, FILE_SIZE));
+  fill(expected, PAGES(16), 'e');
+  UNIT_TEST_ASSERT(check_file("e", expected, PAGES(16)));
+  fill(expected, PAGES(5), 'f');
+  UNIT_TEST_ASSERT(check_file("f", expected, PAGES(5)));
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_carried, "A carried sector is erased with its extent");
+UNIT_TEST(test_carried)
+{
+  char name[] = "f0";
+  int i;
+
+  UNIT_TEST_BEGIN();
+
+  /*
+   * "j" starts in the first sector and covers all of the second one.
+   * Files that stay active fill all but the last sector.
+   */
+  cfs_coffee_format();
+  UNIT_TEST_ASSERT(create("x", PAGES(2), 'x') == 0);
+  UNIT_TEST_ASSERT(create("j", PAGES(30), 'j') == 0);
+  for(i = 0; i < 13; i++) {
+    name[1] = 'a' + i;
+    UNIT_TEST_ASSERT(create(name, PAGES(16), i) == 0);
+  }
+  UNIT_TEST_ASSERT(cfs_remove("j") == 0);
+
+  /* The second sector is obsolete, but its extent starts in the first one */
+  UNIT_TEST_ASSERT(cfs_coffee_maintain() == 0);
+  fill(expected, PAGES(2), 'x');
+  UNIT_TEST_ASSERT(check_file("x", expected, PAGES(2)));
+
+  /* Both sectors go once the first one is obsolete too */
+  UNIT_TEST_ASSERT(cfs_remove("x") == 0);
+  UNIT_TEST_ASSERT(cfs_coffee_maintain() == 1);
+  UNIT_TEST_ASSERT(cfs_coffee_maintain() == 0);
+
+  UNIT_TEST_ASSERT(create("k", PAGES(32), 'k') == 0);
+  UNIT_TEST_ASSERT(count_dir("k") == 1);
+  fill(expected, PAGES(32), 'k');
+  UNIT_TEST_ASSERT(check_file("k", expected, PAGES(32)));
+  for(i = 0; i < 13; i++) {
+    name[1] = 'a' + i;
+    fill(expected, PAGES(16), i);
+    UNIT_TEST_ASSERT(check_file(name, expected, PAGES(16)));
+  }
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(coffee_test_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  printf("Run unit-test\n");
+  printf("---\n");
+
+  UNIT_TEST_RUN(test_merge);
+  UNIT_TEST_RUN(test_abort);
+  UNIT_TEST_RUN(test_gc);
+  UNIT_TEST_RUN(test_carried);
+
+  printf("=check-me= DONE\n");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
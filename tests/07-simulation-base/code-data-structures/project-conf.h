@@ -34,4 +34,9 @@
 
 #define UNIT_TEST_PRINT_FUNCTION print_test_report
 
+#define MEMB_CONF_STATS 1
+
+#define HEAPMEM_CONF_ARENA_SIZE 1024
+#define HEAPMEM_CONF_SEGREGATED 1
+
 #endif /* PROJECT_CONF_H_ */
@@ -33,9 +33,13 @@
 #include "lib/list.h"
 #include "lib/stack.h"
 #include "lib/queue.h"
+#include "lib/tail-list.h"
 #include "lib/circular-list.h"
 #include "lib/dbl-list.h"
 #include "lib/dbl-circ-list.h"
+#include "lib/memb.h"
+#include "lib/heapmem.h"
+#include "lib/ringbuf-ext.h"
 #include "lib/random.h"
 #include "services/unit-test/unit-test.h"
 
@@ -270,6 +274,10 @@ UNIT_TEST(test_queue)
   queue_enqueue(queue, &elements[1]);
   queue_enqueue(queue, &elements[2]);
 
+  /* Enqueuing a queued element again does not move it to the tail */
+  queue_enqueue(queue, &elements[0]);
+  queue_enqueue(queue, &elements[2]);
+
   UNIT_TEST_ASSERT(queue_dequeue(queue) == &elements[0]);
   UNIT_TEST_ASSERT(queue_dequeue(queue) == &elements[1]);
   UNIT_TEST_ASSERT(queue_dequeue(queue) == &elements[2]);
@@ -282,6 +290,83 @@ UNIT_TEST(test_queue)
   UNIT_TEST_END();
 }
 /*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_tail_list, "Tail-pointer list");
+UNIT_TEST(test_tail_list)
+{
+  TAIL_LIST(tl);
+
+  UNIT_TEST_BEGIN();
+
+  memset(elements, 0, sizeof(elements));
+  tail_list_init(tl);
+
+  /* Starts from empty */
+  UNIT_TEST_ASSERT(tail_list_is_empty(tl) == true);
+  UNIT_TEST_ASSERT(tail_list_head(tl) == NULL);
+  UNIT_TEST_ASSERT(tail_list_tail(tl) == NULL);
+  UNIT_TEST_ASSERT(tail_list_pop(tl) == NULL);
+
+  /* Add two elements, then push one at the start: 2, 0, 1 */
+  tail_list_add(tl, &elements[0]);
+  UNIT_TEST_ASSERT(tail_list_head(tl) == &elements[0]);
+  UNIT_TEST_ASSERT(tail_list_tail(tl) == &elements[0]);
+  tail_list_add(tl, &elements[1]);
+  tail_list_push(tl, &elements[2]);
+  UNIT_TEST_ASSERT(tail_list_head(tl) == &elements[2]);
+  UNIT_TEST_ASSERT(tail_list_tail(tl) == &elements[1]);
+  UNIT_TEST_ASSERT(tail_list_item_next(&elements[2]) == &elements[0]);
+  UNIT_TEST_ASSERT(tail_list_length(tl) == 3);
+
+  /* Elements that are already in the list are not moved */
+  tail_list_add(tl, &elements[1]);
+  tail_list_add(tl, &elements[0]);
+  tail_list_push(tl, &elements[0]);
+  tail_list_push(tl, &elements[2]);
+  UNIT_TEST_ASSERT(tail_list_head(tl) == &elements[2]);
+  UNIT_TEST_ASSERT(tail_list_item_next(&elements[2]) == &elements[0]);
+  UNIT_TEST_ASSERT(tail_list_item_next(&elements[0]) == &elements[1]);
+  UNIT_TEST_ASSERT(tail_list_tail(tl) == &elements[1]);
+  UNIT_TEST_ASSERT(elements[1].next == NULL);
+  UNIT_TEST_ASSERT(tail_list_length(tl) == 3);
+
+  /* Insert after the tail, and remove it again: the tail follows */
+  tail_list_insert(tl, &elements[1], &elements[3]);
+  UNIT_TEST_ASSERT(tail_list_tail(tl) == &elements[3]);
+  tail_list_remove(tl, &elements[3]);
+  UNIT_TEST_ASSERT(tail_list_tail(tl) == &elements[1]);
+  UNIT_TEST_ASSERT(elements[1].next == NULL);
+  UNIT_TEST_ASSERT(tail_list_contains(tl, &elements[3]) == false);
+  UNIT_TEST_ASSERT(tail_list_length(tl) == 3);
+
+  /* Removing an element that is not in the list changes nothing */
+  tail_list_remove(tl, &elements[3]);
+  UNIT_TEST_ASSERT(tail_list_length(tl) == 3);
+
+  /* Appending after a removal of the tail still works */
+  tail_list_add(tl, &elements[4]);
+  UNIT_TEST_ASSERT(elements[1].next == &elements[4]);
+  UNIT_TEST_ASSERT(tail_list_tail(tl) == &elements[4]);
+
+  /* Drain the list in order: 2, 0, 1, 4 */
+  UNIT_TEST_ASSERT(tail_list_pop(tl) == &elements[2]);
+  UNIT_TEST_ASSERT(tail_list_pop(tl) == &elements[0]);
+  UNIT_TEST_ASSERT(tail_list_pop(tl) == &elements[1]);
+  UNIT_TEST_ASSERT(tail_list_pop(tl) == &elements[4]);
+  UNIT_TEST_ASSERT(tail_list_is_empty(tl) == true);
+  UNIT_TEST_ASSERT(tail_list_tail(tl) == NULL);
+  UNIT_TEST_ASSERT(tail_list_length(tl) == 0);
+  UNIT_TEST_ASSERT(tail_list_pop(tl) == NULL);
+  UNIT_TEST_ASSERT(tail_list_length(tl) == 0);
+
+  /* Usable again after being emptied */
+  tail_list_add(tl, &elements[5]);
+  UNIT_TEST_ASSERT(tail_list_head(tl) == &elements[5]);
+  UNIT_TEST_ASSERT(tail_list_tail(tl) == &elements[5]);
+  UNIT_TEST_ASSERT(tail_list_length(tl) == 1);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
 UNIT_TEST_REGISTER(test_csll, "Circular, singly-linked list");
 UNIT_TEST(test_csll)
 {
@@ -1024,6 +1109,274 @@ UNIT_TEST(test_cdll)
   UNIT_TEST_END();
 }
 /*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_memb, "Memory block pool");
+UNIT_TEST(test_memb)
+{
+  MEMB(pool, demo_struct_t, 4);
+  MEMB(byte_pool, uint8_t, 3);
+  demo_struct_t *blocks[4];
+  uint8_t *bytes[3];
+  struct memb *m;
+  int i;
+
+  UNIT_TEST_BEGIN();
+
+  memb_init(&pool);
+  UNIT_TEST_ASSERT(memb_numfree(&pool) == 4);
+
+  /* Allocate all blocks, then one too many */
+  for(i = 0; i < 4; i++) {
+    blocks[i] = memb_alloc(&pool);
+    UNIT_TEST_ASSERT(blocks[i] != NULL);
+    UNIT_TEST_ASSERT(memb_inmemb(&pool, blocks[i]));
+  }
+  UNIT_TEST_ASSERT(blocks[0] != blocks[1] && blocks[1] != blocks[2] &&
+                   blocks[2] != blocks[3] && blocks[0] != blocks[3]);
+  UNIT_TEST_ASSERT(memb_alloc(&pool) == NULL);
+  UNIT_TEST_ASSERT(memb_numfree(&pool) == 0);
+
+  UNIT_TEST_ASSERT(memb_free(&pool, blocks[1]) == 0);
+  UNIT_TEST_ASSERT(memb_free(&pool, blocks[1]) == 0);
+  UNIT_TEST_ASSERT(memb_free(&pool, &elements[0]) == -1);
+  UNIT_TEST_ASSERT(memb_free(&pool, (char *)blocks[2] + 1) == -1);
+  UNIT_TEST_ASSERT(memb_free(&pool, blocks[3]) == 0);
+  UNIT_TEST_ASSERT(memb_numfree(&pool) == 2);
+
+  /* A block written to after it was freed */
+  memset(blocks[1], 0xff, sizeof(*blocks[1]));
+
+  /* Freed blocks are reused, and only once each */
+  blocks[0] = memb_alloc(&pool);
+  blocks[2] = memb_alloc(&pool);
+  UNIT_TEST_ASSERT((blocks[0] == blocks[1] && blocks[2] == blocks[3]) ||
+                   (blocks[0] == blocks[3] && blocks[2] == blocks[1]));
+  UNIT_TEST_ASSERT(memb_alloc(&pool) == NULL);
+
+  /* Blocks too small to hold a free list link */
+  for(i = 0; i < 3; i++) {
+    bytes[i] = memb_alloc(&byte_pool);
+    UNIT_TEST_ASSERT(bytes[i] != NULL);
+  }
+  UNIT_TEST_ASSERT(memb_alloc(&byte_pool) == NULL);
+  UNIT_TEST_ASSERT(memb_free(&byte_pool, bytes[1]) == 0);
+  UNIT_TEST_ASSERT(memb_alloc(&byte_pool) == bytes[1]);
+
+  /* Statistics */
+  UNIT_TEST_ASSERT(pool.high_watermark == 4);
+  UNIT_TEST_ASSERT(pool.failures == 2);
+  for(m = memb_stats_head(); m != NULL && m != &pool; m = m->next);
+  UNIT_TEST_ASSERT(m == &pool);
+  UNIT_TEST_ASSERT(strcmp(m->name, "pool") == 0);
+  for(m = memb_stats_head(); m != NULL && m != &byte_pool; m = m->next);
+  UNIT_TEST_ASSERT(m == &byte_pool);
+
+  memb_free(&pool, blocks[0]);
+  memb_stats_reset();
+  UNIT_TEST_ASSERT(pool.high_watermark == 3);
+  UNIT_TEST_ASSERT(pool.failures == 0);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+/* Allocate from the pool until it is exhausted. Returns the number of
+   blocks allocated, or -1 if a block was handed out twice. */
+static int
+memb_exhaust(struct memb *m, demo_struct_t **blocks, int num)
+{
+  demo_struct_t *b;
+  int n, i;
+
+  for(n = 0; n < num; n++) {
+    if(blocks[n] != NULL) {
+      continue;
+    }
+    b = memb_alloc(m);
+    if(b == NULL) {
+      break;
+    }
+    for(i = 0; i < num; i++) {
+      if(blocks[i] == b) {
+        return -1;
+      }
+    }
+    /* Use the whole block, as a user of the pool would */
+    memset(b, n, sizeof(*b));
+    blocks[n] = b;
+  }
+  for(n = 0, i = 0; i < num; i++) {
+    n += blocks[i] != NULL;
+  }
+  return memb_alloc(m) == NULL ? n : -1;
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_memb_exhaust, "Memory block pool exhaustion");
+UNIT_TEST(test_memb_exhaust)
+{
+  MEMB(pool, demo_struct_t, 8);
+  demo_struct_t *blocks[8];
+  int i;
+
+  UNIT_TEST_BEGIN();
+
+  memb_init(&pool);
+  memset(blocks, 0, sizeof(blocks));
+
+  /* Part of the pool, then a few blocks back, then the rest: freed
+     blocks and never used blocks are both handed out */
+  for(i = 0; i < 3; i++) {
+    blocks[i] = memb_alloc(&pool);
+    UNIT_TEST_ASSERT(blocks[i] != NULL);
+  }
+  UNIT_TEST_ASSERT(memb_free(&pool, blocks[1]) == 0);
+  blocks[1] = NULL;
+  UNIT_TEST_ASSERT(memb_exhaust(&pool, blocks, 8) == 8);
+  UNIT_TEST_ASSERT(memb_numfree(&pool) == 0);
+
+  /* Every other block back, then exhaust again */
+  for(i = 0; i < 8; i += 2) {
+    UNIT_TEST_ASSERT(memb_free(&pool, blocks[i]) == 0);
+    blocks[i] = NULL;
+  }
+  UNIT_TEST_ASSERT(memb_numfree(&pool) == 4);
+  UNIT_TEST_ASSERT(memb_exhaust(&pool, blocks, 8) == 8);
+
+  /* All blocks back, with a write to one after it was freed */
+  for(i = 0; i < 8; i++) {
+    UNIT_TEST_ASSERT(memb_free(&pool, blocks[i]) == 0);
+  }
+  memset(blocks[5], 0xff, sizeof(*blocks[5]));
+  memset(blocks, 0, sizeof(blocks));
+  UNIT_TEST_ASSERT(memb_numfree(&pool) == 8);
+  UNIT_TEST_ASSERT(memb_exhaust(&pool, blocks, 8) == 8);
+
+  for(i = 0; i < 8; i++) {
+    memb_free(&pool, blocks[i]);
+  }
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_heapmem, "Heap memory allocator");
+UNIT_TEST(test_heapmem)
+{
+  heapmem_stats_t stats;
+  char *a, *b, *c, *d;
+  unsigned i;
+
+  UNIT_TEST_BEGIN();
+
+  heapmem_stats(&stats);
+  UNIT_TEST_ASSERT(stats.footprint == 0);
+  UNIT_TEST_ASSERT(stats.fragmentation == 0);
+  UNIT_TEST_ASSERT(stats.largest_free == HEAPMEM_CONF_ARENA_SIZE);
+
+  a = heapmem_alloc(40);
+  b = heapmem_alloc(100);
+  c = heapmem_alloc(40);
+  d = heapmem_alloc(8);
+  UNIT_TEST_ASSERT(a != NULL && b != NULL && c != NULL && d != NULL);
+  heapmem_stats(&stats);
+  UNIT_TEST_ASSERT(stats.chunks == 4);
+  UNIT_TEST_ASSERT(stats.classes[heapmem_size_class(40)].allocated == 2);
+
+  /* A freed chunk is found again through its size class */
+  heapmem_free(b);
+  heapmem_stats(&stats);
+  UNIT_TEST_ASSERT(stats.classes[heapmem_size_class(100)].free == 1);
+  UNIT_TEST_ASSERT(stats.fragmentation > 0);
+  UNIT_TEST_ASSERT(heapmem_alloc(100) == b);
+
+  /* Adjacent free chunks are merged as soon as they are freed */
+  heapmem_free(b);
+  heapmem_free(a);
+  heapmem_stats(&stats);
+  UNIT_TEST_ASSERT(stats.chunks == 3);
+  UNIT_TEST_ASSERT(heapmem_alloc(140) == a);
+
+  /* Growing a chunk keeps its contents */
+  for(i = 0; i < 8; i++) {
+    d[i] = i;
+  }
+  d = heapmem_realloc(d, 200);
+  UNIT_TEST_ASSERT(d != NULL);
+  for(i = 0; i < 8 && d[i] == i; i++);
+  UNIT_TEST_ASSERT(i == 8);
+
+  /* Free chunks at the end of the heap go back to the arena */
+  heapmem_free(a);
+  heapmem_free(d);
+  heapmem_free(c);
+  heapmem_stats(&stats);
+  UNIT_TEST_ASSERT(stats.footprint == 0);
+  UNIT_TEST_ASSERT(stats.fragmentation == 0);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_ringbuf_ext, "Extended ring buffer");
+UNIT_TEST(test_ringbuf_ext)
+{
+  static uint8_t data[256];
+  static struct ringbuf_ext r;
+  uint8_t in[300], out[300];
+  const uint8_t *region;
+  uint8_t *free_region;
+  ringbuf_ext_index_t len;
+  unsigned i;
+
+  UNIT_TEST_BEGIN();
+
+  for(i = 0; i < sizeof(in); i++) {
+    in[i] = i * 7;
+  }
+
+  /* Sizes that are not a power of two, or that do not fit the index
+     type, are rejected */
+  UNIT_TEST_ASSERT(ringbuf_ext_init(&r, data, 0) == 0);
+  UNIT_TEST_ASSERT(ringbuf_ext_init(&r, data, 3) == 0);
+  UNIT_TEST_ASSERT(ringbuf_ext_init(&r, data, 100) == 0);
+  UNIT_TEST_ASSERT(ringbuf_ext_init(&r, data,
+                                    (size_t)(ringbuf_ext_index_t)~0) == 0);
+  UNIT_TEST_ASSERT(ringbuf_ext_init(&r, data,
+                                    (size_t)(ringbuf_ext_index_t)~0 + 1) == 0);
+  UNIT_TEST_ASSERT(ringbuf_ext_init(&r, data, 1) != 0);
+  UNIT_TEST_ASSERT(ringbuf_ext_size(&r) == 1);
+
+  UNIT_TEST_ASSERT(ringbuf_ext_init(&r, data, sizeof(data)) != 0);
+  UNIT_TEST_ASSERT(ringbuf_ext_size(&r) == 256);
+  UNIT_TEST_ASSERT(ringbuf_ext_get(&r) == -1);
+
+  /* The whole buffer can be filled, and a bulk put stops when full */
+  UNIT_TEST_ASSERT(ringbuf_ext_put_bulk(&r, in, 300) == 256);
+  UNIT_TEST_ASSERT(ringbuf_ext_space(&r) == 0);
+  UNIT_TEST_ASSERT(ringbuf_ext_put(&r, 0) == 0);
+  UNIT_TEST_ASSERT(ringbuf_ext_get(&r) == in[0]);
+  UNIT_TEST_ASSERT(ringbuf_ext_get_bulk(&r, out, 100) == 100);
+  UNIT_TEST_ASSERT(memcmp(out, &in[1], 100) == 0);
+
+  /* A bulk put that wraps around the end of the array */
+  UNIT_TEST_ASSERT(ringbuf_ext_put_bulk(&r, in, 60) == 60);
+  UNIT_TEST_ASSERT(ringbuf_ext_elements(&r) == 215);
+  UNIT_TEST_ASSERT(ringbuf_ext_get_bulk(&r, out, 300) == 215);
+  UNIT_TEST_ASSERT(memcmp(out, &in[101], 155) == 0);
+  UNIT_TEST_ASSERT(memcmp(&out[155], in, 60) == 0);
+
+  /* Zero-copy access: the regions end at the end of the array */
+  free_region = ringbuf_ext_peek_put(&r, &len);
+  UNIT_TEST_ASSERT(free_region == &data[60] && len == 196);
+  memcpy(free_region, in, 10);
+  region = ringbuf_ext_peek_get(&r, &len);
+  UNIT_TEST_ASSERT(len == 0);
+  ringbuf_ext_commit_put(&r, 10);
+  region = ringbuf_ext_peek_get(&r, &len);
+  UNIT_TEST_ASSERT(region == &data[60] && len == 10);
+  ringbuf_ext_commit_get(&r, 4);
+  UNIT_TEST_ASSERT(ringbuf_ext_get(&r) == in[4]);
+  UNIT_TEST_ASSERT(ringbuf_ext_elements(&r) == 5);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
 PROCESS_THREAD(data_structure_test_process, ev, data)
 {
   PROCESS_BEGIN();
@@ -1036,9 +1389,14 @@ PROCESS_THREAD(data_structure_test_process, ev, data)
   UNIT_TEST_RUN(test_list);
   UNIT_TEST_RUN(test_stack);
   UNIT_TEST_RUN(test_queue);
+  UNIT_TEST_RUN(test_tail_list);
   UNIT_TEST_RUN(test_csll);
   UNIT_TEST_RUN(test_dll);
   UNIT_TEST_RUN(test_cdll);
+  UNIT_TEST_RUN(test_memb);
+  UNIT_TEST_RUN(test_memb_exhaust);
+  UNIT_TEST_RUN(test_heapmem);
+  UNIT_TEST_RUN(test_ringbuf_ext);
 
   printf("=check-me= DONE\n");
 
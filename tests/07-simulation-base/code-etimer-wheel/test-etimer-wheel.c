@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+#include "services/unit-test/unit-test.h"
+
+#include <stdio.h>
+#include <string.h>
+/*---------------------------------------------------------------------------*/
+PROCESS(etimer_wheel_test_process, "etimer wheel test process");
+AUTOSTART_PROCESSES(&etimer_wheel_test_process);
+/*---------------------------------------------------------------------------*/
+#define MAX_TIMERS 24
+
+/* True if clock time a is before clock time b */
+#define BEFORE(a, b) \
+  ((clock_time_t)((a) - (b)) > ((clock_time_t)~(clock_time_t)0) / 2)
+
+/* Expirations on every level of the wheel, at slot boundaries and
+   beyond the range of a four-level wheel */
+static const clock_time_t level_intervals[] = {
+  1, 2, 31, 32, 33, 64, 100, 1023, 1024, 1025, 3200, 3201,
+  32767, 32768, 32769, 40000, 1048575, 1048576, 1048577, 2100000
+};
+/* Expirations across the wrap-around of the clock */
+static const clock_time_t wrap_intervals[] = {
+  1, 2, 3, 4, 5, 6, 7, 8, 31, 32, 33, 40, 1100, 40000, 1048577
+};
+
+static struct etimer timers[MAX_TIMERS];
+static clock_time_t due[MAX_TIMERS];
+static clock_time_t fired[MAX_TIMERS];
+static int nfired;
+static int late;
+static int out_of_order;
+static int stray;
+/*---------------------------------------------------------------------------*/
+void
+print_test_report(const unit_test_t *utp)
+{
+  printf("=check-me= ");
+  if(utp->result == unit_test_failure) {
+    printf("FAILED   - %s: exit at L%u\n", utp->descr, utp->exit_line);
+  } else {
+    printf("SUCCEEDED - %s\n", utp->descr);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+start(const clock_time_t *intervals, int n)
+{
+  int i;
+
+  nfired = late = out_of_order = stray = 0;
+  memset(fired, 0, sizeof(fired));
+  /* Set in reverse so that the order of insertion does not help */
+  for(i = n - 1; i >= 0; i--) {
+    etimer_set(&timers[i], intervals[i]);
+    due[i] = etimer_expiration_time(&timers[i]);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Records the expiration of a timer. Returns its index. */
+static int
+record(struct etimer *et, int n)
+{
+  static clock_time_t last;
+  int i = et - timers;
+
+  if(i < 0 || i >= n) {
+    stray++;
+    return -1;
+  }
+  fired[i] = clock_time();
+  if(fired[i] != due[i]) {
+    late++;
+  }
+  if(nfired > 0 && BEFORE(fired[i], last)) {
+    out_of_order++;
+  }
+  last = fired[i];
+  nfired++;
+  return i;
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_wrap, "Timers expire in order across the wrap");
+UNIT_TEST(test_wrap)
+{
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(nfired == sizeof(wrap_intervals) / sizeof(clock_time_t));
+  UNIT_TEST_ASSERT(late == 0);
+  UNIT_TEST_ASSERT(out_of_order == 0);
+  UNIT_TEST_ASSERT(stray == 0);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_levels, "Timers on all levels expire in order");
+UNIT_TEST(test_levels)
+{
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(nfired == sizeof(level_intervals) / sizeof(clock_time_t));
+  UNIT_TEST_ASSERT(late == 0);
+  UNIT_TEST_ASSERT(out_of_order == 0);
+  UNIT_TEST_ASSERT(stray == 0);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_restart, "Stopped timers stay quiet, moved ones follow");
+UNIT_TEST(test_restart)
+{
+  UNIT_TEST_BEGIN();
+
+  /* Timer 0 moved the others, then 1 and 3 expired at their new times
+     and 2 and 4 were stopped. Timer 5 expired after all of them. */
+  UNIT_TEST_ASSERT(fired[0] == due[0]);
+  UNIT_TEST_ASSERT(fired[1] == fired[0] + 500);
+  UNIT_TEST_ASSERT(fired[2] == 0 && etimer_expired(&timers[2]));
+  UNIT_TEST_ASSERT(fired[3] == fired[0] + 3000);
+  UNIT_TEST_ASSERT(fired[4] == 0 && etimer_expired(&timers[4]));
+  UNIT_TEST_ASSERT(fired[5] == due[5]);
+  UNIT_TEST_ASSERT(nfired == 4);
+  UNIT_TEST_ASSERT(out_of_order == 0);
+  UNIT_TEST_ASSERT(stray == 0);
+  UNIT_TEST_ASSERT(!etimer_pending());
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_periodic, "Reset timers do not drift");
+UNIT_TEST(test_periodic)
+{
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(nfired == 40);
+  UNIT_TEST_ASSERT(late == 0);
+  UNIT_TEST_ASSERT(stray == 0);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(etimer_wheel_test_process, ev, data)
+{
+  static const clock_time_t restart_intervals[] = {
+    50, 100, 200, 3000, 40000, 40100
+  };
+  static const clock_time_t periodic_intervals[] = { 33, 1000 };
+  static int n;
+  int i;
+
+  PROCESS_BEGIN();
+
+  printf("Run unit-test\n");
+  printf("---\n");
+
+  /* Wait until five ticks before the clock wraps around */
+  etimer_set(&timers[0], (clock_time_t)0 - clock_time() - 5);
+  PROCESS_WAIT_EVENT_UNTIL(ev == PROCESS_EVENT_TIMER);
+
+  n = sizeof(wrap_intervals) / sizeof(clock_time_t);
+  start(wrap_intervals, n);
+  while(nfired < n && stray == 0) {
+    PROCESS_WAIT_EVENT_UNTIL(ev == PROCESS_EVENT_TIMER);
+    record(data, n);
+  }
+  UNIT_TEST_RUN(test_wrap);
+
+  n = sizeof(level_intervals) / sizeof(clock_time_t);
+  start(level_intervals, n);
+  while(nfired < n && stray == 0) {
+    PROCESS_WAIT_EVENT_UNTIL(ev == PROCESS_EVENT_TIMER);
+    record(data, n);
+  }
+  UNIT_TEST_RUN(test_levels);
+
+  n = sizeof(restart_intervals) / sizeof(clock_time_t);
+  start(restart_intervals, n);
+  while(nfired < 4 && stray == 0) {
+    PROCESS_WAIT_EVENT_UNTIL(ev == PROCESS_EVENT_TIMER);
+    if(record(data, n) == 0) {
+      /* Move timer 1 to a higher level and timer 3 further away, and
+         stop a timer on level 1 and one on level 3 */
+      etimer_set(&timers[1], 500);
+      etimer_restart(&timers[3]);
+      etimer_stop(&timers[2]);
+      etimer_stop(&timers[4]);
+    }
+  }
+  UNIT_TEST_RUN(test_restart);
+
+  n = sizeof(periodic_intervals) / sizeof(clock_time_t);
+  start(periodic_intervals, n);
+  nfired = 0;
+  while(nfired < 40 && stray == 0) {
+    PROCESS_WAIT_EVENT_UNTIL(ev == PROCESS_EVENT_TIMER);
+    i = record(data, n);
+    if(i == 0) {
+      etimer_reset(&timers[0]);
+      due[0] += periodic_intervals[0];
+    } else if(i == 1) {
+      etimer_reset(&timers[1]);
+      due[1] += periodic_intervals[1];
+    }
+  }
+  UNIT_TEST_RUN(test_periodic);
+
+  printf("=check-me= DONE\n");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
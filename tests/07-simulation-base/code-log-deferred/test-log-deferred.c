@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+/*
+ * Logs strings from buffers that are overwritten right after the log
+ * call, to check that deferred logging copies them. Build with
+ * LOG_CONF_DEFERRED, and optionally LOG_CONF_DEFERRED_RAW.
+ */
+#include "contiki.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sys/log.h"
+#define LOG_MODULE "Test"
+#define LOG_LEVEL LOG_LEVEL_INFO
+/*---------------------------------------------------------------------------*/
+PROCESS(log_deferred_test_process, "Deferred log test process");
+AUTOSTART_PROCESSES(&log_deferred_test_process);
+/*---------------------------------------------------------------------------*/
+static void
+log_strings(void)
+{
+  char buf[16];
+  char long_buf[200];
+
+  snprintf(buf, sizeof(buf), "node %u", 42);
+  LOG_INFO("str: %s, %u, %s\n", buf, 7, "const");
+  LOG_INFO("pad: [%9s] [%-*s]\n", buf, 9, buf);
+  memset(buf, 'X', sizeof(buf) - 1);
+
+  memset(long_buf, 'a', sizeof(long_buf) - 1);
+  long_buf[sizeof(long_buf) - 1] = '\0';
+  LOG_INFO("long: %s\n", long_buf);
+  memset(long_buf, 'X', sizeof(long_buf) - 1);
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(log_deferred_test_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  log_strings();
+  LOG_INFO("done\n");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+/*
+ * Checks neighbor lookups and the recycling of neighbors in a full
+ * table. Build with DEFINES=NBR_TABLE_CONF_WITH_INDEX=1 to check the
+ * address index.
+ */
+#include "contiki.h"
+#include "net/nbr-table.h"
+#include "lib/random.h"
+#include "services/unit-test/unit-test.h"
+
+#include <stdio.h>
+#include <string.h>
+/*---------------------------------------------------------------------------*/
+PROCESS(nbr_table_test_process, "Neighbor table test process");
+AUTOSTART_PROCESSES(&nbr_table_test_process);
+/*---------------------------------------------------------------------------*/
+#define LOOKUPS   1000
+#define INSERTS   (4 * NBR_TABLE_MAX_NEIGHBORS)
+#define LOCKED    4
+
+struct entry {
+  uint32_t value;
+};
+
+/* Like the IPv6 neighbor cache, the link statistics and the RPL parents:
+ * every neighbor is in the first table, every fourth is also in the
+ * second one, and a few are locked in the third one. */
+NBR_TABLE(struct entry, first);
+NBR_TABLE(struct entry, second);
+NBR_TABLE(struct entry, third);
+
+static linkaddr_t locked[LOCKED];
+static uint32_t next_id;
+/*---------------------------------------------------------------------------*/
+void
+print_test_report(const unit_test_t *utp)
+{
+  printf("=check-me= ");
+  if(utp->result == unit_test_failure) {
+    printf("FAILED   - %s: exit at L%u\n", utp->descr, utp->exit_line);
+  } else {
+    printf("SUCCEEDED - %s\n", utp->descr);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Link-layer addresses that share a prefix, as in a real network */
+static void
+make_lladdr(linkaddr_t *lladdr, uint32_t id)
+{
+  memset(lladdr, 0, sizeof(*lladdr));
+  lladdr->u8[0] = 0x02;
+  lladdr->u8[1] = 0x12;
+  lladdr->u8[LINKADDR_SIZE - 3] = id >> 16;
+  lladdr->u8[LINKADDR_SIZE - 2] = id >> 8;
+  lladdr->u8[LINKADDR_SIZE - 1] = id;
+}
+/*---------------------------------------------------------------------------*/
+static struct entry *
+add(uint32_t id)
+{
+  linkaddr_t lladdr;
+  struct entry *e;
+
+  make_lladdr(&lladdr, id);
+  e = nbr_table_add_lladdr(first, &lladdr, NBR_TABLE_REASON_UNDEFINED, NULL);
+  if(e != NULL) {
+    e->value = id;
+    if(id % 4 == 0) {
+      nbr_table_add_lladdr(second, &lladdr, NBR_TABLE_REASON_UNDEFINED, NULL);
+    }
+  }
+  return e;
+}
+/*---------------------------------------------------------------------------*/
+/* Counts the items of a table. Returns -1 if one of them is not found
+ * by its address. */
+static int
+count(nbr_table_t *table)
+{
+  nbr_table_item_t *item;
+  int n = 0;
+
+  for(item = nbr_table_head(table); item != NULL;
+      item = nbr_table_next(table, item)) {
+    if(nbr_table_get_from_lladdr(table,
+                                 nbr_table_get_lladdr(table, item)) != item) {
+      return -1;
+    }
+    n++;
+  }
+  return n;
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_lookup, "Neighbors are found by their address");
+UNIT_TEST(test_lookup)
+{
+  nbr_table_item_t *item;
+  linkaddr_t lladdr;
+  struct entry *e;
+  uint32_t id;
+  int i;
+
+  UNIT_TEST_BEGIN();
+
+  for(next_id = 1; next_id <= NBR_TABLE_MAX_NEIGHBORS; next_id++) {
+    UNIT_TEST_ASSERT(add(next_id) != NULL);
+  }
+  for(i = 0; i < LOCKED; i++) {
+    make_lladdr(&locked[i], i * 3 + 1);
+    item = nbr_table_add_lladdr(third, &locked[i],
+                                NBR_TABLE_REASON_UNDEFINED, NULL);
+    UNIT_TEST_ASSERT(nbr_table_lock(third, item));
+  }
+  UNIT_TEST_ASSERT(count(first) == NBR_TABLE_MAX_NEIGHBORS);
+  UNIT_TEST_ASSERT(count(second) == NBR_TABLE_MAX_NEIGHBORS / 4);
+  UNIT_TEST_ASSERT(count(third) == LOCKED);
+
+  for(i = 0; i < LOOKUPS; i++) {
+    id = 1 + random_rand() % NBR_TABLE_MAX_NEIGHBORS;
+    make_lladdr(&lladdr, id);
+    e = nbr_table_get_from_lladdr(first, &lladdr);
+    UNIT_TEST_ASSERT(e != NULL && e->value == id);
+  }
+
+  /* Unknown neighbors */
+  for(i = 0; i < LOOKUPS; i++) {
+    make_lladdr(&lladdr, 0x10000 + random_rand());
+    UNIT_TEST_ASSERT(nbr_table_get_from_lladdr(first, &lladdr) == NULL);
+  }
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_replacement,
+                   "A full table replaces neighbors that are not needed");
+UNIT_TEST(test_replacement)
+{
+  linkaddr_t lladdr;
+  struct entry *e;
+  int in_second;
+  int i;
+
+  UNIT_TEST_BEGIN();
+
+  /* New neighbors in a full table: each one replaces another */
+  in_second = count(second);
+  for(i = 0; i < INSERTS; i++) {
+    UNIT_TEST_ASSERT(add(next_id++) != NULL);
+  }
+
+  /* Locked neighbors stay, and neighbors in two tables stay as long as
+   * there are neighbors in one table only */
+  for(i = 0; i < LOCKED; i++) {
+    UNIT_TEST_ASSERT(nbr_table_get_from_lladdr(third, &locked[i]) != NULL);
+  }
+  make_lladdr(&lladdr, next_id - 1);
+  e = nbr_table_get_from_lladdr(first, &lladdr);
+  UNIT_TEST_ASSERT(e != NULL && e->value == next_id - 1);
+  UNIT_TEST_ASSERT(count(first) == NBR_TABLE_MAX_NEIGHBORS);
+  UNIT_TEST_ASSERT(count(second) >= in_second);
+  UNIT_TEST_ASSERT(count(third) == LOCKED);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(nbr_table_test_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  nbr_table_register(first, NULL);
+  nbr_table_register(second, NULL);
+  nbr_table_register(third, NULL);
+
+  printf("Run unit-test\n");
+  printf("---\n");
+
+  UNIT_TEST_RUN(test_lookup);
+  UNIT_TEST_RUN(test_replacement);
+
+  printf("=check-me= DONE\n");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
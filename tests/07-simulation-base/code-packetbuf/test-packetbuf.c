@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+/*
+ * Checks that queued packets are framed intact, the way CSMA queues and
+ * retransmits them. Build with DEFINES=PACKETBUF_CONF_WITH_DESCRIPTORS=1
+ * to check the packet descriptors.
+ */
+#include "contiki.h"
+#include "net/packetbuf.h"
+#include "net/queuebuf.h"
+#include "net/mac/framer/framer-802154.h"
+#include "lib/random.h"
+#include "services/unit-test/unit-test.h"
+
+#include <stdio.h>
+#include <string.h>
+/*---------------------------------------------------------------------------*/
+PROCESS(packetbuf_test_process, "Packetbuf test process");
+AUTOSTART_PROCESSES(&packetbuf_test_process);
+/*---------------------------------------------------------------------------*/
+/* Packets queued before the first one is sent */
+#define QUEUE_DEPTH    4
+
+static const uint16_t sizes[] = { 40, 80, 100 };
+static const uint8_t attempts[] = { 1, 3 };
+
+static uint8_t payload[PACKETBUF_SIZE];
+static uint8_t radio_fifo[PACKETBUF_SIZE];
+static linkaddr_t receiver = { { 1, 2, 3, 4, 5, 6, 7, 8 } };
+/*---------------------------------------------------------------------------*/
+void
+print_test_report(const unit_test_t *utp)
+{
+  printf("=check-me= ");
+  if(utp->result == unit_test_failure) {
+    printf("FAILED   - %s: exit at L%u\n", utp->descr, utp->exit_line);
+  } else {
+    printf("SUCCEEDED - %s\n", utp->descr);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* What the upper layer does: fill the packetbuf and hand it to the MAC,
+   which queues it */
+static struct queuebuf *
+enqueue(uint16_t size, uint8_t seqno)
+{
+  packetbuf_clear();
+  memcpy(packetbuf_dataptr(), payload, size);
+  packetbuf_set_datalen(size);
+  packetbuf_set_addr(PACKETBUF_ADDR_RECEIVER, &receiver);
+  packetbuf_set_attr(PACKETBUF_ATTR_MAC_SEQNO, seqno);
+  packetbuf_set_attr(PACKETBUF_ATTR_FRAME_TYPE, FRAME802154_DATAFRAME);
+  return queuebuf_new_from_packetbuf();
+}
+/*---------------------------------------------------------------------------*/
+/* What the MAC does for each transmission attempt */
+static uint16_t
+transmit(struct queuebuf *q)
+{
+  queuebuf_to_packetbuf_view(q);
+  packetbuf_set_addr(PACKETBUF_ADDR_SENDER, &linkaddr_node_addr);
+  packetbuf_set_attr(PACKETBUF_ATTR_MAC_ACK, 1);
+  if(framer_802154.create() < 0) {
+    return 0;
+  }
+  memcpy(radio_fifo, packetbuf_hdrptr(), packetbuf_totlen());
+  return packetbuf_totlen();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_isolation,
+                   "Queued packets survive packetbuf reuse and framing");
+UNIT_TEST(test_isolation)
+{
+  struct queuebuf *a, *b;
+  uint16_t len, hdr;
+
+  UNIT_TEST_BEGIN();
+
+  a = enqueue(100, 1);
+  b = enqueue(60, 2);
+  UNIT_TEST_ASSERT(a != NULL && b != NULL);
+  len = transmit(a);
+  UNIT_TEST_ASSERT(len > 100);
+  hdr = len - 100;
+
+  packetbuf_clear();
+  memset(packetbuf_dataptr(), 0xff, PACKETBUF_SIZE);
+  len = transmit(b);
+  UNIT_TEST_ASSERT(len == hdr + 60);
+  UNIT_TEST_ASSERT(memcmp(radio_fifo + hdr, payload, 60) == 0);
+
+  /* A retransmission frames the packet again */
+  len = transmit(a);
+  UNIT_TEST_ASSERT(len == hdr + 100);
+  UNIT_TEST_ASSERT(memcmp(radio_fifo + hdr, payload, 100) == 0);
+  UNIT_TEST_ASSERT(queuebuf_datalen(a) == 100);
+  UNIT_TEST_ASSERT(memcmp(queuebuf_dataptr(a), payload, 100) == 0);
+
+  queuebuf_free(a);
+  queuebuf_free(b);
+  UNIT_TEST_ASSERT(queuebuf_numfree() == QUEUEBUF_NUM);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_hops, "Every attempt frames its queued packet");
+UNIT_TEST(test_hops)
+{
+  struct queuebuf *q[QUEUE_DEPTH];
+  uint16_t len;
+  unsigned s, t;
+  int i, j;
+
+  UNIT_TEST_BEGIN();
+
+  for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    for(t = 0; t < sizeof(attempts); t++) {
+      for(i = 0; i < QUEUE_DEPTH; i++) {
+        q[i] = enqueue(sizes[s], i + 1);
+        UNIT_TEST_ASSERT(q[i] != NULL);
+      }
+      for(i = 0; i < QUEUE_DEPTH; i++) {
+        for(j = 0; j < attempts[t]; j++) {
+          len = transmit(q[i]);
+          /* A header, then the payload */
+          UNIT_TEST_ASSERT(len > sizes[s]);
+          UNIT_TEST_ASSERT(memcmp(radio_fifo + len - sizes[s], payload,
+                                  sizes[s]) == 0);
+        }
+        queuebuf_free(q[i]);
+      }
+      UNIT_TEST_ASSERT(queuebuf_numfree() == QUEUEBUF_NUM);
+    }
+  }
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(packetbuf_test_process, ev, data)
+{
+  unsigned i;
+
+  PROCESS_BEGIN();
+
+  for(i = 0; i < sizeof(payload); i++) {
+    payload[i] = random_rand();
+  }
+
+  printf("Run unit-test\n");
+  printf("---\n");
+
+  UNIT_TEST_RUN(test_isolation);
+  UNIT_TEST_RUN(test_hops);
+
+  printf("=check-me= DONE\n");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
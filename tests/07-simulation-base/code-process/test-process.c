@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+#include "lib/random.h"
+#include "services/unit-test/unit-test.h"
+
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+/*---------------------------------------------------------------------------*/
+PROCESS(process_test_process, "Process test process");
+PROCESS(sink_a_process, "Sink A");
+PROCESS(sink_b_process, "Sink B");
+PROCESS(recorder_process, "Recorder");
+AUTOSTART_PROCESSES(&process_test_process);
+/*---------------------------------------------------------------------------*/
+/* Bursts of up to three times the queue size, spread over few enough
+   distinct (process, event, data) tuples for all of them to fit */
+#define ROUNDS         50
+#define MAX_BURST      (3 * PROCESS_CONF_NUMEVENTS)
+#define DATA_VALUES    4
+
+struct burst_result {
+  unsigned long posted;
+  unsigned long dropped;
+  unsigned long merged;
+  unsigned long delivered;
+};
+
+static process_event_t test_event;
+static unsigned long delivered;
+static struct burst_result plain;
+static struct burst_result coalesced;
+
+/* The data of the events delivered to the recorder, in order */
+#define MAX_RECORDED   16
+static uintptr_t recorded[MAX_RECORDED];
+static int nrecorded;
+
+/* One event of each class, twice */
+#define ORDER_EVENTS   6
+static const uint8_t order_prios[ORDER_EVENTS] = {
+  PROCESS_PRIO_LOW, PROCESS_PRIO_NORMAL, PROCESS_PRIO_HIGH,
+  PROCESS_PRIO_LOW, PROCESS_PRIO_NORMAL, PROCESS_PRIO_HIGH
+};
+#if PROCESS_CONF_PRIORITY_QUEUES
+static const uintptr_t order_expected[ORDER_EVENTS] = { 2, 5, 1, 4, 0, 3 };
+#else /* PROCESS_CONF_PRIORITY_QUEUES */
+static const uintptr_t order_expected[ORDER_EVENTS] = { 0, 1, 2, 3, 4, 5 };
+#endif /* PROCESS_CONF_PRIORITY_QUEUES */
+
+#if PROCESS_NUMEVENTS_ISR
+/* One more post than the interrupt event ring holds */
+#define ISR_EVENTS     (PROCESS_NUMEVENTS_ISR + 1)
+#define ISR_DATA       100
+static int isr_results[ISR_EVENTS];
+#endif /* PROCESS_NUMEVENTS_ISR */
+/*---------------------------------------------------------------------------*/
+void
+print_test_report(const unit_test_t *utp)
+{
+  printf("=check-me= ");
+  if(utp->result == unit_test_failure) {
+    printf("FAILED   - %s: exit at L%u\n", utp->descr, utp->exit_line);
+  } else {
+    printf("SUCCEEDED - %s\n", utp->descr);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+print_result(const char *name, const struct burst_result *r)
+{
+  printf("%-9s: %lu posted, %lu dropped (%lu.%lu%%), %lu merged, "
+         "%lu delivered\n", name, r->posted, r->dropped,
+         r->dropped * 100 / r->posted, r->dropped * 1000 / r->posted % 10,
+         r->merged, r->delivered);
+}
+/*---------------------------------------------------------------------------*/
+static uint16_t
+coalesced_count(void)
+{
+  struct process_queue_stats stats;
+
+  process_get_queue_stats(PROCESS_PRIO_NORMAL, &stats);
+  return stats.coalesced;
+}
+/*---------------------------------------------------------------------------*/
+static void
+post_burst(struct burst_result *r, int coalesce)
+{
+  struct process *p;
+  process_data_t data;
+  unsigned n;
+  int ret;
+
+  for(n = 1 + random_rand() % MAX_BURST; n > 0; n--) {
+    p = random_rand() & 1 ? &sink_a_process : &sink_b_process;
+    data = (process_data_t)(uintptr_t)(random_rand() % DATA_VALUES);
+    if(coalesce) {
+      ret = process_post_coalesce(p, test_event, data);
+    } else {
+      ret = process_post(p, test_event, data);
+    }
+    r->posted++;
+    if(ret != PROCESS_ERR_OK) {
+      r->dropped++;
+    }
+  }
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_plain_bursts, "Bursts overflow the plain event queue");
+UNIT_TEST(test_plain_bursts)
+{
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(plain.dropped > 0);
+  UNIT_TEST_ASSERT(plain.merged == 0);
+  UNIT_TEST_ASSERT(plain.delivered + plain.dropped == plain.posted);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_coalesced_bursts, "Coalescing avoids queue overflow");
+UNIT_TEST(test_coalesced_bursts)
+{
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(coalesced.posted == plain.posted);
+  UNIT_TEST_ASSERT(coalesced.dropped == 0);
+  UNIT_TEST_ASSERT(coalesced.merged > 0);
+  UNIT_TEST_ASSERT(coalesced.delivered + coalesced.merged +
+                   coalesced.dropped == coalesced.posted);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_coalesce_tuple, "Only identical events are merged");
+UNIT_TEST(test_coalesce_tuple)
+{
+  int pending;
+  int i;
+
+  UNIT_TEST_BEGIN();
+
+  pending = process_nevents();
+
+  for(i = 0; i < 5; i++) {
+    UNIT_TEST_ASSERT(process_post_coalesce(&sink_a_process, test_event,
+                                           NULL) == PROCESS_ERR_OK);
+  }
+  UNIT_TEST_ASSERT(process_nevents() == pending + 1);
+
+  /* Another receiver, event or data is a different event */
+  process_post_coalesce(&sink_b_process, test_event, NULL);
+  UNIT_TEST_ASSERT(process_nevents() == pending + 2);
+  process_post_coalesce(&sink_a_process, test_event, &pending);
+  UNIT_TEST_ASSERT(process_nevents() == pending + 3);
+  process_post_coalesce(&sink_a_process, PROCESS_EVENT_CONTINUE, NULL);
+  UNIT_TEST_ASSERT(process_nevents() == pending + 4);
+
+  /* Plain posts are never merged */
+  process_post(&sink_a_process, test_event, NULL);
+  UNIT_TEST_ASSERT(process_nevents() == pending + 5);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+static void
+post_order_events(void)
+{
+  int i;
+
+  nrecorded = 0;
+#if PROCESS_CONF_PROFILE
+  process_profile_reset();
+#endif /* PROCESS_CONF_PROFILE */
+  for(i = 0; i < ORDER_EVENTS; i++) {
+    process_post_prio(&recorder_process, order_prios[i], test_event,
+                      (process_data_t)(uintptr_t)i);
+  }
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_priority_order,
+                   "Events are delivered by priority class, then in order");
+UNIT_TEST(test_priority_order)
+{
+  int i;
+
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(nrecorded == ORDER_EVENTS);
+  for(i = 0; i < ORDER_EVENTS; i++) {
+    UNIT_TEST_ASSERT(recorded[i] == order_expected[i]);
+  }
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+#if PROCESS_CONF_PROFILE
+UNIT_TEST_REGISTER(test_profile, "Every delivery is profiled");
+UNIT_TEST(test_profile)
+{
+  uint32_t samples;
+  int i;
+
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(recorder_process.profile.calls == ORDER_EVENTS);
+  samples = 0;
+  for(i = 0; i < PROCESS_PROFILE_BUCKETS; i++) {
+    samples += recorder_process.profile.latency.count[i];
+  }
+  UNIT_TEST_ASSERT(samples == ORDER_EVENTS);
+  samples = 0;
+  for(i = 0; i < PROCESS_PROFILE_BUCKETS; i++) {
+    samples += recorder_process.profile.run.count[i];
+  }
+  UNIT_TEST_ASSERT(samples == ORDER_EVENTS);
+
+  UNIT_TEST_END();
+}
+#endif /* PROCESS_CONF_PROFILE */
+/*---------------------------------------------------------------------------*/
+#if PROCESS_NUMEVENTS_ISR
+static void
+isr_handler(int sig)
+{
+  int i;
+
+  for(i = 0; i < ISR_EVENTS; i++) {
+    isr_results[i] = process_post_isr(&recorder_process, test_event,
+                                      (process_data_t)(uintptr_t)(ISR_DATA + i));
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Posts an event from the main thread, then a burst from a signal
+   handler that stands in for an interrupt */
+static void
+post_isr_events(void)
+{
+  nrecorded = 0;
+  process_post(&recorder_process, test_event, (process_data_t)0);
+  signal(SIGUSR1, isr_handler);
+  raise(SIGUSR1);
+  signal(SIGUSR1, SIG_DFL);
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_isr_events,
+                   "Events posted from interrupts are delivered in order");
+UNIT_TEST(test_isr_events)
+{
+  int i;
+
+  UNIT_TEST_BEGIN();
+
+  /* The ring holds PROCESS_NUMEVENTS_ISR events */
+  for(i = 0; i < PROCESS_NUMEVENTS_ISR; i++) {
+    UNIT_TEST_ASSERT(isr_results[i] == PROCESS_ERR_OK);
+  }
+  UNIT_TEST_ASSERT(isr_results[PROCESS_NUMEVENTS_ISR] == PROCESS_ERR_FULL);
+
+  /* After the event that was already queued, in posting order */
+  UNIT_TEST_ASSERT(nrecorded == 1 + PROCESS_NUMEVENTS_ISR);
+  UNIT_TEST_ASSERT(recorded[0] == 0);
+  for(i = 0; i < PROCESS_NUMEVENTS_ISR; i++) {
+    UNIT_TEST_ASSERT(recorded[1 + i] == ISR_DATA + i);
+  }
+
+  UNIT_TEST_END();
+}
+#endif /* PROCESS_NUMEVENTS_ISR */
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(recorder_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  while(1) {
+    PROCESS_WAIT_EVENT_UNTIL(ev == test_event);
+    if(nrecorded < MAX_RECORDED) {
+      recorded[nrecorded++] = (uintptr_t)data;
+    }
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(sink_a_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  while(1) {
+    PROCESS_WAIT_EVENT_UNTIL(ev == test_event);
+    delivered++;
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(sink_b_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  while(1) {
+    PROCESS_WAIT_EVENT_UNTIL(ev == test_event);
+    delivered++;
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(process_test_process, ev, data)
+{
+  static struct etimer et;
+  static struct burst_result *r;
+  static uint16_t merged;
+  static int round;
+  static int coalesce;
+
+  PROCESS_BEGIN();
+
+  printf("Run unit-test\n");
+  printf("---\n");
+
+  test_event = process_alloc_event();
+  process_start(&sink_a_process, NULL);
+  process_start(&sink_b_process, NULL);
+
+  /* Run the same bursts once with plain posts and once coalescing */
+  for(coalesce = 0; coalesce <= 1; coalesce++) {
+    r = coalesce ? &coalesced : &plain;
+    random_init(0x1234);
+    delivered = 0;
+    merged = coalesced_count();
+
+    for(round = 0; round < ROUNDS; round++) {
+      post_burst(r, coalesce);
+
+      /* Let the sinks drain the queue */
+      do {
+        etimer_set(&et, 1);
+        PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&et));
+      } while(process_nevents() > 0);
+    }
+
+    r->merged = (uint16_t)(coalesced_count() - merged);
+    r->delivered = delivered;
+  }
+
+  print_result("plain", &plain);
+  print_result("coalesced", &coalesced);
+
+  UNIT_TEST_RUN(test_plain_bursts);
+  UNIT_TEST_RUN(test_coalesced_bursts);
+  UNIT_TEST_RUN(test_coalesce_tuple);
+
+  process_start(&recorder_process, NULL);
+
+  post_order_events();
+  do {
+    etimer_set(&et, 1);
+    PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&et));
+  } while(process_nevents() > 0);
+  UNIT_TEST_RUN(test_priority_order);
+#if PROCESS_CONF_PROFILE
+  UNIT_TEST_RUN(test_profile);
+#endif /* PROCESS_CONF_PROFILE */
+
+#if PROCESS_NUMEVENTS_ISR
+  post_isr_events();
+  do {
+    etimer_set(&et, 1);
+    PROCESS_WAIT_EVENT_UNTIL(etimer_expired(&et));
+  } while(process_nevents() > 0);
+  UNIT_TEST_RUN(test_isr_events);
+#endif /* PROCESS_NUMEVENTS_ISR */
+
+  printf("=check-me= DONE\n");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
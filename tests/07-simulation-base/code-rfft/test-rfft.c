@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+#include "lib/ifft.h"
+#include "lib/random.h"
+#include "lib/rfft.h"
+#include "services/unit-test/unit-test.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+/*---------------------------------------------------------------------------*/
+PROCESS(rfft_test_process, "rfft test process");
+AUTOSTART_PROCESSES(&rfft_test_process);
+/*---------------------------------------------------------------------------*/
+/* Worst acceptable signal-to-error ratio against the double reference.
+   With scaling in every stage it drops by about 3 dB per doubling of n
+   for white noise, to 60 dB at 1024 points. */
+#define MIN_SNR_DB     55.0
+#define SPEED_RUNS     500
+
+static int16_t samples[RFFT_MAX_SIZE];
+static int16_t data[RFFT_MAX_SIZE];
+static int16_t xim[RFFT_MAX_SIZE];
+static double ref_re[RFFT_MAX_SIZE / 2 + 1];
+static double ref_im[RFFT_MAX_SIZE / 2 + 1];
+/*---------------------------------------------------------------------------*/
+void
+print_test_report(const unit_test_t *utp)
+{
+  printf("=check-me= ");
+  if(utp->result == unit_test_failure) {
+    printf("FAILED   - %s: exit at L%u\n", utp->descr, utp->exit_line);
+  } else {
+    printf("SUCCEEDED - %s\n", utp->descr);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static uint64_t
+now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+/*---------------------------------------------------------------------------*/
+/* DFT of samples[] divided by n, for bins 0 ... n / 2 */
+static void
+reference_dft(uint16_t n)
+{
+  uint16_t k, i;
+
+  for(k = 0; k <= n / 2; k++) {
+    ref_re[k] = 0;
+    ref_im[k] = 0;
+    for(i = 0; i < n; i++) {
+      ref_re[k] += samples[i] * cos(2 * M_PI * k * i / n);
+      ref_im[k] -= samples[i] * sin(2 * M_PI * k * i / n);
+    }
+    ref_re[k] /= n;
+    ref_im[k] /= n;
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Signal-to-error ratio of the packed spectrum in data[] in dB */
+static double
+snr_db(uint16_t n)
+{
+  double signal, error, re, im;
+  uint16_t k;
+
+  signal = ref_re[0] * ref_re[0] + ref_re[n / 2] * ref_re[n / 2];
+  error = (data[0] - ref_re[0]) * (data[0] - ref_re[0])
+          + (data[1] - ref_re[n / 2]) * (data[1] - ref_re[n / 2]);
+  for(k = 1; k < n / 2; k++) {
+    re = data[2 * k] - ref_re[k];
+    im = data[2 * k + 1] - ref_im[k];
+    signal += ref_re[k] * ref_re[k] + ref_im[k] * ref_im[k];
+    error += re * re + im * im;
+  }
+  return 10 * log10(signal / (error + 1e-9));
+}
+/*---------------------------------------------------------------------------*/
+static void
+make_tone(uint16_t n, double bin, double amplitude)
+{
+  uint16_t i;
+
+  for(i = 0; i < n; i++) {
+    samples[i] = amplitude * sin(2 * M_PI * bin * i / n);
+  }
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_sizes, "Supported transform sizes");
+UNIT_TEST(test_sizes)
+{
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(rfft(data, 0) == -1);
+  UNIT_TEST_ASSERT(rfft(data, 2) == -1);
+  UNIT_TEST_ASSERT(rfft(data, 96) == -1);
+  UNIT_TEST_ASSERT(rfft(data, 2 * RFFT_MAX_SIZE) == -1);
+  UNIT_TEST_ASSERT(rfft(data, RFFT_MIN_SIZE) == 0);
+  UNIT_TEST_ASSERT(rfft(data, RFFT_MAX_SIZE) == 0);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_accuracy, "Accuracy against a double DFT");
+UNIT_TEST(test_accuracy)
+{
+  uint16_t n, i;
+  double snr;
+
+  UNIT_TEST_BEGIN();
+
+  for(n = RFFT_MIN_SIZE; n <= RFFT_MAX_SIZE; n *= 2) {
+    /* full-scale white noise */
+    for(i = 0; i < n; i++) {
+      samples[i] = random_rand();
+    }
+    reference_dft(n);
+    memcpy(data, samples, n * sizeof(int16_t));
+    UNIT_TEST_ASSERT(rfft(data, n) == 0);
+    snr = snr_db(n);
+    printf("n = %4u: %.1f dB\n", n, snr);
+    UNIT_TEST_ASSERT(snr >= MIN_SNR_DB);
+  }
+
+  /* a quiet tone must keep its precision too */
+  n = RFFT_MAX_SIZE;
+  make_tone(n, 100, 1000);
+  reference_dft(n);
+  memcpy(data, samples, n * sizeof(int16_t));
+  rfft(data, n);
+  UNIT_TEST_ASSERT(fabs(data[200] - ref_re[100]) <= 2);
+  UNIT_TEST_ASSERT(fabs(data[201] - ref_im[100]) <= 2);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_tone, "Tone magnitude and windowing");
+UNIT_TEST(test_tone)
+{
+  uint16_t *magnitude = (uint16_t *)data;
+  uint16_t n, k, peak;
+  uint16_t leak_plain, leak_hann;
+
+  UNIT_TEST_BEGIN();
+
+  /* a full-scale tone on a bin shows up as half its amplitude there */
+  n = 256;
+  make_tone(n, 37, 32000);
+  memcpy(data, samples, n * sizeof(int16_t));
+  rfft(data, n);
+  rfft_magnitude(data, magnitude, n);
+  peak = 0;
+  for(k = 1; k <= n / 2; k++) {
+    if(magnitude[k] > magnitude[peak]) {
+      peak = k;
+    }
+  }
+  UNIT_TEST_ASSERT(peak == 37);
+  UNIT_TEST_ASSERT(magnitude[37] >= 15990 && magnitude[37] <= 16010);
+  UNIT_TEST_ASSERT(magnitude[36] < 8 && magnitude[38] < 8);
+
+  /* between two bins, the Hann window cuts leakage into far bins */
+  make_tone(n, 37.5, 32000);
+  memcpy(data, samples, n * sizeof(int16_t));
+  rfft(data, n);
+  rfft_magnitude(data, magnitude, n);
+  leak_plain = magnitude[60];
+
+  memcpy(data, samples, n * sizeof(int16_t));
+  rfft_window(data, n, RFFT_WINDOW_HANN);
+  rfft(data, n);
+  rfft_magnitude(data, magnitude, n);
+  leak_hann = magnitude[60];
+  printf("leakage 22 bins away: %u plain, %u Hann\n", leak_plain, leak_hann);
+  UNIT_TEST_ASSERT(leak_hann * 20 < leak_plain);
+  UNIT_TEST_ASSERT(magnitude[37] > 5000 && magnitude[38] > 5000);
+
+  /* DC and Nyquist are real and land in the first and last magnitude */
+  for(k = 0; k < n; k++) {
+    data[k] = (k & 1) ? 1000 : 3000;
+  }
+  rfft(data, n);
+  rfft_magnitude(data, magnitude, n);
+  UNIT_TEST_ASSERT(magnitude[0] == 2000);
+  UNIT_TEST_ASSERT(magnitude[n / 2] == 1000);
+  UNIT_TEST_ASSERT(magnitude[1] == 0);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_speed, "Speed compared to ifft()");
+UNIT_TEST(test_speed)
+{
+  static const uint16_t sizes[] = { 128, 1024 };
+  uint64_t start, rfft_ns, ifft_ns;
+  uint16_t i, run;
+
+  UNIT_TEST_BEGIN();
+
+  for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+    make_tone(sizes[i], 5, 100);
+
+    start = now_ns();
+    for(run = 0; run < SPEED_RUNS; run++) {
+      memcpy(data, samples, sizes[i] * sizeof(int16_t));
+      rfft(data, sizes[i]);
+    }
+    rfft_ns = (now_ns() - start) / SPEED_RUNS;
+
+    start = now_ns();
+    for(run = 0; run < SPEED_RUNS; run++) {
+      memcpy(data, samples, sizes[i] * sizeof(int16_t));
+      ifft(data, xim, sizes[i]);
+    }
+    ifft_ns = (now_ns() - start) / SPEED_RUNS;
+
+    printf("n = %4u: rfft %lu ns, ifft %lu ns\n", sizes[i],
+           (unsigned long)rfft_ns, (unsigned long)ifft_ns);
+    UNIT_TEST_ASSERT(rfft_ns < ifft_ns);
+  }
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(rfft_test_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  printf("Run unit-test\n");
+  printf("---\n");
+
+  random_init(0x5eed);
+
+  UNIT_TEST_RUN(test_sizes);
+  UNIT_TEST_RUN(test_accuracy);
+  UNIT_TEST_RUN(test_tone);
+  UNIT_TEST_RUN(test_speed);
+
+  printf("=check-me= DONE\n");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
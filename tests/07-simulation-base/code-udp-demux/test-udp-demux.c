@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+/*
+ * Checks that incoming UDP datagrams reach their own connection, also
+ * after connections have been closed and opened again. Build with
+ * DEFINES=UIP_CONF_CONN_HASH=1 to check the connection hash.
+ */
+#include "contiki.h"
+#include "net/ipv6/uip.h"
+#include "net/ipv6/uip-ds6.h"
+#include "net/ipv6/uipbuf.h"
+#include "lib/random.h"
+#include "services/unit-test/unit-test.h"
+
+#include <stdio.h>
+#include <string.h>
+/*---------------------------------------------------------------------------*/
+PROCESS(udp_demux_test_process, "UDP demultiplexing test process");
+PROCESS(sink_process, "UDP sink");
+AUTOSTART_PROCESSES(&udp_demux_test_process);
+/*---------------------------------------------------------------------------*/
+#define REOPENS   200
+#define PAYLOAD   8
+#define PKT_LEN   (UIP_IPUDPH_LEN + PAYLOAD)
+
+static struct uip_udp_conn *conns[UIP_UDP_CONNS];
+static int nconns;
+static struct uip_udp_conn *delivered;
+static unsigned long deliveries;
+/*---------------------------------------------------------------------------*/
+void
+print_test_report(const unit_test_t *utp)
+{
+  printf("=check-me= ");
+  if(utp->result == unit_test_failure) {
+    printf("FAILED   - %s: exit at L%u\n", utp->descr, utp->exit_line);
+  } else {
+    printf("SUCCEEDED - %s\n", utp->descr);
+  }
+}
+/*---------------------------------------------------------------------------*/
+/* Opens a connection owned by the sink, which gets the datagrams */
+static struct uip_udp_conn *
+open_conn(void)
+{
+  struct uip_udp_conn *c;
+
+  PROCESS_CONTEXT_BEGIN(&sink_process);
+  c = udp_new(NULL, 0, NULL);
+  PROCESS_CONTEXT_END(&sink_process);
+  return c;
+}
+/*---------------------------------------------------------------------------*/
+/* Feeds uIP a datagram from fe80::1 for connection i */
+static void
+deliver(int i)
+{
+  uipbuf_clear();
+  memset(uip_buf, 0, PKT_LEN);
+  UIP_IP_BUF->vtc = 0x60;
+  UIP_IP_BUF->proto = UIP_PROTO_UDP;
+  UIP_IP_BUF->ttl = 64;
+  uip_ip6addr(&UIP_IP_BUF->srcipaddr, 0xfe80, 0, 0, 0, 0, 0, 0, 1);
+  uip_ipaddr_copy(&UIP_IP_BUF->destipaddr,
+                  &uip_ds6_get_link_local(-1)->ipaddr);
+  uip_len = PKT_LEN;
+  uipbuf_set_len_field(UIP_IP_BUF, uip_len - UIP_IPH_LEN);
+
+  UIP_UDP_BUF->srcport = UIP_HTONS(5683);
+  UIP_UDP_BUF->destport = conns[i]->lport;
+  UIP_UDP_BUF->udplen = UIP_HTONS(UIP_UDPH_LEN + PAYLOAD);
+  memset(&uip_buf[UIP_IPUDPH_LEN], i, PAYLOAD);
+  UIP_UDP_BUF->udpchksum = ~uip_udpchksum();
+
+  uip_ext_len = 0;
+  delivered = NULL;
+  uip_input();
+}
+/*---------------------------------------------------------------------------*/
+/* Checks that every connection gets its own datagram */
+static int
+deliver_all(void)
+{
+  int c;
+
+  for(c = 0; c < nconns; c++) {
+    deliver(c);
+    if(delivered != conns[c] ||
+       uip_appdata != &uip_buf[UIP_IPUDPH_LEN] ||
+       ((uint8_t *)uip_appdata)[0] != (uint8_t)c) {
+      return 0;
+    }
+  }
+  return 1;
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(sink_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  while(1) {
+    PROCESS_WAIT_EVENT();
+    if(ev == tcpip_event && uip_newdata()) {
+      delivered = uip_udp_conn;
+      deliveries++;
+    }
+  }
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_demux, "Datagrams reach their own connection");
+UNIT_TEST(test_demux)
+{
+  int c;
+
+  UNIT_TEST_BEGIN();
+
+  while(nconns < UIP_UDP_CONNS && (conns[nconns] = open_conn()) != NULL) {
+    nconns++;
+  }
+  UNIT_TEST_ASSERT(nconns == UIP_UDP_CONNS);
+
+  deliveries = 0;
+  UNIT_TEST_ASSERT(deliver_all());
+  UNIT_TEST_ASSERT(deliveries == nconns);
+
+  /* The newest connection again and again */
+  for(c = 0; c < 10; c++) {
+    deliver(nconns - 1);
+    UNIT_TEST_ASSERT(delivered == conns[nconns - 1]);
+  }
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_reopen, "Reopened connections get their datagrams");
+UNIT_TEST(test_reopen)
+{
+  int i, c;
+
+  UNIT_TEST_BEGIN();
+
+  /* Closing a connection and opening another one, which takes a free
+   * local port */
+  for(i = 0; i < REOPENS; i++) {
+    c = random_rand() % nconns;
+    uip_udp_remove(conns[c]);
+    conns[c] = open_conn();
+    UNIT_TEST_ASSERT(conns[c] != NULL);
+  }
+  for(i = 0; i < nconns; i++) {
+    for(c = i + 1; c < nconns; c++) {
+      UNIT_TEST_ASSERT(conns[i]->lport != conns[c]->lport);
+    }
+  }
+
+  deliveries = 0;
+  UNIT_TEST_ASSERT(deliver_all());
+  UNIT_TEST_ASSERT(deliveries == nconns);
+
+  /* A closed connection gets nothing */
+  uip_udp_remove(conns[0]);
+  deliveries = 0;
+  deliver(0);
+  UNIT_TEST_ASSERT(delivered == NULL && deliveries == 0);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(udp_demux_test_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  process_start(&sink_process, NULL);
+
+  printf("Run unit-test\n");
+  printf("---\n");
+
+  UNIT_TEST_RUN(test_demux);
+  UNIT_TEST_RUN(test_reopen);
+
+  printf("=check-me= DONE\n");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/*---------------------------------------------------------------------------*/
+#include "contiki.h"
+#include "net/ipv6/uip.h"
+#include "net/ipv6/uip-udp-packet.h"
+#include "net/ipv6/uip-ds6-route.h"
+#include "net/ipv6/uip-ds6-nbr.h"
+#include "net/netstack.h"
+#include "services/unit-test/unit-test.h"
+
+#include <stdio.h>
+#include <string.h>
+/*---------------------------------------------------------------------------*/
+PROCESS(uip_buffers_test_process, "uIP buffers test process");
+AUTOSTART_PROCESSES(&uip_buffers_test_process);
+/*---------------------------------------------------------------------------*/
+#define RX_LEN   120
+#define REPLY_LEN 40
+#define PORT     5678
+
+#define UIP_IP_BUF_OF(b) ((struct uip_ip_hdr *)(b))
+
+static uint8_t rx[RX_LEN];
+/*---------------------------------------------------------------------------*/
+void
+print_test_report(const unit_test_t *utp)
+{
+  printf("=check-me= ");
+  if(utp->result == unit_test_failure) {
+    printf("FAILED   - %s: exit at L%u\n", utp->descr, utp->exit_line);
+  } else {
+    printf("SUCCEEDED - %s\n", utp->descr);
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void
+fill_rx(void)
+{
+  int i;
+
+  for(i = 0; i < RX_LEN; i++) {
+    rx[i] = i * 13 + 5;
+  }
+  memcpy(uip_buf, rx, RX_LEN);
+  uip_len = RX_LEN;
+  uip_ext_len = 8;
+  uip_last_proto = UIP_PROTO_UDP;
+  uip_appdata = &uip_buf[UIP_IPUDPH_LEN + uip_ext_len];
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_pool, "Buffers keep their own packet state");
+UNIT_TEST(test_pool)
+{
+  int a, b, prev;
+
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(uip_buf_current() == 0);
+  fill_rx();
+
+  a = uip_buf_alloc();
+  b = uip_buf_alloc();
+  UNIT_TEST_ASSERT(a > 0 && b > 0 && a != b);
+  UNIT_TEST_ASSERT(uip_buf_alloc() == -1);
+
+  prev = uip_buf_select(a);
+  UNIT_TEST_ASSERT(prev == 0);
+  UNIT_TEST_ASSERT(uip_buf_current() == a);
+  UNIT_TEST_ASSERT(uip_len == 0 && uip_ext_len == 0 && uip_last_proto == 0);
+  memset(uip_buf, 0xaa, RX_LEN);
+  uip_len = 60;
+
+  /* Freeing the current buffer falls back to buffer 0 */
+  uip_buf_free(a);
+  UNIT_TEST_ASSERT(uip_buf_current() == 0);
+  UNIT_TEST_ASSERT(uip_len == RX_LEN && uip_ext_len == 8);
+  UNIT_TEST_ASSERT(uip_last_proto == UIP_PROTO_UDP);
+  UNIT_TEST_ASSERT(uip_appdata == &uip_buf[UIP_IPUDPH_LEN + 8]);
+  UNIT_TEST_ASSERT(memcmp(uip_buf, rx, RX_LEN) == 0);
+
+  uip_buf_free(b);
+  a = uip_buf_alloc();
+  UNIT_TEST_ASSERT(a > 0);
+  uip_buf_free(a);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_reply, "Sending a reply leaves the received packet");
+UNIT_TEST(test_reply)
+{
+  static struct uip_udp_conn *conn;
+  uip_ipaddr_t addr;
+  int a, b;
+
+  UNIT_TEST_BEGIN();
+
+  uip_create_linklocal_allnodes_mcast(&addr);
+  conn = udp_new(&addr, UIP_HTONS(PORT), NULL);
+  UNIT_TEST_ASSERT(conn != NULL);
+
+  fill_rx();
+  uip_udp_packet_send(conn, uip_appdata, REPLY_LEN);
+
+  UNIT_TEST_ASSERT(uip_buf_current() == 0);
+  UNIT_TEST_ASSERT(uip_len == RX_LEN && uip_ext_len == 8);
+  UNIT_TEST_ASSERT(uip_appdata == &uip_buf[UIP_IPUDPH_LEN + 8]);
+  UNIT_TEST_ASSERT(memcmp(uip_buf, rx, RX_LEN) == 0);
+
+  /* The spare buffer has been returned to the pool */
+  a = uip_buf_alloc();
+  b = uip_buf_alloc();
+  UNIT_TEST_ASSERT(a > 0 && b > 0);
+  uip_buf_free(a);
+  uip_buf_free(b);
+
+  uip_udp_remove(conn);
+  uipbuf_clear();
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+static uip_ipaddr_t router;
+static uip_ds6_defrt_t *defrt;
+static int rx_buf;
+
+#define SENT_MAX 4
+static uint8_t sent[SENT_MAX][RX_LEN];
+static int sent_count;
+/*---------------------------------------------------------------------------*/
+static enum netstack_ip_action
+record_output(const linkaddr_t *localdest)
+{
+  if(sent_count < SENT_MAX && uip_len == RX_LEN) {
+    memcpy(sent[sent_count], uip_buf, RX_LEN);
+  }
+  sent_count++;
+  return NETSTACK_IP_PROCESS;
+}
+
+static struct netstack_ip_packet_processor output_recorder = {
+  .process_output = record_output
+};
+/*---------------------------------------------------------------------------*/
+/* Build a packet from 2001:db8::1 to 2001:db8::<id>, which this node
+   forwards to the default router */
+static void
+fill_forward(uint8_t *b, uint8_t id)
+{
+  int i;
+
+  memset(b, 0, UIP_IPUDPH_LEN);
+  for(i = UIP_IPUDPH_LEN; i < RX_LEN; i++) {
+    b[i] = i * 13 + id;
+  }
+  UIP_IP_BUF_OF(b)->vtc = 0x60;
+  UIP_IP_BUF_OF(b)->len[1] = RX_LEN - UIP_IPH_LEN;
+  UIP_IP_BUF_OF(b)->proto = UIP_PROTO_UDP;
+  UIP_IP_BUF_OF(b)->ttl = 64;
+  uip_ip6addr(&UIP_IP_BUF_OF(b)->srcipaddr, 0x2001, 0xdb8, 0, 0, 0, 0, 0, 1);
+  uip_ip6addr(&UIP_IP_BUF_OF(b)->destipaddr, 0x2001, 0xdb8, 0, 0, 0, 0, 0, id);
+}
+/*---------------------------------------------------------------------------*/
+static void
+receive_forward(uint8_t id)
+{
+  fill_forward(uip_buf, id);
+  uip_len = RX_LEN;
+  tcpip_input();
+}
+/*---------------------------------------------------------------------------*/
+/* Check that a recorded packet is the one built for id, with its hop
+   limit decremented */
+static int
+sent_is(int i, uint8_t id)
+{
+  fill_forward(rx, id);
+  UIP_IP_BUF_OF(rx)->ttl--;
+  return memcmp(sent[i], rx, RX_LEN) == 0;
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_handoff,
+                   "Packets arrive while forwarded packets wait to be sent");
+UNIT_TEST(test_handoff)
+{
+  uip_lladdr_t lladdr;
+
+  UNIT_TEST_BEGIN();
+
+  uip_ip6addr(&router, 0xfe80, 0, 0, 0, 0, 0, 0, 1);
+  defrt = uip_ds6_defrt_add(&router, 0);
+  UNIT_TEST_ASSERT(defrt != NULL);
+  memset(&lladdr, 0x11, sizeof(lladdr));
+  UNIT_TEST_ASSERT(uip_ds6_nbr_add(&router, &lladdr, 1, NBR_REACHABLE,
+                                   NBR_TABLE_REASON_UNDEFINED, NULL) != NULL);
+  netstack_ip_packet_processor_add(&output_recorder);
+
+  /* The first forwarded packet keeps its buffer and waits for
+     tcpip_process; an empty buffer takes over receiving */
+  rx_buf = uip_buf_current();
+  receive_forward(2);
+  UNIT_TEST_ASSERT(sent_count == 0);
+  UNIT_TEST_ASSERT(uip_buf_current() != rx_buf);
+  UNIT_TEST_ASSERT(uip_len == 0);
+
+  /* So does the second one, which arrives in the meantime */
+  rx_buf = uip_buf_current();
+  receive_forward(3);
+  UNIT_TEST_ASSERT(sent_count == 0);
+  UNIT_TEST_ASSERT(uip_buf_current() != rx_buf);
+
+  /* Every buffer now holds a packet: the third one is sent right away
+     from the receive buffer */
+  UNIT_TEST_ASSERT(uip_buf_alloc() == -1);
+  rx_buf = uip_buf_current();
+  receive_forward(4);
+  UNIT_TEST_ASSERT(sent_count == 1);
+  UNIT_TEST_ASSERT(sent_is(0, 4));
+  UNIT_TEST_ASSERT(uip_buf_current() == rx_buf);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+UNIT_TEST_REGISTER(test_handoff_sent,
+                   "Handed-off packets are sent and their buffers freed");
+UNIT_TEST(test_handoff_sent)
+{
+  int a, b;
+
+  UNIT_TEST_BEGIN();
+
+  UNIT_TEST_ASSERT(sent_count == 3);
+  UNIT_TEST_ASSERT(sent_is(1, 2));
+  UNIT_TEST_ASSERT(sent_is(2, 3));
+  UNIT_TEST_ASSERT(uip_buf_current() == rx_buf);
+
+  a = uip_buf_alloc();
+  b = uip_buf_alloc();
+  UNIT_TEST_ASSERT(a >= 0 && b >= 0);
+  UNIT_TEST_ASSERT(a != rx_buf && b != rx_buf);
+  uip_buf_free(a);
+  uip_buf_free(b);
+
+  uip_ds6_defrt_rm(defrt);
+
+  UNIT_TEST_END();
+}
+/*---------------------------------------------------------------------------*/
+PROCESS_THREAD(uip_buffers_test_process, ev, data)
+{
+  PROCESS_BEGIN();
+
+  printf("Run unit-test\n");
+  printf("---\n");
+
+  UNIT_TEST_RUN(test_pool);
+  UNIT_TEST_RUN(test_reply);
+  UNIT_TEST_RUN(test_handoff);
+
+  /* Let tcpip_process send the packets that were handed off */
+  PROCESS_PAUSE();
+
+  UNIT_TEST_RUN(test_handoff_sent);
+
+  printf("=check-me= DONE\n");
+
+  PROCESS_END();
+}
+/*---------------------------------------------------------------------------*/
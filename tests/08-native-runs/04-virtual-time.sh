@@ -0,0 +1,46 @@
+#!/bin/bash
+source ../utils.sh
+
+# Contiki directory
+CONTIKI=$1
+
+# Example code directory
+CODE_DIR=$CONTIKI/examples/libs/timers/
+CODE=all-timers
+
+# The timer process reports every 3 seconds: expect at least one hour
+# of virtual time in a few seconds of real time
+MIN_REPORTS=1200
+
+# Starting Contiki-NG native node
+echo "Starting native node"
+make -C $CODE_DIR TARGET=native NATIVE_VIRTUAL_TIME=1 > make.log 2> make.err
+$CODE_DIR/$CODE.native < /dev/null > $CODE.log 2> $CODE.err &
+CPID=$!
+sleep 4
+
+echo "Closing native node"
+kill_bg $CPID
+
+REPORTS=$(grep -c "Timer process: SUCCESS" $CODE.log)
+if grep -q "Timer process: FAIL" $CODE.log || [ "$REPORTS" -lt $MIN_REPORTS ] ; then
+  echo "==== make.log ====" ; cat make.log;
+  echo "==== make.err ====" ; cat make.err;
+  echo "==== $CODE.log ====" ; tail -20 $CODE.log;
+  echo "==== $CODE.err ====" ; cat $CODE.err;
+
+  printf "%-32s TEST FAIL\n" "$CODE" | tee $CODE.testlog;
+else
+  printf "%-32s TEST OK\n" "$CODE" | tee $CODE.testlog;
+fi
+
+make -C $CODE_DIR TARGET=native NATIVE_VIRTUAL_TIME=1 clean > /dev/null 2>&1
+
+rm make.log
+rm make.err
+rm $CODE.log
+rm $CODE.err
+
+# We do not want Make to stop -> Return 0
+# The Makefile will check if a log contains FAIL at the end
+exit 0
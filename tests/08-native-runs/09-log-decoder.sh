@@ -0,0 +1,52 @@
+#!/bin/bash
+source ../utils.sh
+
+# Contiki directory
+CONTIKI=$1
+
+# Example code directory
+CODE_DIR=$CONTIKI/examples/hello-world/
+CODE=hello-world
+DECODER=$CONTIKI/tools/log-decoder/log-decoder.py
+DEFINES=LOG_CONF_DEFERRED=1,LOG_CONF_DEFERRED_RAW=1
+
+# Starting Contiki-NG native node, logging raw deferred records
+echo "Starting native node"
+make -C $CODE_DIR TARGET=native DEFINES=$DEFINES > make.log 2> make.err
+$CODE_DIR/$CODE.native < /dev/null > $CODE.log 2> $CODE.err &
+CPID=$!
+sleep 2
+
+echo "Closing native node"
+kill_bg $CPID
+
+echo "Decoding the log"
+$DECODER $CODE_DIR/$CODE.native $CODE.log > $CODE.decoded 2>> $CODE.err
+
+# The records must all be decoded, including those with addresses
+if ! grep -q "^#LOGD " $CODE.log || grep -q "^#LOGD " $CODE.decoded ||
+   ! grep -q "^\[INFO: Main      \] Link-layer address: 0102.0304.0506.0708$" $CODE.decoded ||
+   ! grep -q "^\[INFO: Main      \] Tentative link-local IPv6 address: fe80::302:304:506:708$" $CODE.decoded ; then
+  echo "==== make.log ====" ; cat make.log;
+  echo "==== make.err ====" ; cat make.err;
+  echo "==== $CODE.log ====" ; cat $CODE.log;
+  echo "==== $CODE.decoded ====" ; cat $CODE.decoded;
+  echo "==== $CODE.err ====" ; cat $CODE.err;
+
+  printf "%-32s TEST FAIL\n" "log-decoder" | tee log-decoder.testlog;
+else
+  cp $CODE.decoded log-decoder.testlog
+  printf "%-32s TEST OK\n" "log-decoder" | tee log-decoder.testlog;
+fi
+
+make -C $CODE_DIR TARGET=native clean > /dev/null 2>&1
+
+rm make.log
+rm make.err
+rm $CODE.log
+rm $CODE.decoded
+rm $CODE.err
+
+# We do not want Make to stop -> Return 0
+# The Makefile will check if a log contains FAIL at the end
+exit 0
@@ -0,0 +1,76 @@
+#!/bin/bash
+source ../utils.sh
+
+# Contiki directory
+CONTIKI=$1
+
+# Example code directory
+CODE_DIR=$CONTIKI/tests/07-simulation-base/code-log-deferred/
+CODE=test-log-deferred
+DECODER=$CONTIKI/tools/log-decoder/log-decoder.py
+
+# The strings are overwritten right after the log calls
+LONG=$(printf 'a%.0s' $(seq 127))
+EXPECTED="^\[INFO: Test      \] str: node 42, 7, const$
+^\[INFO: Test      \] pad: \[  node 42\] \[node 42  \]$
+^\[INFO: Test      \] long: $LONG$
+^\[INFO: Test      \] done$"
+
+check() {
+  echo "$EXPECTED" | while read -r pattern; do
+    grep -q "$pattern" $1 || echo "missing: $pattern"
+  done
+}
+
+# Formatted on the node
+echo "Starting native node, formatting records"
+make -C $CODE_DIR TARGET=native DEFINES=LOG_CONF_DEFERRED=1 > make.log 2> make.err
+$CODE_DIR/$CODE.native < /dev/null > $CODE.log 2> $CODE.err &
+CPID=$!
+sleep 2
+
+echo "Closing native node"
+kill_bg $CPID
+make -C $CODE_DIR TARGET=native clean > /dev/null 2>&1
+
+# Formatted by the host-side decoder
+echo "Starting native node, logging raw records"
+make -C $CODE_DIR TARGET=native DEFINES=LOG_CONF_DEFERRED=1,LOG_CONF_DEFERRED_RAW=1 >> make.log 2>> make.err
+$CODE_DIR/$CODE.native < /dev/null > $CODE.raw 2>> $CODE.err &
+CPID=$!
+sleep 2
+
+echo "Closing native node"
+kill_bg $CPID
+
+echo "Decoding the log"
+$DECODER $CODE_DIR/$CODE.native $CODE.raw > $CODE.decoded 2>> $CODE.err
+
+MISSING="$(check $CODE.log)$(check $CODE.decoded)"
+if [ -n "$MISSING" ] || ! grep -q "^#LOGD " $CODE.raw ; then
+  echo "==== make.log ====" ; cat make.log;
+  echo "==== make.err ====" ; cat make.err;
+  echo "==== $CODE.log ====" ; cat $CODE.log;
+  echo "==== $CODE.raw ====" ; cat $CODE.raw;
+  echo "==== $CODE.decoded ====" ; cat $CODE.decoded;
+  echo "==== $CODE.err ====" ; cat $CODE.err;
+  echo "$MISSING"
+
+  printf "%-32s TEST FAIL\n" "log-deferred-strings" | tee log-deferred-strings.testlog;
+else
+  cp $CODE.decoded log-deferred-strings.testlog
+  printf "%-32s TEST OK\n" "log-deferred-strings" | tee log-deferred-strings.testlog;
+fi
+
+make -C $CODE_DIR TARGET=native clean > /dev/null 2>&1
+
+rm make.log
+rm make.err
+rm $CODE.log
+rm $CODE.raw
+rm $CODE.decoded
+rm $CODE.err
+
+# We do not want Make to stop -> Return 0
+# The Makefile will check if a log contains FAIL at the end
+exit 0
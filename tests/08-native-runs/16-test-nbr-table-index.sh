@@ -0,0 +1,47 @@
+#!/bin/bash
+source ../utils.sh
+
+# Contiki directory
+CONTIKI=$1
+
+# Example code directory
+CODE_DIR=$CONTIKI/tests/07-simulation-base/code-nbr-table/
+CODE=test-nbr-table
+# The neighbor table test, with the address index enabled
+TEST=test-nbr-table-index
+
+# Starting Contiki-NG native node
+echo "Starting native node"
+make -C $CODE_DIR TARGET=native clean > /dev/null 2>&1
+make -C $CODE_DIR TARGET=native DEFINES=NBR_TABLE_CONF_WITH_INDEX=1 > make.log 2> make.err
+$CODE_DIR/$CODE.native > $TEST.log 2> $TEST.err &
+CPID=$!
+sleep 2
+
+echo "Closing native node"
+sleep 2
+kill_bg $CPID
+
+if grep -q "=check-me= FAILED" $TEST.log || ! grep -q "=check-me= DONE" $TEST.log ; then
+  echo "==== make.log ====" ; cat make.log;
+  echo "==== make.err ====" ; cat make.err;
+  echo "==== $TEST.log ====" ; cat $TEST.log;
+  echo "==== $TEST.err ====" ; cat $TEST.err;
+
+  printf "%-32s TEST FAIL\n" "$TEST" | tee $TEST.testlog;
+else
+  cp $TEST.log $TEST.testlog
+  printf "%-32s TEST OK\n" "$TEST" | tee $TEST.testlog;
+fi
+
+# Do not leave objects built with the index to other tests
+make -C $CODE_DIR TARGET=native clean > /dev/null 2>&1
+
+rm make.log
+rm make.err
+rm $TEST.log
+rm $TEST.err
+
+# We do not want Make to stop -> Return 0
+# The Makefile will check if a log contains FAIL at the end
+exit 0
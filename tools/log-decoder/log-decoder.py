@@ -0,0 +1,342 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. Neither the name of the copyright holder nor the names of its
+#    contributors may be used to endorse or promote products derived
+#    from this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+# FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+# COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+# INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+# (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+# HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+# STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+# OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Decode the output of a node built with LOG_CONF_DEFERRED and
+LOG_CONF_DEFERRED_RAW. The format strings and module names are taken
+from the log_desc section of the ELF file the node was built from.
+
+Usage: log-decoder.py <firmware.elf> [log file]
+
+Reads standard input when no log file is given. Lines that are not
+deferred log records are passed through unchanged.
+"""
+
+import re
+import struct
+import sys
+
+SHT_RELA = 4
+# R_X86_64_RELATIVE, R_AARCH64_RELATIVE
+RELATIVE_TYPES = (8, 1027)
+
+CONVERSION = re.compile(
+    r'%([-+ #0]*)(\d+|\*)?(?:\.(\d+|\*))?(hh|h|ll|l|z|j|t|L)?([diouxXcsp%])')
+
+
+class Elf:
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        if self.data[:4] != b'\x7fELF':
+            raise ValueError('%s is not an ELF file' % path)
+        self.is64 = self.data[4] == 2
+        self.endian = '<' if self.data[5] == 1 else '>'
+        self.ptr_size = 8 if self.is64 else 4
+        self.ptr_fmt = self.endian + ('Q' if self.is64 else 'I')
+        self._read_sections()
+        self._read_segments()
+        self.relocs = self._read_relocs()
+
+    def _unpack(self, fmt, offset):
+        return struct.unpack_from(self.endian + fmt, self.data, offset)
+
+    def _read_sections(self):
+        if self.is64:
+            shoff, = self._unpack('Q', 0x28)
+            shentsize, shnum, shstrndx = self._unpack('HHH', 0x3a)
+            fmt = 'IIQQQQIIQQ'
+        else:
+            shoff, = self._unpack('I', 0x20)
+            shentsize, shnum, shstrndx = self._unpack('HHH', 0x2e)
+            fmt = 'IIIIIIIIII'
+        raw = [self._unpack(fmt, shoff + i * shentsize) for i in range(shnum)]
+        strtab = raw[shstrndx][4]
+        self.sections = {}
+        self.section_list = []
+        for s in raw:
+            name = self._cstring_at(strtab + s[0])
+            sec = {'name': name, 'type': s[1], 'addr': s[3],
+                   'offset': s[4], 'size': s[5], 'entsize': s[9]}
+            self.sections[name] = sec
+            self.section_list.append(sec)
+
+    def _read_segments(self):
+        if self.is64:
+            phoff, = self._unpack('Q', 0x20)
+            phentsize, phnum = self._unpack('HH', 0x36)
+        else:
+            phoff, = self._unpack('I', 0x1c)
+            phentsize, phnum = self._unpack('HH', 0x2a)
+        self.segments = []
+        for i in range(phnum):
+            off = phoff + i * phentsize
+            if self.is64:
+                ptype, _, offset, vaddr, _, filesz = self._unpack('IIQQQQ', off)
+            else:
+                ptype, offset, vaddr, _, filesz = self._unpack('IIIII', off)
+            if ptype == 1:  # PT_LOAD
+                self.segments.append((vaddr, offset, filesz))
+
+    def _read_relocs(self):
+        relocs = {}
+        for sec in self.section_list:
+            if sec['type'] != SHT_RELA:
+                continue
+            size = 24 if self.is64 else 12
+            fmt = 'QQq' if self.is64 else 'IIi'
+            for i in range(sec['size'] // size):
+                r_offset, r_info, addend = self._unpack(
+                    fmt, sec['offset'] + i * size)
+                rtype = r_info & 0xffffffff if self.is64 else r_info & 0xff
+                if rtype in RELATIVE_TYPES:
+                    relocs[r_offset] = addend
+        return relocs
+
+    def _cstring_at(self, offset):
+        end = self.data.index(b'\0', offset)
+        return self.data[offset:end].decode('utf-8', 'replace')
+
+    def file_offset(self, vaddr):
+        for start, offset, size in self.segments:
+            if start <= vaddr < start + size:
+                return offset + vaddr - start
+        return None
+
+    def pointer(self, vaddr):
+        if vaddr in self.relocs:
+            return self.relocs[vaddr]
+        offset = self.file_offset(vaddr)
+        return struct.unpack_from(self.ptr_fmt, self.data, offset)[0]
+
+    def string(self, vaddr):
+        if vaddr == 0:
+            return None
+        offset = self.file_offset(vaddr)
+        if offset is None:
+            return '<bad string 0x%x>' % vaddr
+        return self._cstring_at(offset)
+
+
+class Descriptor:
+    def __init__(self, elf, vaddr):
+        p = elf.ptr_size
+        self.fmt = elf.string(elf.pointer(vaddr))
+        self.module = elf.string(elf.pointer(vaddr + p))
+        self.levelstr = elf.string(elf.pointer(vaddr + 2 * p))
+        self.file = elf.string(elf.pointer(vaddr + 3 * p))
+        self.line, self.level, self.flags = struct.unpack_from(
+            elf.endian + 'HBB', elf.data, elf.file_offset(vaddr + 4 * p))
+
+
+# Must match sys/log-deferred.h
+FLAG_NEWLINE = 0x01
+FLAG_LLADDR = 0x02
+FLAG_6ADDR = 0x04
+FLAG_COMPACT = 0x08
+
+
+class Decoder:
+    def __init__(self, elf):
+        self.elf = elf
+        if 'log_desc' not in elf.sections:
+            raise ValueError('no log_desc section, '
+                             'was the firmware built with LOG_CONF_DEFERRED?')
+        self.section = elf.sections['log_desc']
+        p = elf.ptr_size
+        self.desc_size = (4 * p + 4 + p - 1) // p * p
+        self.descriptors = {}
+        self.bias = 0
+
+    def descriptor(self, index):
+        if index not in self.descriptors:
+            if (index + 1) * self.desc_size > self.section['size']:
+                return None
+            self.descriptors[index] = Descriptor(
+                self.elf, self.section['addr'] + index * self.desc_size)
+        return self.descriptors[index]
+
+    def set_base(self, base):
+        self.bias = base - self.section['addr']
+
+    def to_int(self, word, bits, signed):
+        word &= (1 << bits) - 1
+        if signed and word & (1 << (bits - 1)):
+            word -= 1 << bits
+        return word
+
+    def inline_string(self, words, index):
+        if index >= len(words):
+            return ''
+        raw = b''.join(struct.pack(self.elf.ptr_fmt, w) for w in words[index:])
+        return raw.split(b'\0', 1)[0].decode('utf-8', 'replace')
+
+    def format(self, fmt, args, words=None):
+        """Format the arguments. With words, %s arguments are the index
+        of a string copied into the record instead of a pointer."""
+        bits = 8 * self.elf.ptr_size
+        sizes = {'hh': 8, 'h': 16, None: 32, 'l': bits, 'll': 64,
+                 'z': bits, 'j': 64, 't': bits, 'L': 64}
+        args = list(args)
+
+        def arg():
+            return args.pop(0) if args else 0
+
+        def convert(m):
+            flags, width, precision, length, conv = m.groups()
+            if conv == '%':
+                return '%'
+            if width == '*':
+                width = str(self.to_int(arg(), 32, True))
+            if precision == '*':
+                precision = str(self.to_int(arg(), 32, True))
+            spec = '%' + flags + (width or '')
+            if precision is not None:
+                spec += '.' + precision
+            word = arg()
+            if conv in 'di':
+                return (spec + 'd') % self.to_int(word, sizes[length], True)
+            if conv in 'ouxX':
+                return (spec + conv) % self.to_int(word, sizes[length], False)
+            if conv == 'c':
+                return (spec + 'c') % chr(word & 0xff)
+            if conv == 'p':
+                return (spec + 's') % ('0x%x' % word)
+            if not word:
+                string = '(null)'
+            elif words is not None:
+                string = self.inline_string(words, word)
+            else:
+                string = self.elf.string(word - self.bias)
+            return (spec + 's') % string
+
+        return CONVERSION.sub(convert, fmt)
+
+    def address_bytes(self, args, length):
+        raw = b''.join(struct.pack(self.elf.ptr_fmt, a) for a in args)
+        return raw[:length]
+
+    def lladdr(self, addr, compact):
+        if compact:
+            if addr is None or not any(addr):
+                return 'LL-NULL'
+            return 'LL-%04x' % ((addr[-2] << 8) | addr[-1])
+        if addr is None:
+            return '(NULL LL addr)'
+        return '.'.join(addr[i:i + 2].hex() for i in range(0, len(addr), 2))
+
+    def ip6addr(self, addr, compact):
+        if addr is None:
+            return '6A-NULL' if compact else '(NULL IP addr)'
+        if compact:
+            if addr[0] == 0xff:
+                prefix = '6M'
+            elif addr[0] == 0xfe and addr[1] & 0xc0 == 0x80:
+                prefix = '6L'
+            else:
+                prefix = '6G'
+            return '%s-%04x' % (prefix, (addr[14] << 8) | addr[15])
+        if addr[:12] == bytes(10) + b'\xff\xff':
+            return '::FFFF:%u.%u.%u.%u' % tuple(addr[12:])
+        out = ''
+        f = 0
+        for i in range(0, 16, 2):
+            a = (addr[i] << 8) | addr[i + 1]
+            if a == 0 and f >= 0:
+                if f == 0:
+                    out += '::'
+                f += 1
+            else:
+                if f > 0:
+                    f = -1
+                elif i > 0:
+                    out += ':'
+                out += '%x' % a
+        return out
+
+    def record(self, index, header, args):
+        desc = self.descriptor(index)
+        if desc is None:
+            return '<unknown log record %u>' % index
+        nargs = header & 0xff
+        length = header >> 8
+        out = ''
+        if desc.flags & FLAG_NEWLINE:
+            if desc.levelstr is not None and desc.module is not None:
+                out += '[%-4s: %-10s] ' % (desc.levelstr, desc.module)
+            if desc.file is not None:
+                out += '[%s: %d] ' % (desc.file, desc.line)
+        compact = desc.flags & FLAG_COMPACT
+        addr = self.address_bytes(args, length) if nargs else None
+        if desc.flags & FLAG_LLADDR:
+            return out + self.lladdr(addr, compact)
+        if desc.flags & FLAG_6ADDR:
+            return out + self.ip6addr(addr, compact)
+        if length:
+            # The strings were copied after the arguments
+            return out + self.format(desc.fmt, args[:length], args)
+        return out + self.format(desc.fmt, args)
+
+    def line(self, line):
+        """Decode one line of output. Returns the text to print."""
+        fields = line.split()
+        if not fields or not fields[0].startswith('#LOGD'):
+            return line
+        try:
+            if fields[0] == '#LOGD-BASE':
+                self.set_base(int(fields[1], 16))
+                return ''
+            if fields[0] == '#LOGD-DROP':
+                return '[%s log records dropped]\n' % fields[1]
+            if fields[0] == '#LOGD':
+                return self.record(int(fields[1]), int(fields[2], 16),
+                                   [int(a, 16) for a in fields[3:]])
+        except (IndexError, ValueError):
+            pass
+        return line
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        sys.stderr.write(__doc__)
+        sys.exit(1)
+    try:
+        decoder = Decoder(Elf(sys.argv[1]))
+    except (OSError, ValueError) as e:
+        sys.stderr.write('%s\n' % e)
+        sys.exit(1)
+    log = open(sys.argv[2]) if len(sys.argv) == 3 else sys.stdin
+    for line in log:
+        sys.stdout.write(decoder.line(line))
+        sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
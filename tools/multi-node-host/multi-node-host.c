@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2026, This. Is. IoT. - https://thisisiot.io
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its
+ *    contributors may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE
+ * COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED
+ * OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *         Host for many native Contiki-NG nodes in a single Linux process.
+ *
+ *         The node firmware is built with NATIVE_MULTI_NODE=1, which
+ *         links it as a shared object. The host loads a private copy of
+ *         that object for every node, so each node keeps its own copy of
+ *         all the global state of the OS and the network stack, and
+ *         spreads the nodes over a number of worker threads. Each worker
+ *         sleeps in epoll until one of its nodes has an expired etimer or
+ *         a ready file descriptor.
+ */
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+/*---------------------------------------------------------------------------*/
+/* How many times a busy node runs before the other nodes get a turn */
+#define RUN_BUDGET 16
+#define MAX_EVENTS 64
+/*---------------------------------------------------------------------------*/
+struct node {
+  uint16_t id;
+  int fd;
+  int queued;
+  int (*run)(void);
+  char **argv;
+};
+
+struct worker {
+  pthread_t thread;
+  unsigned index;
+  struct node *nodes;
+  unsigned count;
+  struct node **ready;
+  int epoll_fd;
+};
+
+static const char *image;
+static int node_argc;
+static char **node_argv;
+static int pin;
+/*---------------------------------------------------------------------------*/
+static void
+fail(const char *what, const char *detail)
+{
+  fprintf(stderr, "multi-node-host: %s: %s\n", what, detail);
+  exit(EXIT_FAILURE);
+}
+/*---------------------------------------------------------------------------*/
+static void *
+lookup(void *handle, const char *symbol)
+{
+  void *p;
+
+  p = dlsym(handle, symbol);
+  if(p == NULL) {
+    fail(symbol, "not found, was the node built with NATIVE_MULTI_NODE=1?");
+  }
+  return p;
+}
+/*---------------------------------------------------------------------------*/
+/*
+ * Load a private copy of the node image. The dynamic loader shares
+ * objects that are loaded from the same file, so the image is first
+ * copied to an anonymous memory file.
+ */
+static void *
+load_image(uint16_t id)
+{
+  char name[32];
+  struct stat st;
+  void *handle;
+  off_t offset;
+  int src;
+  int dst;
+
+  src = open(image, O_RDONLY | O_CLOEXEC);
+  if(src < 0 || fstat(src, &st) < 0) {
+    fail(image, strerror(errno));
+  }
+  snprintf(name, sizeof(name), "node-%u", id);
+  dst = memfd_create(name, MFD_CLOEXEC);
+  if(dst < 0) {
+    fail("memfd_create", strerror(errno));
+  }
+  offset = 0;
+  while(offset < st.st_size) {
+    if(sendfile(dst, src, &offset, st.st_size - offset) <= 0) {
+      fail(image, strerror(errno));
+    }
+  }
+  close(src);
+
+  snprintf(name, sizeof(name), "/proc/self/fd/%d", dst);
+  handle = dlopen(name, RTLD_NOW | RTLD_LOCAL);
+  if(handle == NULL) {
+    fail(image, dlerror());
+  }
+  close(dst);
+  return handle;
+}
+/*---------------------------------------------------------------------------*/
+static void
+start_node(struct worker *w, struct node *n)
+{
+  void (*configure)(uint16_t);
+  int (*node_main)(int, char **);
+  int (*node_fd)(void);
+  struct epoll_event ev;
+  void *handle;
+  char name[16];
+  int i;
+
+  handle = load_image(n->id);
+  configure = lookup(handle, "native_node_configure");
+  node_main = lookup(handle, "main");
+  node_fd = lookup(handle, "native_node_fd");
+  n->run = lookup(handle, "native_node_run");
+
+  /* The node keeps a reference to its arguments */
+  n->argv = calloc(node_argc + 2, sizeof(char *));
+  if(n->argv == NULL) {
+    fail("calloc", strerror(errno));
+  }
+  snprintf(name, sizeof(name), "node-%u", n->id);
+  n->argv[0] = strdup(name);
+  for(i = 0; i < node_argc; i++) {
+    n->argv[i + 1] = node_argv[i];
+  }
+
+  configure(n->id);
+  node_main(node_argc + 1, n->argv);
+
+  n->fd = node_fd();
+  if(n->fd < 0) {
+    fail(name, "failed to start");
+  }
+  memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLIN;
+  ev.data.ptr = n;
+  if(epoll_ctl(w->epoll_fd, EPOLL_CTL_ADD, n->fd, &ev) < 0) {
+    fail("epoll_ctl", strerror(errno));
+  }
+}
+/*---------------------------------------------------------------------------*/
+static void *
+worker_thread(void *arg)
+{
+  struct epoll_event events[MAX_EVENTS];
+  struct worker *w = arg;
+  struct node *n;
+  unsigned nready;
+  unsigned busy;
+  unsigned i;
+  int count;
+  int budget;
+
+  if(pin) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(w->index % sysconf(_SC_NPROCESSORS_ONLN), &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  }
+
+  w->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+  if(w->epoll_fd < 0) {
+    fail("epoll_create1", strerror(errno));
+  }
+
+  /* Every node starts with the events posted during its initialisation */
+  nready = 0;
+  for(i = 0; i < w->count; i++) {
+    start_node(w, &w->nodes[i]);
+    w->nodes[i].queued = 1;
+    w->ready[nready++] = &w->nodes[i];
+  }
+
+  while(1) {
+    count = epoll_wait(w->epoll_fd, events, MAX_EVENTS, nready ? 0 : -1);
+    if(count < 0) {
+      if(errno != EINTR) {
+        fail("epoll_wait", strerror(errno));
+      }
+      continue;
+    }
+    for(i = 0; i < count; i++) {
+      n = events[i].data.ptr;
+      if(!n->queued) {
+        n->queued = 1;
+        w->ready[nready++] = n;
+      }
+    }
+
+    /* Run the ready nodes, keeping those that are still busy */
+    busy = 0;
+    for(i = 0; i < nready; i++) {
+      n = w->ready[i];
+      for(budget = RUN_BUDGET; budget > 0 && n->run(); budget--);
+      if(budget == 0) {
+        w->ready[busy++] = n;
+      } else {
+        n->queued = 0;
+      }
+    }
+    nready = busy;
+  }
+  return NULL;
+}
+/*---------------------------------------------------------------------------*/
+static void
+usage(const char *prog)
+{
+  fprintf(stderr, "usage: %s [options] node.so [node arguments...]\n"
+          "  -n count  Number of nodes (default 1)\n"
+          "  -t count  Number of worker threads (default: one per CPU)\n"
+          "  -i id     Identifier of the first node (default 1)\n"
+          "  -p        Pin each worker thread to a CPU\n", prog);
+  exit(EXIT_FAILURE);
+}
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char **argv)
+{
+  struct worker *workers;
+  struct node *nodes;
+  unsigned nnodes;
+  unsigned nworkers;
+  unsigned first_id;
+  unsigned i;
+  unsigned start;
+  int opt;
+
+  nnodes = 1;
+  nworkers = sysconf(_SC_NPROCESSORS_ONLN);
+  first_id = 1;
+  while((opt = getopt(argc, argv, "+n:t:i:ph")) != -1) {
+    switch(opt) {
+    case 'n':
+      nnodes = strtoul(optarg, NULL, 0);
+      break;
+    case 't':
+      nworkers = strtoul(optarg, NULL, 0);
+      break;
+    case 'i':
+      first_id = strtoul(optarg, NULL, 0);
+      break;
+    case 'p':
+      pin = 1;
+      break;
+    default:
+      usage(argv[0]);
+    }
+  }
+  if(optind >= argc || nnodes == 0 || first_id + nnodes - 1 > UINT16_MAX) {
+    usage(argv[0]);
+  }
+  image = argv[optind];
+  node_argc = argc - optind - 1;
+  node_argv = &argv[optind + 1];
+
+  if(nworkers == 0) {
+    nworkers = 1;
+  }
+  if(nworkers > nnodes) {
+    nworkers = nnodes;
+  }
+
+  nodes = calloc(nnodes, sizeof(struct node));
+  workers = calloc(nworkers, sizeof(struct worker));
+  if(nodes == NULL || workers == NULL) {
+    fail("calloc", strerror(errno));
+  }
+  for(i = 0; i < nnodes; i++) {
+    nodes[i].id = first_id + i;
+  }
+
+  printf("Running %u nodes on %u threads\n", nnodes, nworkers);
+
+  /* Give each worker a contiguous range of nodes */
+  start = 0;
+  for(i = 0; i < nworkers; i++) {
+    workers[i].index = i;
+    workers[i].nodes = &nodes[start];
+    workers[i].count = nnodes / nworkers + (i < nnodes % nworkers);
+    workers[i].ready = calloc(workers[i].count, sizeof(struct node *));
+    if(workers[i].ready == NULL) {
+      fail("calloc", strerror(errno));
+    }
+    start += workers[i].count;
+    if(pthread_create(&workers[i].thread, NULL, worker_thread, &workers[i])) {
+      fail("pthread_create", strerror(errno));
+    }
+  }
+
+  for(i = 0; i < nworkers; i++) {
+    pthread_join(workers[i].thread, NULL);
+  }
+  return 0;
+}